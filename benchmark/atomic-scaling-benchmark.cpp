@@ -0,0 +1,242 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Atomic contention and reduction scalability benchmark.
+//
+// Accumulates num_updates values into num_targets distinct locations,
+// hist[key(i)] += value(i), for a sweep of target counts (1 to 1M), thread
+// counts and value types, using:
+//
+//   builtin  - RAJA::atomic::atomicAdd<builtin_atomic>
+//   omp      - RAJA::atomic::atomicAdd<omp_atomic>
+//   auto     - RAJA::atomic::atomicAdd<auto_atomic>
+//   private  - one private copy of hist per thread, summed afterwards
+//   reduce   - RAJA::ReduceSum<omp_reduce> (single target only)
+//   ordered  - RAJA::ReduceSum<omp_reduce_ordered> (single target only)
+//
+// For each value type and thread count the fastest strategy is reported
+// per target count, followed by the crossover point: the smallest target
+// count from which the best atomic policy beats per-thread privatization.
+//
+// Usage: benchmark-atomic-scaling [num_updates]
+//
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <omp.h>
+
+#include "RAJA/RAJA.hpp"
+#include "timing.hpp"
+
+using RAJA::Index_type;
+
+namespace
+{
+
+constexpr int num_reps = 3;
+
+//
+// Scatter update i to a target with a multiplicative hash so that
+// neighboring iterations do not hit neighboring targets.
+//
+RAJA_INLINE Index_type key(Index_type i, Index_type num_targets)
+{
+  return static_cast<Index_type>(
+      (static_cast<unsigned long long>(i) * 2654435761ull) % num_targets);
+}
+
+template <typename T>
+RAJA_INLINE T value(Index_type i)
+{
+  return static_cast<T>(i & 7);
+}
+
+using bench::best_time;
+
+template <typename AtomicPolicy, typename T>
+double time_atomic(std::vector<T>& hist,
+                   Index_type num_updates,
+                   Index_type num_targets)
+{
+  T* h = hist.data();
+  return best_time<num_reps>([=]() {
+    RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::RangeSegment(0, num_updates), [=](Index_type i) {
+          RAJA::atomic::atomicAdd<AtomicPolicy>(&h[key(i, num_targets)],
+                                                value<T>(i));
+        });
+  });
+}
+
+template <typename T>
+double time_privatized(std::vector<T>& hist,
+                       Index_type num_updates,
+                       Index_type num_targets,
+                       int num_threads)
+{
+  std::vector<T> priv(num_threads * num_targets);
+  T* h = hist.data();
+  T* p = priv.data();
+  return best_time<num_reps>([=]() {
+    RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::RangeSegment(0, num_threads * num_targets),
+        [=](Index_type i) { p[i] = static_cast<T>(0); });
+
+    RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::RangeSegment(0, num_updates), [=](Index_type i) {
+          p[omp_get_thread_num() * num_targets + key(i, num_targets)] +=
+              value<T>(i);
+        });
+
+    RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::RangeSegment(0, num_targets), [=](Index_type t) {
+          T sum = h[t];
+          for (int thread = 0; thread < num_threads; ++thread) {
+            sum += p[thread * num_targets + t];
+          }
+          h[t] = sum;
+        });
+  });
+}
+
+template <typename ReducePolicy, typename T>
+double time_reducer(std::vector<T>& hist, Index_type num_updates)
+{
+  T* h = hist.data();
+  return best_time<num_reps>([=]() {
+    RAJA::ReduceSum<ReducePolicy, T> sum(static_cast<T>(0));
+    RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::RangeSegment(0, num_updates),
+        [=](Index_type i) { sum += value<T>(i); });
+    h[0] += sum.get();
+  });
+}
+
+void print_time(double t)
+{
+  std::cout << std::setw(11);
+  if (t < std::numeric_limits<double>::max()) {
+    std::cout << std::scientific << std::setprecision(2) << t;
+  } else {
+    std::cout << "-";
+  }
+}
+
+template <typename T>
+void sweep(const char* type_name, Index_type num_updates, int num_threads)
+{
+  const Index_type max_targets = Index_type(1) << 20;
+  const double none = std::numeric_limits<double>::max();
+
+  omp_set_num_threads(num_threads);
+
+  std::cout << "\nvalue type " << type_name << ", " << num_threads
+            << " thread(s)\n";
+  std::cout << std::setw(9) << "targets" << std::setw(11) << "builtin"
+            << std::setw(11) << "omp" << std::setw(11) << "auto"
+            << std::setw(11) << "private" << std::setw(11) << "reduce"
+            << std::setw(11) << "ordered"
+            << "  best\n";
+
+  Index_type crossover = -1;
+
+  for (Index_type num_targets = 1; num_targets <= max_targets;
+       num_targets *= 16) {
+    std::vector<T> hist(num_targets, static_cast<T>(0));
+
+    const double t_builtin = time_atomic<RAJA::atomic::builtin_atomic>(
+        hist, num_updates, num_targets);
+    const double t_omp =
+        time_atomic<RAJA::atomic::omp_atomic>(hist, num_updates, num_targets);
+    const double t_auto =
+        time_atomic<RAJA::atomic::auto_atomic>(hist, num_updates, num_targets);
+    const double t_private =
+        time_privatized(hist, num_updates, num_targets, num_threads);
+    const double t_reduce =
+        num_targets == 1 ? time_reducer<RAJA::omp_reduce>(hist, num_updates)
+                         : none;
+    const double t_ordered =
+        num_targets == 1
+            ? time_reducer<RAJA::omp_reduce_ordered>(hist, num_updates)
+            : none;
+
+    const double times[] = {
+        t_builtin, t_omp, t_auto, t_private, t_reduce, t_ordered};
+    const char* names[] = {
+        "builtin", "omp", "auto", "private", "reduce", "ordered"};
+    const int best = static_cast<int>(
+        std::min_element(std::begin(times), std::end(times))
+        - std::begin(times));
+
+    const double t_atomic = std::min(t_builtin, std::min(t_omp, t_auto));
+    if (crossover < 0 && t_atomic < t_private) {
+      crossover = num_targets;
+    }
+
+    std::cout << std::setw(9) << num_targets;
+    for (double t : times) {
+      print_time(t);
+    }
+    std::cout << "  " << names[best] << "\n";
+  }
+
+  if (crossover < 0) {
+    std::cout << "crossover: privatization fastest for all target counts\n";
+  } else {
+    std::cout << "crossover: atomics beat privatization from " << crossover
+              << " targets\n";
+  }
+}
+
+template <typename T>
+void sweep_threads(const char* type_name,
+                   Index_type num_updates,
+                   int max_threads)
+{
+  for (int num_threads = 1; num_threads < max_threads; num_threads *= 2) {
+    sweep<T>(type_name, num_updates, num_threads);
+  }
+  sweep<T>(type_name, num_updates, max_threads);
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  const Index_type num_updates =
+      argc > 1 ? std::atol(argv[1]) : Index_type(1) << 22;
+
+  std::cout << "RAJA atomic/reduction scaling, " << num_updates
+            << " updates per run\n";
+
+  const int max_threads = omp_get_max_threads();
+
+  sweep_threads<int>("int", num_updates, max_threads);
+  sweep_threads<unsigned long long>("unsigned long long",
+                                    num_updates,
+                                    max_threads);
+  sweep_threads<float>("float", num_updates, max_threads);
+  sweep_threads<double>("double", num_updates, max_threads);
+
+  omp_set_num_threads(max_threads);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,123 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// View axis scan benchmark.
+//
+// Computes inclusive prefix sums of every line of a 3-D array along each of
+// its axes using:
+//
+//   gather - forall over lines, copying each line to a temporary, scanning
+//            it with RAJA::inclusive_scan_inplace and copying it back
+//   axis   - RAJA::inclusive_scan_inplace over a (View, axis) pair
+//
+// for the sequential, OpenMP and TBB policies. Lines along the strided axes
+// are scanned in batches by the axis scan, so its inner loop runs over
+// adjacent memory instead of one stride per element.
+//
+// Usage: benchmark-axis-scan [extent]   (array is extent x extent x 4 extent)
+//
+
+#include <array>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "timing.hpp"
+
+using RAJA::Index_type;
+
+namespace
+{
+
+using bench::best_time;
+
+using View3 = RAJA::View<double, RAJA::Layout<3>>;
+
+template <typename Pol>
+double time_gather(View3 view, std::array<Index_type, 3> n, int axis)
+{
+  const int a = axis == 0 ? 1 : 0;
+  const int b = axis == 2 ? 1 : 2;
+  const Index_type length = n[axis];
+  return best_time([=]() {
+    RAJA::forall<Pol>(
+        RAJA::RangeSegment(0, n[a] * n[b]), [=](Index_type line) {
+          std::vector<double> tmp(length);
+          std::array<Index_type, 3> idx;
+          idx[a] = line / n[b];
+          idx[b] = line % n[b];
+          for (idx[axis] = 0; idx[axis] < length; ++idx[axis]) {
+            tmp[idx[axis]] = view(idx[0], idx[1], idx[2]);
+          }
+          RAJA::inclusive_scan_inplace(
+              RAJA::seq_exec{}, tmp.data(), tmp.data() + length);
+          for (idx[axis] = 0; idx[axis] < length; ++idx[axis]) {
+            view(idx[0], idx[1], idx[2]) = tmp[idx[axis]];
+          }
+        });
+  });
+}
+
+template <typename Pol>
+double time_axis(View3 view, int axis)
+{
+  return best_time(
+      [=]() { RAJA::inclusive_scan_inplace(Pol{}, view, axis); });
+}
+
+template <typename Pol>
+void run(const char* policy_name, std::array<Index_type, 3> n)
+{
+  std::vector<double> data(n[0] * n[1] * n[2], 1.0);
+  View3 view(data.data(), n[0], n[1], n[2]);
+  const double size = static_cast<double>(data.size());
+
+  for (int axis = 0; axis < 3; ++axis) {
+    const double t_gather = time_gather<Pol>(view, n, axis);
+    const double t_axis = time_axis<Pol>(view, axis);
+    std::cout << std::setw(8) << policy_name << std::setw(6) << axis
+              << std::fixed << std::setprecision(2) << std::setw(10)
+              << 1.0e9 * t_gather / size << std::setw(10)
+              << 1.0e9 * t_axis / size << std::setw(9) << t_gather / t_axis
+              << "x\n";
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  const Index_type extent = argc > 1 ? std::atol(argv[1]) : 128;
+  const std::array<Index_type, 3> n{{extent, extent, 4 * extent}};
+
+  std::cout << "RAJA View axis scan, " << n[0] << " x " << n[1] << " x "
+            << n[2] << " doubles, ns per element\n";
+  std::cout << std::setw(8) << "policy" << std::setw(6) << "axis"
+            << std::setw(10) << "gather" << std::setw(10) << "axis"
+            << std::setw(10) << "speedup\n";
+
+  run<RAJA::seq_exec>("seq", n);
+#if defined(RAJA_ENABLE_OPENMP)
+  run<RAJA::omp_parallel_for_exec>("omp", n);
+#endif
+#if defined(RAJA_ENABLE_TBB)
+  run<RAJA::tbb_for_exec>("tbb", n);
+#endif
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,251 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Batched small matrix benchmark.
+//
+// Multiplies and inverts a batch of N x N matrices (N = 3, 4, 8) stored in
+// three layouts:
+//
+//   layout1     - one row-major matrix after another, as layout 1 of
+//                 examples/tut_batched-matrix-multiply.cpp
+//   layout2     - matrix index fastest, as layout 2 of that example
+//   interleaved - RAJA::batched::InterleavedLayout, blocks of SIMD-width
+//                 matrices with entry (i, j) of a block contiguous
+//
+// layout1 and layout2 run one matrix per forall iteration; interleaved
+// runs RAJA::batched::multiply and RAJA::batched::inverse, one block per
+// iteration with a SIMD loop over the matrices of the block. Inversion
+// uses Gauss-Jordan elimination with partial pivoting for the per-matrix
+// layouts. Each policy reports the best of bench::default_reps runs.
+//
+// Usage: benchmark-batched-matrix [entries_per_array]
+//
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "timing.hpp"
+
+using RAJA::Index_type;
+
+namespace
+{
+
+using bench::best_time;
+
+//! Diagonally dominant test matrix e, so every inverse exists.
+double entry(Index_type e, int i, int j)
+{
+  return (i == j ? 8.0 : 0.0) + static_cast<double>((e + 3 * i + j) % 7) / 7.0;
+}
+
+template <typename ExecPolicy, int N, typename MatView>
+double time_multiply(MatView a, MatView b, MatView c, Index_type count)
+{
+  return best_time([=]() {
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, count), [=](Index_type e) {
+      for (int i = 0; i < N; ++i) {
+        for (int j = 0; j < N; ++j) {
+          double acc = 0.0;
+          for (int k = 0; k < N; ++k) {
+            acc += a(e, i, k) * b(e, k, j);
+          }
+          c(e, i, j) = acc;
+        }
+      }
+    });
+  });
+}
+
+template <typename ExecPolicy, int N, typename MatView>
+double time_inverse(MatView a, MatView c, Index_type count)
+{
+  return best_time([=]() {
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, count), [=](Index_type e) {
+      double m[N][2 * N];
+      for (int i = 0; i < N; ++i) {
+        for (int j = 0; j < N; ++j) {
+          m[i][j] = a(e, i, j);
+          m[i][N + j] = i == j ? 1.0 : 0.0;
+        }
+      }
+      for (int k = 0; k < N; ++k) {
+        int p = k;
+        for (int r = k + 1; r < N; ++r) {
+          if (std::abs(m[r][k]) > std::abs(m[p][k])) p = r;
+        }
+        for (int j = 0; j < 2 * N; ++j) {
+          std::swap(m[k][j], m[p][j]);
+        }
+        const double inv = 1.0 / m[k][k];
+        for (int j = 0; j < 2 * N; ++j) {
+          m[k][j] *= inv;
+        }
+        for (int r = 0; r < N; ++r) {
+          if (r == k) continue;
+          const double f = m[r][k];
+          for (int j = 0; j < 2 * N; ++j) {
+            m[r][j] -= f * m[k][j];
+          }
+        }
+      }
+      for (int i = 0; i < N; ++i) {
+        for (int j = 0; j < N; ++j) {
+          c(e, i, j) = m[i][N + j];
+        }
+      }
+    });
+  });
+}
+
+template <int N, typename MatView>
+void init(MatView a, MatView b, Index_type count)
+{
+  for (Index_type e = 0; e < count; ++e) {
+    for (int i = 0; i < N; ++i) {
+      for (int j = 0; j < N; ++j) {
+        a(e, i, j) = entry(e, i, j);
+        b(e, i, j) = entry(e + 1, i, j);
+      }
+    }
+  }
+}
+
+//! Largest deviation of a(e) * c(e) from the identity over all e.
+template <int N, typename MatView>
+double inverse_error(MatView a, MatView c, Index_type count)
+{
+  double err = 0.0;
+  for (Index_type e = 0; e < count; ++e) {
+    for (int i = 0; i < N; ++i) {
+      for (int j = 0; j < N; ++j) {
+        double acc = 0.0;
+        for (int k = 0; k < N; ++k) {
+          acc += a(e, i, k) * c(e, k, j);
+        }
+        err = std::max(err, std::abs(acc - (i == j ? 1.0 : 0.0)));
+      }
+    }
+  }
+  return err;
+}
+
+struct Times {
+  double multiply;
+  double inverse;
+  double error;
+};
+
+template <typename ExecPolicy, int N>
+Times run_permuted(std::array<RAJA::idx_t, 3> perm, Index_type count)
+{
+  std::vector<double> a(N * N * count), b(N * N * count), c(N * N * count);
+  auto layout = RAJA::make_permuted_layout({{count, N, N}}, perm);
+  using MatView = RAJA::View<double, RAJA::Layout<3, Index_type>>;
+  MatView av(a.data(), layout), bv(b.data(), layout), cv(c.data(), layout);
+  init<N>(av, bv, count);
+
+  Times t;
+  t.multiply = time_multiply<ExecPolicy, N>(av, bv, cv, count);
+  t.inverse = time_inverse<ExecPolicy, N>(av, cv, count);
+  t.error = inverse_error<N>(av, cv, count);
+  return t;
+}
+
+template <typename ExecPolicy, int N>
+Times run_interleaved(Index_type count)
+{
+  using MatView = RAJA::batched::BatchedView<double, N, N>;
+  const Index_type size = typename MatView::layout_type(count).size();
+  double* a = RAJA::aligned_allocate<double>(size);
+  double* b = RAJA::aligned_allocate<double>(size);
+  double* c = RAJA::aligned_allocate<double>(size);
+  std::fill(a, a + size, 0.0);
+  std::fill(b, b + size, 0.0);
+  MatView av(a, count), bv(b, count), cv(c, count);
+  init<N>(av, bv, count);
+
+  Times t;
+  t.multiply = best_time(
+      [=]() { RAJA::batched::multiply<ExecPolicy>(av, bv, cv); });
+  t.inverse =
+      best_time([=]() { RAJA::batched::inverse<ExecPolicy>(av, cv); });
+  t.error = inverse_error<N>(av, cv, count);
+
+  RAJA::free_aligned(a);
+  RAJA::free_aligned(b);
+  RAJA::free_aligned(c);
+  return t;
+}
+
+template <typename ExecPolicy, int N>
+void run(const char* policy_name, Index_type count)
+{
+  const Times times[] = {
+      run_permuted<ExecPolicy, N>({{0, 1, 2}}, count),
+      run_permuted<ExecPolicy, N>({{1, 2, 0}}, count),
+      run_interleaved<ExecPolicy, N>(count)};
+  const char* names[] = {"layout1", "layout2", "interleaved"};
+
+  for (int l = 0; l < 3; ++l) {
+    std::cout << std::setw(4) << N << std::setw(24) << policy_name
+              << std::setw(13) << names[l] << std::scientific
+              << std::setprecision(2) << std::setw(11) << times[l].multiply
+              << std::setw(11) << times[l].inverse << std::setw(11)
+              << times[l].error << "\n";
+  }
+}
+
+template <int N>
+void sweep(Index_type entries)
+{
+  const Index_type count = entries / (N * N);
+  run<RAJA::loop_exec, N>("loop_exec", count);
+#if defined(RAJA_ENABLE_OPENMP)
+  run<RAJA::omp_parallel_for_exec, N>("omp_parallel_for_exec", count);
+#endif
+#if defined(RAJA_ENABLE_TBB)
+  run<RAJA::tbb_for_exec, N>("tbb_for_exec", count);
+#endif
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  const Index_type entries =
+      argc > 1 ? std::atol(argv[1]) : Index_type(1) << 22;
+
+  std::cout << "RAJA batched small matrices, " << entries
+            << " entries per array\n";
+  std::cout << std::setw(4) << "N" << std::setw(24) << "policy"
+            << std::setw(13) << "layout" << std::setw(11) << "multiply"
+            << std::setw(11) << "inverse" << std::setw(11) << "inv error"
+            << "\n";
+
+  sweep<3>(entries);
+  sweep<4>(entries);
+  sweep<8>(entries);
+
+  return EXIT_SUCCESS;
+}
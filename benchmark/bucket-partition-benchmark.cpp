@@ -0,0 +1,129 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Bucket partition benchmark.
+//
+// Bins num_keys random keys (particles to cells) into a sweep of bucket
+// counts with:
+//
+//   atomic - the hand-rolled version: an atomic histogram, an exclusive
+//            scan and an atomic fetch-and-add scatter (not stable)
+//   bucket - RAJA::bucket_partition (per-thread histograms, scan over
+//            bucket and thread, stable scatter)
+//
+// for the sequential, OpenMP and TBB policies.
+//
+// Usage: benchmark-bucket-partition [num_keys]
+//
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "timing.hpp"
+
+using RAJA::Index_type;
+
+namespace
+{
+
+using bench::best_time;
+
+template <typename ExecPolicy>
+void time_atomic(std::vector<int> const& keys,
+                 Index_type nbuckets,
+                 Index_type* perm,
+                 Index_type* offsets)
+{
+  const int* k = keys.data();
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, nbuckets + 1),
+                           [=](Index_type b) { offsets[b] = 0; });
+  RAJA::forall<ExecPolicy>(
+      RAJA::RangeSegment(0, keys.size()), [=](Index_type i) {
+        RAJA::atomic::atomicAdd<RAJA::atomic::auto_atomic>(&offsets[k[i]],
+                                                           Index_type(1));
+      });
+  RAJA::exclusive_scan_inplace<ExecPolicy>(offsets, offsets + nbuckets + 1);
+  std::vector<Index_type> next(offsets, offsets + nbuckets);
+  Index_type* pos = next.data();
+  RAJA::forall<ExecPolicy>(
+      RAJA::RangeSegment(0, keys.size()), [=](Index_type i) {
+        perm[RAJA::atomic::atomicAdd<RAJA::atomic::auto_atomic>(
+            &pos[k[i]], Index_type(1))] = i;
+      });
+}
+
+template <typename ExecPolicy>
+void run(const char* policy_name, Index_type num_keys)
+{
+  std::vector<Index_type> perm(num_keys);
+  std::vector<Index_type> offsets;
+  std::vector<Index_type> ref_offsets;
+
+  for (Index_type nbuckets = 4; nbuckets <= (Index_type(1) << 20);
+       nbuckets *= 16) {
+    std::mt19937 gen(5);
+    std::uniform_int_distribution<int> dist(0, nbuckets - 1);
+    std::vector<int> keys(num_keys);
+    for (int& k : keys) {
+      k = dist(gen);
+    }
+    ref_offsets.assign(nbuckets + 1, 0);
+    offsets.assign(nbuckets + 1, 0);
+
+    const double t_atomic = best_time([&]() {
+      time_atomic<ExecPolicy>(
+          keys, nbuckets, perm.data(), ref_offsets.data());
+    });
+    const double t_bucket = best_time([&]() {
+      RAJA::bucket_partition<ExecPolicy>(
+          keys, nbuckets, perm.data(), offsets.data());
+    });
+
+    std::cout << std::setw(8) << policy_name << std::setw(10) << nbuckets
+              << std::scientific << std::setprecision(2) << std::setw(11)
+              << t_atomic << std::setw(11) << t_bucket << std::fixed
+              << std::setprecision(2) << std::setw(9) << t_atomic / t_bucket
+              << (offsets == ref_offsets ? "" : "  MISMATCH") << "\n";
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  const Index_type num_keys =
+      argc > 1 ? std::atol(argv[1]) : Index_type(1) << 23;
+
+  std::cout << "RAJA bucket partition, " << num_keys << " keys\n";
+  std::cout << std::setw(8) << "policy" << std::setw(10) << "buckets"
+            << std::setw(11) << "atomic" << std::setw(11) << "bucket"
+            << std::setw(9) << "speedup"
+            << "\n";
+
+  run<RAJA::seq_exec>("seq", num_keys);
+#if defined(RAJA_ENABLE_OPENMP)
+  run<RAJA::omp_parallel_for_exec>("omp", num_keys);
+#endif
+#if defined(RAJA_ENABLE_TBB)
+  run<RAJA::tbb_for_exec>("tbb", num_keys);
+#endif
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,55 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compile-time benchmark: forall, reductions and scans through RAJA.hpp.
+//
+// Only compiled, never run; the CTest time for benchmark-compile-time-full
+// is compared against benchmark-compile-time-precompiled, which performs
+// the same work through RAJA/precompiled.hpp.
+//
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+using exec_policy = RAJA::omp_parallel_for_exec;
+using reduce_policy = RAJA::omp_reduce;
+#else
+using exec_policy = RAJA::loop_exec;
+using reduce_policy = RAJA::seq_reduce;
+#endif
+
+double daxpy_norm(double* a, const double* b, double c, RAJA::Index_type n)
+{
+  RAJA::RangeSegment range(0, n);
+
+  RAJA::forall<exec_policy>(range,
+                            [=](RAJA::Index_type i) { a[i] += c * b[i]; });
+
+  RAJA::ReduceSum<reduce_policy, double> sum(0.0);
+  RAJA::ReduceMax<reduce_policy, double> max(0.0);
+  RAJA::forall<exec_policy>(range, [=](RAJA::Index_type i) {
+    sum += a[i] * a[i];
+    max.max(a[i]);
+  });
+
+  RAJA::inclusive_scan_inplace<exec_policy>(a, a + n);
+  RAJA::exclusive_scan_inplace<exec_policy>(a,
+                                            a + n,
+                                            RAJA::operators::maximum<double>{},
+                                            0.0);
+
+  return sum.get() / max.get();
+}
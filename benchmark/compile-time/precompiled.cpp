@@ -0,0 +1,46 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compile-time benchmark: the work of full.cpp through the precompiled
+// entry points declared in RAJA/precompiled.hpp.
+//
+
+#include "RAJA/precompiled.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+using exec_policy = RAJA::omp_parallel_for_exec;
+#else
+using exec_policy = RAJA::loop_exec;
+#endif
+
+double daxpy_norm(double* a, const double* b, double c, RAJA::Index_type n)
+{
+  RAJA::RangeSegment range(0, n);
+
+  RAJA::precompiled::forall<exec_policy>(
+      range, [=](RAJA::Index_type i) { a[i] += c * b[i]; });
+
+  double sum = RAJA::precompiled::reduce_sum<exec_policy, double>(
+      range, [=](RAJA::Index_type i) { return a[i] * a[i]; });
+  double max = RAJA::precompiled::reduce_max<exec_policy, double>(
+      range, [=](RAJA::Index_type i) { return a[i]; });
+
+  RAJA::precompiled::inclusive_scan_inplace<exec_policy>(a, a + n);
+  RAJA::precompiled::exclusive_scan_inplace<exec_policy>(
+      a, a + n, RAJA::operators::maximum<double>{}, 0.0);
+
+  return sum / max;
+}
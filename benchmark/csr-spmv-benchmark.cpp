@@ -0,0 +1,192 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// CSR sparse matrix-vector multiply benchmark.
+//
+// Computes y = A x for matrices with uniform and skewed row lengths using:
+//
+//   rows   - forall over rows with a serial inner loop over the row
+//   merge  - RAJA::csr_spmv (merge-path balanced segmented reduction)
+//
+// for the sequential, OpenMP and TBB policies. The skewed matrices put a
+// growing fraction of the nonzeros into a handful of dense rows, which is
+// where per-row partitioning loses its balance.
+//
+// Usage: benchmark-csr-spmv [num_rows]
+//
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "timing.hpp"
+
+using RAJA::Index_type;
+
+namespace
+{
+
+constexpr Index_type avg_row_length = 16;
+
+struct CsrMatrix {
+  Index_type num_rows;
+  std::vector<Index_type> offsets;
+  std::vector<Index_type> columns;
+  std::vector<double> values;
+};
+
+//
+// Build a matrix where every dense_every-th row holds dense_length nonzeros
+// and the remaining rows hold avg_row_length; dense_every == 0 gives a
+// uniform matrix.
+//
+CsrMatrix make_matrix(Index_type num_rows,
+                      Index_type dense_every,
+                      Index_type dense_length)
+{
+  CsrMatrix a;
+  a.num_rows = num_rows;
+  a.offsets.assign(num_rows + 1, 0);
+  for (Index_type i = 0; i < num_rows; ++i) {
+    const bool dense = dense_every > 0 && i % dense_every == 0;
+    a.offsets[i + 1] = a.offsets[i] + (dense ? dense_length : avg_row_length);
+  }
+
+  const Index_type nnz = a.offsets.back();
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<Index_type> col(0, num_rows - 1);
+  a.columns.resize(nnz);
+  a.values.resize(nnz);
+  for (Index_type j = 0; j < nnz; ++j) {
+    a.columns[j] = col(gen);
+    a.values[j] = 1.0 / static_cast<double>(1 + j % 13);
+  }
+  return a;
+}
+
+using bench::best_time;
+
+template <typename ExecPolicy>
+double time_rows(CsrMatrix const& a, double const* x, double* y)
+{
+  const Index_type* offsets = a.offsets.data();
+  const Index_type* columns = a.columns.data();
+  const double* values = a.values.data();
+  return best_time([=]() {
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, a.num_rows),
+                             [=](Index_type i) {
+                               double sum = 0.0;
+                               for (Index_type j = offsets[i];
+                                    j < offsets[i + 1];
+                                    ++j) {
+                                 sum += values[j] * x[columns[j]];
+                               }
+                               y[i] = sum;
+                             });
+  });
+}
+
+template <typename ExecPolicy>
+double time_merge(CsrMatrix const& a, double const* x, double* y)
+{
+  return best_time([&]() {
+    RAJA::csr_spmv<ExecPolicy>(a.num_rows,
+                               a.offsets.data(),
+                               a.columns.data(),
+                               a.values.data(),
+                               x,
+                               y);
+  });
+}
+
+template <typename ExecPolicy>
+void run(const char* policy_name,
+         const char* matrix_name,
+         CsrMatrix const& a,
+         std::vector<double> const& x)
+{
+  std::vector<double> y_rows(a.num_rows);
+  std::vector<double> y_merge(a.num_rows);
+
+  const double t_rows = time_rows<ExecPolicy>(a, x.data(), y_rows.data());
+  const double t_merge = time_merge<ExecPolicy>(a, x.data(), y_merge.data());
+
+  double max_diff = 0.0;
+  for (Index_type i = 0; i < a.num_rows; ++i) {
+    max_diff = std::max(max_diff, std::abs(y_rows[i] - y_merge[i]));
+  }
+
+  std::cout << std::setw(8) << policy_name << std::setw(10) << matrix_name
+            << std::setw(12) << a.offsets.back() << std::scientific
+            << std::setprecision(2) << std::setw(11) << t_rows
+            << std::setw(11) << t_merge << std::fixed << std::setprecision(2)
+            << std::setw(9) << t_rows / t_merge << std::scientific
+            << std::setw(11) << max_diff << "\n";
+}
+
+template <typename ExecPolicy>
+void run_all(const char* policy_name,
+             std::vector<CsrMatrix> const& matrices,
+             const char* const* matrix_names,
+             std::vector<double> const& x)
+{
+  for (size_t m = 0; m < matrices.size(); ++m) {
+    run<ExecPolicy>(policy_name, matrix_names[m], matrices[m], x);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  const Index_type num_rows =
+      argc > 1 ? std::atol(argv[1]) : Index_type(1) << 18;
+
+  std::cout << "RAJA CSR SpMV, " << num_rows << " rows\n";
+
+  const char* matrix_names[] = {"uniform", "skew-1%", "skew-50%"};
+  std::vector<CsrMatrix> matrices;
+  matrices.push_back(make_matrix(num_rows, 0, 0));
+  matrices.push_back(make_matrix(num_rows, 1024, 2 * avg_row_length * 1024));
+  matrices.push_back(
+      make_matrix(num_rows, num_rows / 4, avg_row_length * num_rows / 4));
+
+  std::vector<double> x(num_rows);
+  for (Index_type i = 0; i < num_rows; ++i) {
+    x[i] = 1.0 + static_cast<double>(i % 5);
+  }
+
+  std::cout << std::setw(8) << "policy" << std::setw(10) << "matrix"
+            << std::setw(12) << "nnz" << std::setw(11) << "rows"
+            << std::setw(11) << "merge" << std::setw(9) << "speedup"
+            << std::setw(11) << "max diff"
+            << "\n";
+
+  run_all<RAJA::seq_exec>("seq", matrices, matrix_names, x);
+#if defined(RAJA_ENABLE_OPENMP)
+  run_all<RAJA::omp_parallel_for_exec>("omp", matrices, matrix_names, x);
+#endif
+#if defined(RAJA_ENABLE_TBB)
+  run_all<RAJA::tbb_for_exec>("tbb", matrices, matrix_names, x);
+#endif
+
+  return EXIT_SUCCESS;
+}
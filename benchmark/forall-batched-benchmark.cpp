@@ -0,0 +1,167 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Batched forall benchmark.
+//
+// Runs num_batches small independent loops (one per patch), of 10 to 200
+// iterations each, y[j] = a[b] * x[j] + y[j] for every index j of batch b,
+// with:
+//
+//   forall - one RAJA::forall per batch
+//   iset   - a TypedIndexSet with one RangeSegment per batch
+//   nested - a forall over batches with a sequential loop per batch
+//   batch  - RAJA::forall_batched
+//
+// for the sequential, OpenMP and TBB policies, on uniform batch sizes and
+// on skewed ones where a few batches hold most of the work.
+//
+// Usage: benchmark-forall-batched [num_batches]
+//
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "timing.hpp"
+
+using RAJA::Index_type;
+
+namespace
+{
+
+using bench::best_time;
+
+template <typename ExecPolicy, typename SegIterPolicy>
+void run(const char* policy_name,
+         const char* sizes_name,
+         std::vector<Index_type> const& offsets)
+{
+  const Index_type num_batches = offsets.size() - 1;
+  const Index_type n = offsets.back();
+  std::vector<double> x(n, 1.0);
+  std::vector<double> y(n, 0.0);
+  std::vector<double> a(num_batches);
+  std::iota(a.begin(), a.end(), 1.0);
+  const double* xp = x.data();
+  double* yp = y.data();
+  const double* ap = a.data();
+  const Index_type* off = offsets.data();
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+  std::vector<Index_type> batch_of(n);
+  for (Index_type b = 0; b < num_batches; ++b) {
+    iset.push_back(RAJA::RangeSegment(offsets[b], offsets[b + 1]));
+    std::fill(batch_of.begin() + offsets[b],
+              batch_of.begin() + offsets[b + 1],
+              b);
+  }
+  const Index_type* bp = batch_of.data();
+
+  const double t_forall = best_time([&]() {
+    for (Index_type b = 0; b < num_batches; ++b) {
+      const double ab = ap[b];
+      RAJA::forall<ExecPolicy>(RAJA::RangeSegment(off[b], off[b + 1]),
+                               [=](Index_type j) { yp[j] += ab * xp[j]; });
+    }
+  });
+  // the index set body has no batch id: look it up per index
+  const double t_iset = best_time([&]() {
+    RAJA::forall<RAJA::ExecPolicy<SegIterPolicy, RAJA::seq_exec>>(
+        iset, [=](Index_type j) { yp[j] += ap[bp[j]] * xp[j]; });
+  });
+  const double t_nested = best_time([&]() {
+    RAJA::forall<ExecPolicy>(
+        RAJA::RangeSegment(0, num_batches), [=](Index_type b) {
+          for (Index_type j = off[b]; j < off[b + 1]; ++j) {
+            yp[j] += ap[b] * xp[j];
+          }
+        });
+  });
+  const double t_batch = best_time([&]() {
+    RAJA::forall_batched<ExecPolicy>(
+        num_batches, off, [=](Index_type b, Index_type j) {
+          yp[j] += ap[b] * xp[j];
+        });
+  });
+
+  std::cout << std::setw(8) << policy_name << std::setw(8) << sizes_name
+            << std::scientific << std::setprecision(2) << std::setw(11)
+            << t_forall << std::setw(11) << t_iset << std::setw(11)
+            << t_nested << std::setw(11) << t_batch << std::fixed
+            << std::setprecision(2) << std::setw(9)
+            << std::min(t_forall, std::min(t_iset, t_nested)) / t_batch
+            << "\n";
+}
+
+template <typename ExecPolicy, typename SegIterPolicy>
+void run_sizes(const char* policy_name,
+               std::vector<Index_type> const& uniform,
+               std::vector<Index_type> const& skewed)
+{
+  run<ExecPolicy, SegIterPolicy>(policy_name, "uniform", uniform);
+  run<ExecPolicy, SegIterPolicy>(policy_name, "skewed", skewed);
+}
+
+std::vector<Index_type> make_offsets(std::vector<Index_type> const& sizes)
+{
+  std::vector<Index_type> offsets(sizes.size() + 1, 0);
+  std::partial_sum(sizes.begin(), sizes.end(), offsets.begin() + 1);
+  return offsets;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  const Index_type num_batches =
+      argc > 1 ? std::atol(argv[1]) : Index_type(100000);
+
+  std::mt19937 gen(9);
+  std::uniform_int_distribution<Index_type> dist(10, 200);
+  std::vector<Index_type> sizes(num_batches);
+  for (Index_type& s : sizes) {
+    s = dist(gen);
+  }
+  const std::vector<Index_type> uniform = make_offsets(sizes);
+  // the first 1% of the batches are 50 times larger
+  for (Index_type b = 0; b < num_batches / 100; ++b) {
+    sizes[b] *= 50;
+  }
+  const std::vector<Index_type> skewed = make_offsets(sizes);
+
+  std::cout << "RAJA batched forall, " << num_batches << " batches\n";
+  std::cout << std::setw(8) << "policy" << std::setw(8) << "sizes"
+            << std::setw(11) << "forall" << std::setw(11) << "iset"
+            << std::setw(11) << "nested" << std::setw(11) << "batch"
+            << std::setw(9) << "speedup"
+            << "\n";
+
+  run_sizes<RAJA::seq_exec, RAJA::seq_segit>("seq", uniform, skewed);
+#if defined(RAJA_ENABLE_OPENMP)
+  run_sizes<RAJA::omp_parallel_for_exec, RAJA::omp_parallel_for_segit>(
+      "omp", uniform, skewed);
+#endif
+#if defined(RAJA_ENABLE_TBB)
+  run_sizes<RAJA::tbb_for_exec, RAJA::tbb_segit>("tbb", uniform, skewed);
+#endif
+
+  return EXIT_SUCCESS;
+}
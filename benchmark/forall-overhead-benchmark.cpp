@@ -0,0 +1,114 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Launch-overhead microbenchmarks for RAJA::forall.
+//
+// Each benchmark runs an empty (length 0) or tiny daxpy loop so that the
+// time reported is dominated by dispatch cost rather than by the loop body.
+// RAJA policies are paired with the equivalent hand-written loop so the
+// abstraction overhead can be read directly off the output.
+//
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+struct Vectors {
+  explicit Vectors(RAJA::Index_type n)
+      : a(new double[n + 1]), b(new double[n + 1])
+  {
+    for (RAJA::Index_type i = 0; i <= n; ++i) {
+      a[i] = 1.0;
+      b[i] = 2.0;
+    }
+  }
+  ~Vectors()
+  {
+    delete[] a;
+    delete[] b;
+  }
+  double* a;
+  double* b;
+};
+
+static void forall_raw_seq(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  Vectors v(n);
+  double* a = v.a;
+  double* b = v.b;
+  const double c = 3.14159;
+
+  while (state.KeepRunning()) {
+    for (RAJA::Index_type i = 0; i < n; ++i) {
+      a[i] += b[i] * c;
+    }
+    benchmark::ClobberMemory();
+  }
+}
+
+template <typename Policy>
+static void forall_raja(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  Vectors v(n);
+  double* a = v.a;
+  double* b = v.b;
+  const double c = 3.14159;
+
+  while (state.KeepRunning()) {
+    RAJA::forall<Policy>(RAJA::RangeSegment(0, n),
+                         [=](RAJA::Index_type i) { a[i] += b[i] * c; });
+    benchmark::ClobberMemory();
+  }
+}
+
+#define FORALL_OVERHEAD_ARGS Arg(0)->Arg(1)->Arg(8)->Arg(64)->Arg(512)
+
+BENCHMARK(forall_raw_seq)->FORALL_OVERHEAD_ARGS;
+BENCHMARK_TEMPLATE(forall_raja, RAJA::seq_exec)->FORALL_OVERHEAD_ARGS;
+BENCHMARK_TEMPLATE(forall_raja, RAJA::loop_exec)->FORALL_OVERHEAD_ARGS;
+BENCHMARK_TEMPLATE(forall_raja, RAJA::simd_exec)->FORALL_OVERHEAD_ARGS;
+
+#if defined(RAJA_ENABLE_OPENMP)
+static void forall_raw_omp(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  Vectors v(n);
+  double* a = v.a;
+  double* b = v.b;
+  const double c = 3.14159;
+
+  while (state.KeepRunning()) {
+#pragma omp parallel for
+    for (RAJA::Index_type i = 0; i < n; ++i) {
+      a[i] += b[i] * c;
+    }
+    benchmark::ClobberMemory();
+  }
+}
+
+BENCHMARK(forall_raw_omp)->FORALL_OVERHEAD_ARGS;
+BENCHMARK_TEMPLATE(forall_raja, RAJA::omp_parallel_for_exec)
+    ->FORALL_OVERHEAD_ARGS;
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(forall_raja, RAJA::tbb_for_exec)->FORALL_OVERHEAD_ARGS;
+BENCHMARK_TEMPLATE(forall_raja, RAJA::tbb_for_dynamic)->FORALL_OVERHEAD_ARGS;
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,195 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// LTimes contraction benchmark.
+//
+// Runs phi(m, g, z) += sum_d L(m, d) * psi(d, g, z), the operator of
+// examples/ltimes.cpp, over a sweep of problem sizes and data layouts:
+//
+//   z-fast  - z stride-one in phi and psi, as in the example
+//   g-fast  - g stride-one in phi and psi
+//   d-fast  - d stride-one in L and psi, z stride-one in phi
+//
+// and compares three implementations per execution policy:
+//
+//   mdgz     - RAJA::kernel with the example's fixed loop order m, d, g, z
+//              (m parallel, z innermost)
+//   mgzd     - RAJA::kernel with loop order m, g, z, d (d innermost)
+//   contract - RAJA::contraction::contract, loop order and tiling chosen
+//              from the layouts; the chosen order and tile size are shown
+//
+// Each entry is the best of bench::default_reps runs.
+//
+// Usage: benchmark-ltimes-contraction [cache_bytes]
+//
+
+#include <array>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "timing.hpp"
+
+using RAJA::Index_type;
+
+namespace
+{
+
+using bench::best_time;
+
+struct Config {
+  Index_type num_m;
+  Index_type num_g;
+  Index_type num_d;
+  Index_type num_z;
+};
+
+struct Perms {
+  const char* name;
+  std::array<RAJA::idx_t, 2> L;
+  std::array<RAJA::idx_t, 3> psi;
+  std::array<RAJA::idx_t, 3> phi;
+};
+
+using View2 = RAJA::View<double, RAJA::Layout<2, Index_type>>;
+using View3 = RAJA::View<double, RAJA::Layout<3, Index_type>>;
+
+std::string describe(RAJA::contraction::Plan const& plan)
+{
+  std::string s(plan.label, plan.label + plan.num_loops);
+  if (plan.tile_loop >= 0) {
+    s += " tile " + std::string(1, plan.label[plan.tile_loop]) + " "
+         + std::to_string(plan.tile);
+  }
+  return s;
+}
+
+template <typename ExecPolicy>
+void run(const char* policy_name,
+         Config const& cfg,
+         Perms const& perms,
+         size_t cache_bytes)
+{
+  using namespace RAJA::statement;
+  using MDGZ = RAJA::KernelPolicy<
+      For<0,
+          ExecPolicy,
+          For<1, RAJA::loop_exec, For<2, RAJA::loop_exec,
+              For<3, RAJA::simd_exec, Lambda<0>>>>>>;
+  using MGZD = RAJA::KernelPolicy<
+      For<0,
+          ExecPolicy,
+          For<2, RAJA::loop_exec, For<3, RAJA::loop_exec,
+              For<1, RAJA::loop_exec, Lambda<0>>>>>>;
+
+  std::vector<double> L_data(cfg.num_m * cfg.num_d);
+  std::vector<double> psi_data(cfg.num_d * cfg.num_g * cfg.num_z);
+  std::vector<double> phi_data(cfg.num_m * cfg.num_g * cfg.num_z);
+  for (size_t i = 0; i < L_data.size(); ++i) {
+    L_data[i] = static_cast<double>(i % 7);
+  }
+  for (size_t i = 0; i < psi_data.size(); ++i) {
+    psi_data[i] = static_cast<double>(i % 11);
+  }
+
+  View2 L(L_data.data(),
+          RAJA::make_permuted_layout({{cfg.num_m, cfg.num_d}}, perms.L));
+  View3 psi(psi_data.data(),
+            RAJA::make_permuted_layout({{cfg.num_d, cfg.num_g, cfg.num_z}},
+                                       perms.psi));
+  View3 phi(phi_data.data(),
+            RAJA::make_permuted_layout({{cfg.num_m, cfg.num_g, cfg.num_z}},
+                                       perms.phi));
+
+  auto segments =
+      RAJA::make_tuple(RAJA::TypedRangeSegment<Index_type>(0, cfg.num_m),
+                       RAJA::TypedRangeSegment<Index_type>(0, cfg.num_d),
+                       RAJA::TypedRangeSegment<Index_type>(0, cfg.num_g),
+                       RAJA::TypedRangeSegment<Index_type>(0, cfg.num_z));
+  auto body = [=](Index_type m, Index_type d, Index_type g, Index_type z) {
+    phi(m, g, z) += L(m, d) * psi(d, g, z);
+  };
+
+  using namespace RAJA::contraction;
+  const double t_mdgz =
+      best_time([&]() { RAJA::kernel<MDGZ>(segments, body); });
+  const double t_mgzd =
+      best_time([&]() { RAJA::kernel<MGZD>(segments, body); });
+  const double t_contract = best_time([&]() {
+    contract<ExecPolicy>(phi,
+                         labels<'m', 'g', 'z'>(),
+                         L,
+                         labels<'m', 'd'>(),
+                         psi,
+                         labels<'d', 'g', 'z'>(),
+                         cache_bytes);
+  });
+  const Plan plan = make_plan(phi,
+                              labels<'m', 'g', 'z'>(),
+                              L,
+                              labels<'m', 'd'>(),
+                              psi,
+                              labels<'d', 'g', 'z'>(),
+                              cache_bytes);
+
+  std::cout << std::setw(4) << cfg.num_m << std::setw(4) << cfg.num_g
+            << std::setw(4) << cfg.num_d << std::setw(7) << cfg.num_z
+            << std::setw(8) << perms.name << std::setw(24) << policy_name
+            << std::scientific << std::setprecision(2) << std::setw(11)
+            << t_mdgz << std::setw(11) << t_mgzd << std::setw(11)
+            << t_contract << "  " << describe(plan) << "\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  const size_t cache_bytes =
+      argc > 1 ? static_cast<size_t>(std::atol(argv[1]))
+               : RAJA::contraction::default_cache_bytes;
+
+  const Config configs[] = {
+      {25, 48, 80, 1024}, {16, 32, 16, 8192}, {64, 16, 64, 512}};
+  const Perms perms[] = {{"z-fast", {{0, 1}}, {{0, 1, 2}}, {{0, 1, 2}}},
+                         {"g-fast", {{0, 1}}, {{0, 2, 1}}, {{0, 2, 1}}},
+                         {"d-fast", {{0, 1}}, {{1, 2, 0}}, {{0, 1, 2}}}};
+
+  std::cout << "RAJA LTimes contraction, cache budget " << cache_bytes
+            << " bytes\n";
+  std::cout << std::setw(4) << "m" << std::setw(4) << "g" << std::setw(4)
+            << "d" << std::setw(7) << "z" << std::setw(8) << "layout"
+            << std::setw(24) << "policy" << std::setw(11) << "mdgz"
+            << std::setw(11) << "mgzd" << std::setw(11) << "contract"
+            << "  plan\n";
+
+  for (Config const& cfg : configs) {
+    for (Perms const& p : perms) {
+      run<RAJA::loop_exec>("loop_exec", cfg, p, cache_bytes);
+#if defined(RAJA_ENABLE_OPENMP)
+      run<RAJA::omp_parallel_for_exec>(
+          "omp_parallel_for_exec", cfg, p, cache_bytes);
+#endif
+#if defined(RAJA_ENABLE_TBB)
+      run<RAJA::tbb_for_exec>("tbb_for_exec", cfg, p, cache_bytes);
+#endif
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,159 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Merge and set operation benchmark.
+//
+// Merges and differences two sorted index arrays, as when building halo
+// lists, with std::merge / std::set_union / std::set_intersection /
+// std::set_difference and with the merge-path partitioned RAJA versions
+// for the sequential, OpenMP and TBB policies. Also times building the
+// result directly as a RAJA::ListSegment.
+//
+// Usage: benchmark-merge [num_indices]
+//
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "timing.hpp"
+
+using RAJA::Index_type;
+
+namespace
+{
+
+using bench::best_time;
+
+//! n distinct sorted indices drawn from [0, 2n).
+std::vector<Index_type> make_indices(Index_type n, unsigned seed)
+{
+  std::mt19937 gen(seed);
+  std::vector<Index_type> v;
+  v.reserve(n);
+  for (Index_type i = 0; i < 2 * n && static_cast<Index_type>(v.size()) < n;
+       ++i) {
+    if (gen() % 2 == 0) v.push_back(i);
+  }
+  return v;
+}
+
+void print_row(const char* policy_name,
+               const char* op_name,
+               double t_std,
+               double t_raja,
+               double t_segment,
+               bool match)
+{
+  std::cout << std::setw(8) << policy_name << std::setw(14) << op_name
+            << std::scientific << std::setprecision(2) << std::setw(11)
+            << t_std << std::setw(11) << t_raja << std::setw(11)
+            << t_segment << std::fixed << std::setprecision(2)
+            << std::setw(9) << t_std / t_raja << (match ? "" : "  MISMATCH")
+            << "\n";
+}
+
+template <typename ExecPolicy>
+void run(const char* policy_name,
+         std::vector<Index_type> const& a,
+         std::vector<Index_type> const& b)
+{
+  const Index_type* a0 = a.data();
+  const Index_type* a1 = a0 + a.size();
+  const Index_type* b0 = b.data();
+  const Index_type* b1 = b0 + b.size();
+  std::vector<Index_type> ref(a.size() + b.size());
+  std::vector<Index_type> out(a.size() + b.size());
+  Index_type* r = ref.data();
+  Index_type* o = out.data();
+  Index_type num_ref = 0;
+  Index_type num = 0;
+
+  double t_std = best_time([&]() { std::merge(a0, a1, b0, b1, r); });
+  double t_raja =
+      best_time([&]() { RAJA::merge<ExecPolicy>(a0, a1, b0, b1, o); });
+  double t_seg = best_time([&]() { RAJA::merge<ExecPolicy>(a, b); });
+  print_row(policy_name, "merge", t_std, t_raja, t_seg, ref == out);
+
+  t_std = best_time(
+      [&]() { num_ref = std::set_union(a0, a1, b0, b1, r) - r; });
+  t_raja = best_time(
+      [&]() { num = RAJA::set_union<ExecPolicy>(a0, a1, b0, b1, o); });
+  t_seg = best_time([&]() { RAJA::set_union<ExecPolicy>(a, b); });
+  print_row(policy_name,
+            "union",
+            t_std,
+            t_raja,
+            t_seg,
+            num == num_ref && std::equal(r, r + num, o));
+
+  t_std = best_time(
+      [&]() { num_ref = std::set_intersection(a0, a1, b0, b1, r) - r; });
+  t_raja = best_time([&]() {
+    num = RAJA::set_intersection<ExecPolicy>(a0, a1, b0, b1, o);
+  });
+  t_seg = best_time([&]() { RAJA::set_intersection<ExecPolicy>(a, b); });
+  print_row(policy_name,
+            "intersection",
+            t_std,
+            t_raja,
+            t_seg,
+            num == num_ref && std::equal(r, r + num, o));
+
+  t_std = best_time(
+      [&]() { num_ref = std::set_difference(a0, a1, b0, b1, r) - r; });
+  t_raja = best_time(
+      [&]() { num = RAJA::set_difference<ExecPolicy>(a0, a1, b0, b1, o); });
+  t_seg = best_time([&]() { RAJA::set_difference<ExecPolicy>(a, b); });
+  print_row(policy_name,
+            "difference",
+            t_std,
+            t_raja,
+            t_seg,
+            num == num_ref && std::equal(r, r + num, o));
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  const Index_type n = argc > 1 ? std::atol(argv[1]) : Index_type(1) << 23;
+
+  std::cout << "RAJA merge and set operations, " << n
+            << " indices per input\n";
+
+  auto a = make_indices(n, 1);
+  auto b = make_indices(n, 2);
+
+  std::cout << std::setw(8) << "policy" << std::setw(14) << "operation"
+            << std::setw(11) << "std" << std::setw(11) << "raja"
+            << std::setw(11) << "segment" << std::setw(9) << "speedup"
+            << "\n";
+
+  run<RAJA::seq_exec>("seq", a, b);
+#if defined(RAJA_ENABLE_OPENMP)
+  run<RAJA::omp_parallel_for_exec>("omp", a, b);
+#endif
+#if defined(RAJA_ENABLE_TBB)
+  run<RAJA::tbb_for_exec>("tbb", a, b);
+#endif
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,163 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// OpenMP schedule benchmark.
+//
+// Runs an irregular loop, a CSR row-sum y[r] = sum of a[j] over the
+// nonzeros of row r, with row lengths drawn from a heavy-tailed
+// distribution and the long rows clustered at the start, under:
+//
+//   static     - RAJA::omp_parallel_for_exec
+//   dynamic    - RAJA::omp_parallel_for_dynamic<16>
+//   nonmono    - RAJA::omp_parallel_for_schedule_exec<
+//                    Nonmonotonic<Dynamic<16>>>
+//   guided     - RAJA::omp_parallel_for_guided<4>
+//
+// and then sweeps the chunk size of RAJA::omp_parallel_for_runtime with
+// omp_set_schedule for the dynamic and guided kinds.
+//
+// Usage: benchmark-omp-schedule [num_rows]
+//
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <omp.h>
+
+#include "RAJA/RAJA.hpp"
+#include "timing.hpp"
+
+using RAJA::Index_type;
+
+namespace
+{
+
+using bench::best_time;
+
+struct Rows {
+  std::vector<Index_type> offsets;
+  std::vector<double> values;
+  std::vector<double> sums;
+};
+
+template <typename ExecPolicy>
+double time_rows(Rows& rows)
+{
+  const Index_type* off = rows.offsets.data();
+  const double* a = rows.values.data();
+  double* y = rows.sums.data();
+  const Index_type num_rows = rows.sums.size();
+  return best_time([=]() {
+    RAJA::forall<ExecPolicy>(
+        RAJA::RangeSegment(0, num_rows), [=](Index_type r) {
+          double sum = 0.0;
+          for (Index_type j = off[r]; j < off[r + 1]; ++j) {
+            sum += a[j];
+          }
+          y[r] = sum;
+        });
+  });
+}
+
+void print_row(const char* name, int chunk, double t, double t_static)
+{
+  std::cout << std::setw(10) << name << std::setw(7);
+  if (chunk > 0) {
+    std::cout << chunk;
+  } else {
+    std::cout << "-";
+  }
+  std::cout << std::scientific << std::setprecision(2) << std::setw(11) << t
+            << std::fixed << std::setprecision(2) << std::setw(9)
+            << t_static / t << "\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  using RAJA::policy::omp::Dynamic;
+  using RAJA::policy::omp::Nonmonotonic;
+
+  const Index_type num_rows =
+      argc > 1 ? std::atol(argv[1]) : Index_type(1) << 18;
+
+  // Pareto-distributed row lengths, sorted so the long rows come first
+  Rows rows;
+  std::mt19937 gen(21);
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+  std::vector<Index_type> lengths(num_rows);
+  for (Index_type& len : lengths) {
+    len = static_cast<Index_type>(4.0 / std::pow(1.0 - dist(gen), 0.9));
+    len = std::min(len, Index_type(1) << 16);
+  }
+  std::sort(lengths.rbegin(), lengths.rend());
+  rows.offsets.assign(num_rows + 1, 0);
+  for (Index_type r = 0; r < num_rows; ++r) {
+    rows.offsets[r + 1] = rows.offsets[r] + lengths[r];
+  }
+  rows.values.assign(rows.offsets.back(), 1.0);
+  rows.sums.assign(num_rows, 0.0);
+
+  std::cout << "RAJA OpenMP schedules, " << num_rows << " rows, "
+            << rows.offsets.back() << " nonzeros, "
+            << omp_get_max_threads() << " threads\n";
+  std::cout << std::setw(10) << "schedule" << std::setw(7) << "chunk"
+            << std::setw(11) << "time" << std::setw(9) << "speedup"
+            << "\n";
+
+  const double t_static = time_rows<RAJA::omp_parallel_for_exec>(rows);
+  print_row("static", 0, t_static, t_static);
+  print_row("dynamic",
+            16,
+            time_rows<RAJA::omp_parallel_for_dynamic<16>>(rows),
+            t_static);
+  print_row("nonmono",
+            16,
+            time_rows<RAJA::omp_parallel_for_schedule_exec<
+                Nonmonotonic<Dynamic<16>>>>(rows),
+            t_static);
+  print_row("guided",
+            4,
+            time_rows<RAJA::omp_parallel_for_guided<4>>(rows),
+            t_static);
+
+  omp_sched_t kind;
+  int chunk;
+  omp_get_schedule(&kind, &chunk);
+  for (int c = 1; c <= 1024; c *= 4) {
+    omp_set_schedule(omp_sched_dynamic, c);
+    print_row("rt-dynamic",
+              c,
+              time_rows<RAJA::omp_parallel_for_runtime>(rows),
+              t_static);
+  }
+  for (int c = 1; c <= 1024; c *= 4) {
+    omp_set_schedule(omp_sched_guided, c);
+    print_row("rt-guided",
+              c,
+              time_rows<RAJA::omp_parallel_for_runtime>(rows),
+              t_static);
+  }
+  omp_set_schedule(kind, chunk);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,154 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Run-length algorithm benchmark.
+//
+// Compresses a sorted material-ID array and sums a value per material with:
+//
+//   serial - a hand-written serial loop (run after the RAJA loops today)
+//   unique - RAJA::unique
+//   rle    - RAJA::run_length_encode
+//   rbk    - RAJA::reduce_by_key with operators::plus
+//
+// for the sequential, OpenMP and TBB policies and a range of average run
+// lengths. Speedup is serial over reduce_by_key.
+//
+// Usage: benchmark-run-length [num_items]
+//
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "timing.hpp"
+
+using RAJA::Index_type;
+
+namespace
+{
+
+using bench::best_time;
+
+//! Sorted IDs with run lengths drawn uniformly from [1, 2 * avg_run - 1].
+std::vector<int> make_ids(Index_type n, Index_type avg_run)
+{
+  std::mt19937 gen(11);
+  std::uniform_int_distribution<Index_type> len(1, 2 * avg_run - 1);
+  std::vector<int> ids(n);
+  int id = 0;
+  for (Index_type i = 0; i < n; ++id) {
+    const Index_type end = std::min(n, i + len(gen));
+    for (; i < end; ++i) {
+      ids[i] = id;
+    }
+  }
+  return ids;
+}
+
+Index_type serial_reduce_by_key(const int* ids,
+                                const double* values,
+                                Index_type n,
+                                int* ids_out,
+                                double* sums)
+{
+  Index_type r = -1;
+  for (Index_type i = 0; i < n; ++i) {
+    if (i == 0 || ids[i - 1] != ids[i]) {
+      ids_out[++r] = ids[i];
+      sums[r] = values[i];
+    } else {
+      sums[r] += values[i];
+    }
+  }
+  return r + 1;
+}
+
+template <typename ExecPolicy>
+void run(const char* policy_name,
+         Index_type avg_run,
+         std::vector<int> const& ids,
+         std::vector<double> const& values)
+{
+  const Index_type n = ids.size();
+  const int* in = ids.data();
+  const double* v = values.data();
+  std::vector<int> ids_out(n);
+  std::vector<Index_type> counts(n);
+  std::vector<double> sums(n);
+  int* ko = ids_out.data();
+  Index_type* co = counts.data();
+  double* so = sums.data();
+
+  Index_type num_serial = 0;
+  Index_type num_rbk = 0;
+  const double t_serial = best_time(
+      [&]() { num_serial = serial_reduce_by_key(in, v, n, ko, so); });
+  const double t_unique =
+      best_time([&]() { RAJA::unique<ExecPolicy>(in, in + n, ko); });
+  const double t_rle = best_time(
+      [&]() { RAJA::run_length_encode<ExecPolicy>(in, in + n, ko, co); });
+  const double t_rbk = best_time([&]() {
+    num_rbk = RAJA::reduce_by_key<ExecPolicy>(in, in + n, v, ko, so);
+  });
+
+  std::cout << std::setw(8) << policy_name << std::setw(9) << avg_run
+            << std::setw(10) << num_rbk << std::scientific
+            << std::setprecision(2) << std::setw(11) << t_serial
+            << std::setw(11) << t_unique << std::setw(11) << t_rle
+            << std::setw(11) << t_rbk << std::fixed << std::setprecision(2)
+            << std::setw(9) << t_serial / t_rbk
+            << (num_rbk == num_serial ? "" : "  MISMATCH") << "\n";
+}
+
+template <typename ExecPolicy>
+void run_all(const char* policy_name, Index_type n)
+{
+  std::vector<double> values(n);
+  for (Index_type i = 0; i < n; ++i) {
+    values[i] = static_cast<double>(i % 7) * 0.25;
+  }
+  for (Index_type avg_run : {2, 16, 256, 65536}) {
+    run<ExecPolicy>(policy_name, avg_run, make_ids(n, avg_run), values);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  const Index_type n = argc > 1 ? std::atol(argv[1]) : Index_type(1) << 24;
+
+  std::cout << "RAJA run-length algorithms, " << n << " items\n";
+  std::cout << std::setw(8) << "policy" << std::setw(9) << "avg run"
+            << std::setw(10) << "runs" << std::setw(11) << "serial"
+            << std::setw(11) << "unique" << std::setw(11) << "rle"
+            << std::setw(11) << "rbk" << std::setw(9) << "speedup"
+            << "\n";
+
+  run_all<RAJA::seq_exec>("seq", n);
+#if defined(RAJA_ENABLE_OPENMP)
+  run_all<RAJA::omp_parallel_for_exec>("omp", n);
+#endif
+#if defined(RAJA_ENABLE_TBB)
+  run_all<RAJA::tbb_for_exec>("tbb", n);
+#endif
+
+  return EXIT_SUCCESS;
+}
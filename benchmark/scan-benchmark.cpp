@@ -0,0 +1,159 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Scan throughput benchmark.
+//
+// Times RAJA::inclusive_scan_inplace with operators::plus, minimum and
+// maximum over int, unsigned, Index_type, float and double for the
+// sequential, loop, OpenMP and TBB policies, next to a scalar loop with one
+// dependent operation per element (the sequential scan without its
+// vectorized kernel). Reports nanoseconds per element and the speedup of
+// each policy over the scalar loop, for an array that fits in cache and one
+// that does not.
+//
+// The vectorized kernels are only compiled in for AVX2 or AVX-512 targets
+// (e.g. -march=native); otherwise every policy runs its scalar loop.
+//
+// Usage: benchmark-scan [num_elements]
+//
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "timing.hpp"
+
+using RAJA::Index_type;
+
+namespace
+{
+
+constexpr int num_reps = 7;
+constexpr Index_type cache_elements = Index_type(1) << 13;
+
+using bench::best_time;
+
+template <typename T, typename Op>
+void scalar_inclusive(T* data, Index_type n, Op op)
+{
+  T agg = data[0];
+  RAJA_NO_SIMD
+  for (Index_type i = 1; i < n; ++i) {
+    agg = op(data[i], agg);
+    data[i] = agg;
+  }
+}
+
+//
+// Seconds per scan of n elements, averaged over enough repeats that small
+// arrays take about as long as large ones.
+//
+template <typename Scan>
+double time_scan(Index_type n, Scan&& scan)
+{
+  const int repeats = static_cast<int>(
+      std::max(Index_type(1), (Index_type(1) << 22) / n));
+  return best_time<num_reps>([&]() {
+           for (int r = 0; r < repeats; ++r) {
+             scan();
+           }
+         })
+         / repeats;
+}
+
+template <typename Pol, typename T, typename Op>
+double time_policy(std::vector<T>& data, Op op)
+{
+  T* d = data.data();
+  const Index_type n = static_cast<Index_type>(data.size());
+  return time_scan(
+      n, [=]() { RAJA::inclusive_scan_inplace<Pol>(d, d + n, op); });
+}
+
+void print_column(double t, double t_scalar, Index_type n)
+{
+  std::cout << std::fixed << std::setprecision(2) << std::setw(8)
+            << 1.0e9 * t / n << std::setw(7) << t_scalar / t << "x";
+}
+
+template <typename T, typename Op>
+void run(const char* type_name, const char* op_name, Index_type n)
+{
+  // small values keep sums of integers and floats exact
+  std::vector<T> data(n);
+  for (Index_type i = 0; i < n; ++i) {
+    data[i] = static_cast<T>(i % 3);
+  }
+
+  const double t_scalar = time_scan(
+      n, [&]() { scalar_inclusive(data.data(), n, Op{}); });
+
+  std::cout << std::setw(12) << type_name << std::setw(9) << op_name
+            << std::setw(10) << n << std::fixed << std::setprecision(2)
+            << std::setw(8) << 1.0e9 * t_scalar / n;
+  print_column(time_policy<RAJA::seq_exec>(data, Op{}), t_scalar, n);
+  print_column(time_policy<RAJA::loop_exec>(data, Op{}), t_scalar, n);
+#if defined(RAJA_ENABLE_OPENMP)
+  print_column(time_policy<RAJA::omp_parallel_for_exec>(data, Op{}),
+               t_scalar,
+               n);
+#endif
+#if defined(RAJA_ENABLE_TBB)
+  print_column(time_policy<RAJA::tbb_for_exec>(data, Op{}), t_scalar, n);
+#endif
+  std::cout << "\n";
+}
+
+template <typename T>
+void run_type(const char* type_name, Index_type n)
+{
+  for (Index_type size : {cache_elements, n}) {
+    run<T, RAJA::operators::plus<T>>(type_name, "plus", size);
+    run<T, RAJA::operators::minimum<T>>(type_name, "minimum", size);
+    run<T, RAJA::operators::maximum<T>>(type_name, "maximum", size);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  const Index_type n = argc > 1 ? std::atol(argv[1]) : Index_type(1) << 24;
+
+  std::cout << "RAJA inclusive scan, ns per element and speedup over the "
+               "scalar loop\n";
+  std::cout << std::setw(12) << "type" << std::setw(9) << "op"
+            << std::setw(10) << "n" << std::setw(8) << "scalar"
+            << std::setw(16) << "seq" << std::setw(16) << "loop"
+#if defined(RAJA_ENABLE_OPENMP)
+            << std::setw(16) << "omp"
+#endif
+#if defined(RAJA_ENABLE_TBB)
+            << std::setw(16) << "tbb"
+#endif
+            << "\n";
+
+  run_type<int>("int", n);
+  run_type<unsigned>("unsigned", n);
+  run_type<Index_type>("Index_type", n);
+  run_type<float>("float", n);
+  run_type<double>("double", n);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,142 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Selection benchmark.
+//
+// Finds the median and the k largest values (with their indices) of
+// num_values random doubles, the way time-step control and refinement
+// flagging use them, with:
+//
+//   sort   - what callers did before: sort a copy of the values (or of
+//            their indices, for top k) and read off the answer
+//   select - RAJA::nth_element on a copy, or RAJA::top_k
+//
+// for the sequential, OpenMP and TBB policies and a sweep of k that covers
+// both the per-thread heap and the sample selection paths of top_k.
+//
+// Usage: benchmark-select [num_values]
+//
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "timing.hpp"
+
+using RAJA::Index_type;
+
+namespace
+{
+
+constexpr int num_reps = 3;
+
+using bench::best_time;
+
+void print_row(const char* policy_name,
+               const char* query,
+               Index_type k,
+               double t_sort,
+               double t_select,
+               bool match)
+{
+  std::cout << std::setw(8) << policy_name << std::setw(8) << query
+            << std::setw(9) << k << std::scientific << std::setprecision(2)
+            << std::setw(11) << t_sort << std::setw(11) << t_select
+            << std::fixed << std::setprecision(2) << std::setw(9)
+            << t_sort / t_select << (match ? "" : "  MISMATCH") << "\n";
+}
+
+template <typename ExecPolicy>
+void run(const char* policy_name, std::vector<double> const& values)
+{
+  const Index_type n = values.size();
+  std::vector<double> copy(n);
+
+  double sort_median = 0.0;
+  const double t_sort = best_time<num_reps>([&]() {
+    copy = values;
+    std::sort(copy.begin(), copy.end());
+    sort_median = copy[n / 2];
+  });
+  double median = 0.0;
+  const double t_select = best_time<num_reps>([&]() {
+    copy = values;
+    RAJA::nth_element<ExecPolicy>(
+        copy.begin(), copy.begin() + n / 2, copy.end());
+    median = copy[n / 2];
+  });
+  print_row(
+      policy_name, "median", 1, t_sort, t_select, median == sort_median);
+
+  // sorting the indices costs the same for every k
+  std::vector<Index_type> order(n);
+  const double t_sort_k = best_time<num_reps>([&]() {
+    std::iota(order.begin(), order.end(), Index_type(0));
+    std::stable_sort(
+        order.begin(), order.end(), [&](Index_type a, Index_type b) {
+          return values[a] > values[b];
+        });
+  });
+  for (Index_type k : {Index_type(16), Index_type(1024), n / 100}) {
+    std::vector<double> top(k);
+    std::vector<Index_type> idx(k);
+    const double t_top_k = best_time<num_reps>([&]() {
+      RAJA::top_k<ExecPolicy>(values, k, top.data(), idx.data());
+    });
+    print_row(policy_name,
+              "top k",
+              k,
+              t_sort_k,
+              t_top_k,
+              std::equal(idx.begin(), idx.end(), order.begin()));
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  const Index_type num_values =
+      argc > 1 ? std::atol(argv[1]) : Index_type(1) << 23;
+
+  std::mt19937 gen(3);
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+  std::vector<double> values(num_values);
+  for (double& v : values) {
+    v = dist(gen);
+  }
+
+  std::cout << "RAJA selection, " << num_values << " values\n";
+  std::cout << std::setw(8) << "policy" << std::setw(8) << "query"
+            << std::setw(9) << "k" << std::setw(11) << "sort" << std::setw(11)
+            << "select" << std::setw(9) << "speedup"
+            << "\n";
+
+  run<RAJA::seq_exec>("seq", values);
+#if defined(RAJA_ENABLE_OPENMP)
+  run<RAJA::omp_parallel_for_exec>("omp", values);
+#endif
+#if defined(RAJA_ENABLE_TBB)
+  run<RAJA::tbb_for_exec>("tbb", values);
+#endif
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,296 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Structured-grid stencil benchmark.
+//
+// Times one sweep of
+//
+//   lap2d  - 5-point Laplacian on an n x n grid with a one-point halo
+//   lap3d  - 7-point Laplacian on an m x m x m grid with a one-point halo
+//   rbgs   - in-place red-black Gauss-Seidel sweep of the 5-point operator
+//
+// written as
+//
+//   kernel   - RAJA::kernel over the grid with the stencil in the lambda,
+//              as in examples/jacobi.cpp (for rbgs: forall over a
+//              red/black ListSegment IndexSet as in
+//              examples/red-black-gauss-seidel.cpp)
+//   point    - RAJA::stencil::apply / apply_red_black with the same lambda
+//   weights  - RAJA::stencil::apply with star weights (lap2d, lap3d)
+//
+// for the sequential, OpenMP and TBB policies.
+//
+// Usage: benchmark-stencil [n] [m]
+//
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "timing.hpp"
+
+using RAJA::Index_type;
+
+namespace
+{
+
+using bench::best_time;
+
+double max_diff(std::vector<double> const& a, std::vector<double> const& b)
+{
+  double d = 0.0;
+  for (size_t i = 0; i < a.size(); ++i) {
+    d = std::max(d, std::abs(a[i] - b[i]));
+  }
+  return d;
+}
+
+void print_row(const char* policy,
+               const char* name,
+               double t_kernel,
+               double t_point,
+               double t_weights,
+               double diff)
+{
+  const double none = std::numeric_limits<double>::max();
+  std::cout << std::setw(8) << policy << std::setw(8) << name
+            << std::scientific << std::setprecision(2) << std::setw(11)
+            << t_kernel << std::setw(11) << t_point << std::setw(11);
+  if (t_weights < none) {
+    std::cout << t_weights;
+  } else {
+    std::cout << "-";
+  }
+  const double best = std::min(t_point, t_weights);
+  std::cout << std::fixed << std::setprecision(2) << std::setw(9)
+            << t_kernel / best << std::scientific << std::setw(11) << diff
+            << "\n";
+}
+
+template <typename ForPolicy, typename ExecPolicy>
+void lap2d(const char* policy, Index_type n)
+{
+  using KernelPol = RAJA::KernelPolicy<RAJA::statement::For<
+      0,
+      ForPolicy,
+      RAJA::statement::For<1, RAJA::loop_exec, RAJA::statement::Lambda<0>>>>;
+
+  std::vector<double> u((n + 2) * (n + 2));
+  for (size_t i = 0; i < u.size(); ++i) {
+    u[i] = static_cast<double>(i % 97);
+  }
+  std::vector<double> r_kernel(n * n), r_point(n * n), r_weights(n * n);
+
+  const double* pu = u.data();
+  const Index_type w = n + 2;
+  auto point = [=](double* out, Index_type j, Index_type i) {
+    const Index_type id = (j + 1) * w + i + 1;
+    out[j * n + i] =
+        pu[id - 1] + pu[id + 1] + pu[id - w] + pu[id + w] - 4.0 * pu[id];
+  };
+
+  double* rk = r_kernel.data();
+  const double t_kernel = best_time([=]() {
+    RAJA::kernel<KernelPol>(RAJA::make_tuple(RAJA::RangeSegment(0, n),
+                                             RAJA::RangeSegment(0, n)),
+                            [=](Index_type j, Index_type i) {
+                              point(rk, j, i);
+                            });
+  });
+
+  double* rp = r_point.data();
+  const double t_point = best_time([=]() {
+    RAJA::stencil::apply<ExecPolicy>(RAJA::stencil::make_box<2>({0, 0},
+                                                                {n, n}),
+                                     [=](Index_type j, Index_type i) {
+                                       point(rp, j, i);
+                                     });
+  });
+
+  RAJA::View<const double, RAJA::OffsetLayout<2>> in(
+      pu, RAJA::make_offset_layout<2>({-1, -1}, {n, n}));
+  RAJA::View<double, RAJA::Layout<2>> out(r_weights.data(), n, n);
+  const auto lap = RAJA::stencil::star<2>({1.0, -2.0, 1.0});
+  const double t_weights = best_time([&]() {
+    RAJA::stencil::apply<ExecPolicy>(lap,
+                                     in,
+                                     out,
+                                     RAJA::stencil::make_box<2>({0, 0},
+                                                                {n, n}));
+  });
+
+  print_row(policy,
+            "lap2d",
+            t_kernel,
+            t_point,
+            t_weights,
+            std::max(max_diff(r_kernel, r_point),
+                     max_diff(r_kernel, r_weights)));
+}
+
+template <typename ForPolicy, typename ExecPolicy>
+void lap3d(const char* policy, Index_type m)
+{
+  using KernelPol = RAJA::KernelPolicy<RAJA::statement::For<
+      0,
+      ForPolicy,
+      RAJA::statement::For<
+          1,
+          RAJA::loop_exec,
+          RAJA::statement::
+              For<2, RAJA::loop_exec, RAJA::statement::Lambda<0>>>>>;
+
+  const Index_type w = m + 2;
+  std::vector<double> u(w * w * w);
+  for (size_t i = 0; i < u.size(); ++i) {
+    u[i] = static_cast<double>(i % 89);
+  }
+  std::vector<double> r_kernel(m * m * m), r_point(m * m * m),
+      r_weights(m * m * m);
+
+  const double* pu = u.data();
+  auto point = [=](double* out, Index_type k, Index_type j, Index_type i) {
+    const Index_type id = ((k + 1) * w + j + 1) * w + i + 1;
+    out[(k * m + j) * m + i] = pu[id - 1] + pu[id + 1] + pu[id - w]
+                               + pu[id + w] + pu[id - w * w] + pu[id + w * w]
+                               - 6.0 * pu[id];
+  };
+
+  double* rk = r_kernel.data();
+  const double t_kernel = best_time([=]() {
+    RAJA::kernel<KernelPol>(RAJA::make_tuple(RAJA::RangeSegment(0, m),
+                                             RAJA::RangeSegment(0, m),
+                                             RAJA::RangeSegment(0, m)),
+                            [=](Index_type k, Index_type j, Index_type i) {
+                              point(rk, k, j, i);
+                            });
+  });
+
+  double* rp = r_point.data();
+  const double t_point = best_time([=]() {
+    RAJA::stencil::apply<ExecPolicy>(
+        RAJA::stencil::make_box<3>({0, 0, 0}, {m, m, m}),
+        [=](Index_type k, Index_type j, Index_type i) {
+          point(rp, k, j, i);
+        });
+  });
+
+  RAJA::View<const double, RAJA::OffsetLayout<3>> in(
+      pu, RAJA::make_offset_layout<3>({-1, -1, -1}, {m, m, m}));
+  RAJA::View<double, RAJA::Layout<3>> out(r_weights.data(), m, m, m);
+  const auto lap = RAJA::stencil::star<3>({1.0, -2.0, 1.0});
+  const double t_weights = best_time([&]() {
+    RAJA::stencil::apply<ExecPolicy>(
+        lap, in, out, RAJA::stencil::make_box<3>({0, 0, 0}, {m, m, m}));
+  });
+
+  print_row(policy,
+            "lap3d",
+            t_kernel,
+            t_point,
+            t_weights,
+            std::max(max_diff(r_kernel, r_point),
+                     max_diff(r_kernel, r_weights)));
+}
+
+RAJA::TypedIndexSet<RAJA::ListSegment> red_black_set(Index_type n)
+{
+  std::vector<Index_type> red, black;
+  for (Index_type j = 1; j <= n; ++j) {
+    for (Index_type i = 1; i <= n; ++i) {
+      ((i + j) % 2 == 0 ? red : black).push_back(j * (n + 2) + i);
+    }
+  }
+  RAJA::TypedIndexSet<RAJA::ListSegment> set;
+  set.push_back(RAJA::ListSegment(red.data(), red.size()));
+  set.push_back(RAJA::ListSegment(black.data(), black.size()));
+  return set;
+}
+
+template <typename ForPolicy, typename ExecPolicy>
+void rbgs(const char* policy, Index_type n)
+{
+  const Index_type w = n + 2;
+  std::vector<double> u0(w * w);
+  for (size_t i = 0; i < u0.size(); ++i) {
+    u0[i] = static_cast<double>(i % 13);
+  }
+  std::vector<double> u_kernel = u0, u_point = u0;
+
+  auto relax = [=](double* u, Index_type id) {
+    u[id] = 0.25 * (u[id - 1] + u[id + 1] + u[id - w] + u[id + w]);
+  };
+
+  const auto set = red_black_set(n);
+  double* uk = u_kernel.data();
+  const double t_kernel = best_time([&]() {
+    RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, ForPolicy>>(
+        set, [=](Index_type id) { relax(uk, id); });
+  });
+
+  double* up = u_point.data();
+  const double t_point = best_time([=]() {
+    RAJA::stencil::apply_red_black<ExecPolicy>(
+        RAJA::stencil::make_box<2>({1, 1}, {n + 1, n + 1}),
+        [=](Index_type j, Index_type i) { relax(up, j * w + i); });
+  });
+
+  print_row(policy,
+            "rbgs",
+            t_kernel,
+            t_point,
+            std::numeric_limits<double>::max(),
+            max_diff(u_kernel, u_point));
+}
+
+template <typename ForPolicy, typename ExecPolicy>
+void run(const char* policy, Index_type n, Index_type m)
+{
+  lap2d<ForPolicy, ExecPolicy>(policy, n);
+  lap3d<ForPolicy, ExecPolicy>(policy, m);
+  rbgs<ForPolicy, ExecPolicy>(policy, n);
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  const Index_type n = argc > 1 ? std::atol(argv[1]) : 2048;
+  const Index_type m = argc > 2 ? std::atol(argv[2]) : 160;
+
+  std::cout << "RAJA stencils, 2D grid " << n << "^2, 3D grid " << m
+            << "^3\n";
+  std::cout << std::setw(8) << "policy" << std::setw(8) << "stencil"
+            << std::setw(11) << "kernel" << std::setw(11) << "point"
+            << std::setw(11) << "weights" << std::setw(9) << "speedup"
+            << std::setw(11) << "max diff"
+            << "\n";
+
+  run<RAJA::loop_exec, RAJA::seq_exec>("seq", n, m);
+#if defined(RAJA_ENABLE_OPENMP)
+  run<RAJA::omp_parallel_for_exec, RAJA::omp_parallel_for_exec>("omp", n, m);
+#endif
+#if defined(RAJA_ENABLE_TBB)
+  run<RAJA::tbb_for_exec, RAJA::tbb_for_exec>("tbb", n, m);
+#endif
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,97 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// TBB affinity benchmark.
+//
+// Repeats num_steps sweeps of a three-point smoothing stencil over the
+// same pair of arrays, as a time-stepping code does, for a range of array
+// sizes, with:
+//
+//   static   - RAJA::tbb_for_exec (tbb::static_partitioner)
+//   dynamic  - RAJA::tbb_for_dynamic (tbb::auto_partitioner)
+//   affinity - RAJA::tbb_for_affinity<> (a tbb::affinity_partitioner kept
+//              alive across the sweeps)
+//
+// Arrays that fit in the combined caches of the threads profit from
+// sweeps returning to the threads that touched the data last.
+//
+// Usage: benchmark-tbb-affinity [num_steps]
+//
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "timing.hpp"
+
+using RAJA::Index_type;
+
+namespace
+{
+
+constexpr int num_reps = 3;
+
+using bench::best_time;
+
+template <typename ExecPolicy>
+double time_sweeps(Index_type n, int num_steps)
+{
+  std::vector<double> u(n + 2, 1.0);
+  std::vector<double> v(n + 2, 1.0);
+  return best_time<num_reps>([&]() {
+    double* a = u.data();
+    double* b = v.data();
+    for (int step = 0; step < num_steps; ++step) {
+      RAJA::forall<ExecPolicy>(RAJA::RangeSegment(1, n + 1),
+                               [=](Index_type i) {
+                                 b[i] = (a[i - 1] + a[i] + a[i + 1]) / 3.0;
+                               });
+      std::swap(a, b);
+    }
+  });
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  const int num_steps = argc > 1 ? std::atoi(argv[1]) : 100;
+
+  std::cout << "RAJA TBB affinity, " << num_steps << " sweeps\n";
+  std::cout << std::setw(10) << "size" << std::setw(11) << "static"
+            << std::setw(11) << "dynamic" << std::setw(11) << "affinity"
+            << std::setw(9) << "vs dyn" << std::setw(9) << "vs stat"
+            << "\n";
+
+  for (Index_type n = Index_type(1) << 14; n <= (Index_type(1) << 24);
+       n *= 4) {
+    const double t_static = time_sweeps<RAJA::tbb_for_exec>(n, num_steps);
+    const double t_dynamic = time_sweeps<RAJA::tbb_for_dynamic>(n, num_steps);
+    const double t_affinity =
+        time_sweeps<RAJA::tbb_for_affinity<>>(n, num_steps);
+    std::cout << std::setw(10) << n << std::scientific << std::setprecision(2)
+              << std::setw(11) << t_static << std::setw(11) << t_dynamic
+              << std::setw(11) << t_affinity << std::fixed
+              << std::setprecision(2) << std::setw(9)
+              << t_dynamic / t_affinity << std::setw(9)
+              << t_static / t_affinity << "\n";
+  }
+
+  return EXIT_SUCCESS;
+}
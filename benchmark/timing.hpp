@@ -0,0 +1,57 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Timing helper shared by the RAJA benchmark programs.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_benchmark_timing_HPP
+#define RAJA_benchmark_timing_HPP
+
+#include <algorithm>
+#include <limits>
+
+#include "RAJA/util/Timer.hpp"
+
+namespace bench
+{
+
+//! Repetitions per measurement unless a benchmark asks for another count.
+constexpr int default_reps = 5;
+
+//! Smallest wall time, in seconds, of NumReps calls of kernel().
+template <int NumReps = default_reps, typename Kernel>
+double best_time(Kernel&& kernel)
+{
+  double best = std::numeric_limits<double>::max();
+  for (int rep = 0; rep < NumReps; ++rep) {
+    RAJA::Timer timer;
+    timer.start();
+    kernel();
+    timer.stop();
+    best = std::min(best, static_cast<double>(timer.elapsed()));
+  }
+  return best;
+}
+
+}  // namespace bench
+
+#endif  // closing endif for header file include guard
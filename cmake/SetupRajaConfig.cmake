@@ -69,6 +69,7 @@ set(RAJA_ENABLE_CUDA ${ENABLE_CUDA})
 set(RAJA_ENABLE_CLANG_CUDA ${ENABLE_CLANG_CUDA})
 set(RAJA_ENABLE_CHAI ${ENABLE_CHAI})
 set(RAJA_ENABLE_CUB ${ENABLE_CUB})
+set(RAJA_ENABLE_PRECOMPILED ${ENABLE_PRECOMPILED})
 
 # Configure a header file with all the variables we found.
 configure_file(${PROJECT_SOURCE_DIR}/include/RAJA/config.hpp.in
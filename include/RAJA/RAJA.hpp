@@ -108,6 +108,10 @@
 #include "RAJA/util/PermutedLayout.hpp"
 #include "RAJA/util/StaticLayout.hpp"
 #include "RAJA/util/View.hpp"
+#include "RAJA/util/ConvertView.hpp"
+#include "RAJA/util/SoAView.hpp"
+#include "RAJA/util/AlignedView.hpp"
+#include "RAJA/util/StaticView.hpp"
 
 //
 // Shared memory view patterns
@@ -150,4 +154,28 @@
 
 #include "RAJA/pattern/scan.hpp"
 
+#include "RAJA/pattern/indexed_scan.hpp"
+
+#include "RAJA/pattern/segmented_reduce.hpp"
+
+#include "RAJA/pattern/forall_batched.hpp"
+
+#include "RAJA/pattern/run_length.hpp"
+
+#include "RAJA/pattern/merge.hpp"
+
+#include "RAJA/pattern/bucket_partition.hpp"
+
+#include "RAJA/pattern/permute.hpp"
+
+#include "RAJA/pattern/select.hpp"
+
+#include "RAJA/pattern/expression.hpp"
+
+#include "RAJA/pattern/batched.hpp"
+
+#include "RAJA/pattern/contraction.hpp"
+
+#include "RAJA/pattern/stencil.hpp"
+
 #endif  // closing endif for header file include guard
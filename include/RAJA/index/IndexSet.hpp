@@ -190,7 +190,7 @@ public:
   {
     if (getSegmentTypes()[segid] == T0_TypeId) {
       Index_type offset = getSegmentOffsets()[segid];
-      return *reinterpret_cast<P0 const *>(data[offset]);
+      return *reinterpret_cast<P0 *>(data[offset]);
     }
     return PARENT::template getSegment<P0>(segid);
   }
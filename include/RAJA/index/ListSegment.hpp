@@ -47,6 +47,11 @@
 namespace RAJA
 {
 
+//! Tag selecting the TypedListSegment constructor that leaves the
+//! allocated indices uninitialized.
+struct ListUninitialized {
+};
+
 /*!
  ******************************************************************************
  *
@@ -180,6 +185,22 @@ public:
     m_owned = Owned;
   }
 
+  ///
+  /// Construct an owned list segment with storage for length indices
+  /// that are left uninitialized, for algorithms that compute the size
+  /// of their output before filling it in place through begin().
+  ///
+  TypedListSegment(Index_type length, ListUninitialized)
+      : m_data(nullptr), m_size(length), m_owned(Unowned)
+  {
+    if (m_size <= 0) {
+      m_size = 0;
+      return;
+    }
+    allocate(std::integral_constant<bool, Has_CUDA>());
+    m_owned = Owned;
+  }
+
   ///
   /// Copy-constructor for list segment.
   ///
@@ -324,6 +324,119 @@ private:
   DifferenceType stride;
 };
 
+/*!
+ * \brief Random-access iterator over data[*it] for an iterator it over
+ *        indices, so an algorithm can read and update an indirect sequence
+ *        such as the values addressed by a ListSegment in place.
+ */
+template <typename IndexIter, typename T>
+class gather_iterator
+{
+public:
+  using value_type = typename std::remove_cv<T>::type;
+  using difference_type = Index_type;
+  using pointer = T*;
+  using reference = T&;
+  using iterator_category = std::random_access_iterator_tag;
+
+  RAJA_HOST_DEVICE constexpr gather_iterator() : data(nullptr), it() {}
+  RAJA_HOST_DEVICE constexpr gather_iterator(T* data_, IndexIter it_)
+      : data(data_), it(it_)
+  {
+  }
+
+  RAJA_HOST_DEVICE inline IndexIter index() const { return it; }
+
+  RAJA_HOST_DEVICE inline bool operator==(const gather_iterator& rhs) const
+  {
+    return it == rhs.it;
+  }
+  RAJA_HOST_DEVICE inline bool operator!=(const gather_iterator& rhs) const
+  {
+    return it != rhs.it;
+  }
+  RAJA_HOST_DEVICE inline bool operator<(const gather_iterator& rhs) const
+  {
+    return it < rhs.it;
+  }
+  RAJA_HOST_DEVICE inline bool operator>(const gather_iterator& rhs) const
+  {
+    return it > rhs.it;
+  }
+  RAJA_HOST_DEVICE inline bool operator<=(const gather_iterator& rhs) const
+  {
+    return it <= rhs.it;
+  }
+  RAJA_HOST_DEVICE inline bool operator>=(const gather_iterator& rhs) const
+  {
+    return it >= rhs.it;
+  }
+
+  RAJA_HOST_DEVICE inline gather_iterator& operator++()
+  {
+    ++it;
+    return *this;
+  }
+  RAJA_HOST_DEVICE inline gather_iterator& operator--()
+  {
+    --it;
+    return *this;
+  }
+  RAJA_HOST_DEVICE inline gather_iterator operator++(int)
+  {
+    gather_iterator tmp(*this);
+    ++it;
+    return tmp;
+  }
+  RAJA_HOST_DEVICE inline gather_iterator operator--(int)
+  {
+    gather_iterator tmp(*this);
+    --it;
+    return tmp;
+  }
+  RAJA_HOST_DEVICE inline gather_iterator& operator+=(difference_type rhs)
+  {
+    it = it + rhs;
+    return *this;
+  }
+  RAJA_HOST_DEVICE inline gather_iterator& operator-=(difference_type rhs)
+  {
+    it = it - rhs;
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE inline difference_type operator-(
+      const gather_iterator& rhs) const
+  {
+    return static_cast<difference_type>(it - rhs.it);
+  }
+  RAJA_HOST_DEVICE inline gather_iterator operator+(difference_type rhs) const
+  {
+    return gather_iterator(data, it + rhs);
+  }
+  RAJA_HOST_DEVICE inline gather_iterator operator-(difference_type rhs) const
+  {
+    return gather_iterator(data, it - rhs);
+  }
+  RAJA_HOST_DEVICE friend inline gather_iterator operator+(
+      difference_type lhs,
+      const gather_iterator& rhs)
+  {
+    return rhs + lhs;
+  }
+
+  RAJA_HOST_DEVICE inline reference operator*() const { return data[*it]; }
+  RAJA_HOST_DEVICE inline pointer operator->() const { return &data[*it]; }
+  RAJA_HOST_DEVICE inline reference operator[](difference_type rhs) const
+  {
+    return data[*(it + rhs)];
+  }
+
+private:
+  T* data;
+  IndexIter it;
+};
+
 
 }  // namespace Iterators
 
@@ -0,0 +1,675 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing vectorized prefix-sum kernels used by the
+ *          CPU scan implementations.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_SimdScan_HPP
+#define RAJA_SimdScan_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  In-register scans of operators::plus, minimum and maximum over
+ *         float, double and 32 and 64-bit integers.
+ *
+ *         Each vector of W elements is scanned in log2(W) steps, combining
+ *         it with copies of itself shifted up by 1, 2, 4, ... lanes with
+ *         the identity shifted in. Two vectors are scanned per iteration
+ *         and the running carry is folded in last, so the loop-carried
+ *         dependence is one vector op per 2 W elements instead of one
+ *         scalar op per element.
+ *
+ *         The kernels use AVX-512 when the compiler targets it, else AVX2.
+ *         Without either, or for other types, operators, or iterators than
+ *         raw pointers, the try_* functions return false and the caller
+ *         runs its scalar loop. Floating-point sums are reassociated, as
+ *         in the parallel scans.
+ *
+ ******************************************************************************
+ */
+namespace simd_scan
+{
+
+//! Lane operations on one vector of T; unspecialized means no kernel.
+template <typename T, typename Enable = void>
+struct lanes {
+  static constexpr bool available = false;
+};
+
+//! Source lane of lane l when shifting up by k lanes (0 below k).
+constexpr int shift_source(int l, int k) { return l < k ? 0 : l - k; }
+
+//! Bit mask of the lowest k of w lanes.
+constexpr unsigned low_lanes(int k, int w)
+{
+  return k >= w ? (w >= 32 ? ~0u : (1u << w) - 1u) : (1u << k) - 1u;
+}
+
+template <typename T>
+using is_int32 = std::integral_constant<bool,
+                                        std::is_integral<T>::value
+                                            && sizeof(T) == 4>;
+
+template <typename T>
+using is_int64 = std::integral_constant<bool,
+                                        std::is_integral<T>::value
+                                            && sizeof(T) == 8>;
+
+#if defined(__AVX512F__)
+
+//! Full lane masks. The unmasked AVX-512 permute, min and max intrinsics
+//! pass an undefined vector as the merge source, which GCC reports as
+//! maybe-uninitialized once inlined; the zero-masked forms with every lane
+//! selected compile to the same instructions without it.
+constexpr __mmask16 all_lanes16 = 0xFFFF;
+constexpr __mmask8 all_lanes8 = 0xFF;
+
+template <>
+struct lanes<float> {
+  static constexpr bool available = true;
+  static constexpr int width = 16;
+  using vec = __m512;
+  static RAJA_INLINE vec load(float const *p) { return _mm512_loadu_ps(p); }
+  static RAJA_INLINE void store(float *p, vec v) { _mm512_storeu_ps(p, v); }
+  static RAJA_INLINE vec set1(float x) { return _mm512_set1_ps(x); }
+  template <int K>
+  static RAJA_INLINE vec shift(vec v, vec ident)
+  {
+    const __m512i idx = _mm512_setr_epi32(shift_source(0, K),
+                                          shift_source(1, K),
+                                          shift_source(2, K),
+                                          shift_source(3, K),
+                                          shift_source(4, K),
+                                          shift_source(5, K),
+                                          shift_source(6, K),
+                                          shift_source(7, K),
+                                          shift_source(8, K),
+                                          shift_source(9, K),
+                                          shift_source(10, K),
+                                          shift_source(11, K),
+                                          shift_source(12, K),
+                                          shift_source(13, K),
+                                          shift_source(14, K),
+                                          shift_source(15, K));
+    return _mm512_mask_permutexvar_ps(
+        ident, static_cast<__mmask16>(~low_lanes(K, 16)), idx, v);
+  }
+  static RAJA_INLINE vec last(vec v)
+  {
+    return _mm512_maskz_permutexvar_ps(all_lanes16, _mm512_set1_epi32(15), v);
+  }
+  static RAJA_INLINE vec add(vec a, vec b) { return _mm512_add_ps(a, b); }
+  static RAJA_INLINE vec min(vec a, vec b)
+  {
+    return _mm512_maskz_min_ps(all_lanes16, a, b);
+  }
+  static RAJA_INLINE vec max(vec a, vec b)
+  {
+    return _mm512_maskz_max_ps(all_lanes16, a, b);
+  }
+};
+
+template <>
+struct lanes<double> {
+  static constexpr bool available = true;
+  static constexpr int width = 8;
+  using vec = __m512d;
+  static RAJA_INLINE vec load(double const *p) { return _mm512_loadu_pd(p); }
+  static RAJA_INLINE void store(double *p, vec v) { _mm512_storeu_pd(p, v); }
+  static RAJA_INLINE vec set1(double x) { return _mm512_set1_pd(x); }
+  template <int K>
+  static RAJA_INLINE vec shift(vec v, vec ident)
+  {
+    const __m512i idx = _mm512_setr_epi64(shift_source(0, K),
+                                          shift_source(1, K),
+                                          shift_source(2, K),
+                                          shift_source(3, K),
+                                          shift_source(4, K),
+                                          shift_source(5, K),
+                                          shift_source(6, K),
+                                          shift_source(7, K));
+    return _mm512_mask_permutexvar_pd(
+        ident, static_cast<__mmask8>(~low_lanes(K, 8)), idx, v);
+  }
+  static RAJA_INLINE vec last(vec v)
+  {
+    return _mm512_maskz_permutexvar_pd(all_lanes8, _mm512_set1_epi64(7), v);
+  }
+  static RAJA_INLINE vec add(vec a, vec b) { return _mm512_add_pd(a, b); }
+  static RAJA_INLINE vec min(vec a, vec b)
+  {
+    return _mm512_maskz_min_pd(all_lanes8, a, b);
+  }
+  static RAJA_INLINE vec max(vec a, vec b)
+  {
+    return _mm512_maskz_max_pd(all_lanes8, a, b);
+  }
+};
+
+template <typename T>
+struct lanes<T, typename std::enable_if<is_int32<T>::value>::type> {
+  static constexpr bool available = true;
+  static constexpr int width = 16;
+  using vec = __m512i;
+  static RAJA_INLINE vec load(T const *p) { return _mm512_loadu_si512(p); }
+  static RAJA_INLINE void store(T *p, vec v) { _mm512_storeu_si512(p, v); }
+  static RAJA_INLINE vec set1(T x)
+  {
+    return _mm512_set1_epi32(static_cast<int>(x));
+  }
+  template <int K>
+  static RAJA_INLINE vec shift(vec v, vec ident)
+  {
+    const __m512i idx = _mm512_setr_epi32(shift_source(0, K),
+                                          shift_source(1, K),
+                                          shift_source(2, K),
+                                          shift_source(3, K),
+                                          shift_source(4, K),
+                                          shift_source(5, K),
+                                          shift_source(6, K),
+                                          shift_source(7, K),
+                                          shift_source(8, K),
+                                          shift_source(9, K),
+                                          shift_source(10, K),
+                                          shift_source(11, K),
+                                          shift_source(12, K),
+                                          shift_source(13, K),
+                                          shift_source(14, K),
+                                          shift_source(15, K));
+    return _mm512_mask_permutexvar_epi32(
+        ident, static_cast<__mmask16>(~low_lanes(K, 16)), idx, v);
+  }
+  static RAJA_INLINE vec last(vec v)
+  {
+    return _mm512_maskz_permutexvar_epi32(
+        all_lanes16, _mm512_set1_epi32(15), v);
+  }
+  static RAJA_INLINE vec add(vec a, vec b) { return _mm512_add_epi32(a, b); }
+  static RAJA_INLINE vec min(vec a, vec b)
+  {
+    return std::is_signed<T>::value ? _mm512_maskz_min_epi32(all_lanes16, a, b)
+                                    : _mm512_maskz_min_epu32(all_lanes16, a, b);
+  }
+  static RAJA_INLINE vec max(vec a, vec b)
+  {
+    return std::is_signed<T>::value ? _mm512_maskz_max_epi32(all_lanes16, a, b)
+                                    : _mm512_maskz_max_epu32(all_lanes16, a, b);
+  }
+};
+
+template <typename T>
+struct lanes<T, typename std::enable_if<is_int64<T>::value>::type> {
+  static constexpr bool available = true;
+  static constexpr int width = 8;
+  using vec = __m512i;
+  static RAJA_INLINE vec load(T const *p) { return _mm512_loadu_si512(p); }
+  static RAJA_INLINE void store(T *p, vec v) { _mm512_storeu_si512(p, v); }
+  static RAJA_INLINE vec set1(T x)
+  {
+    return _mm512_set1_epi64(static_cast<long long>(x));
+  }
+  template <int K>
+  static RAJA_INLINE vec shift(vec v, vec ident)
+  {
+    const __m512i idx = _mm512_setr_epi64(shift_source(0, K),
+                                          shift_source(1, K),
+                                          shift_source(2, K),
+                                          shift_source(3, K),
+                                          shift_source(4, K),
+                                          shift_source(5, K),
+                                          shift_source(6, K),
+                                          shift_source(7, K));
+    return _mm512_mask_permutexvar_epi64(
+        ident, static_cast<__mmask8>(~low_lanes(K, 8)), idx, v);
+  }
+  static RAJA_INLINE vec last(vec v)
+  {
+    return _mm512_maskz_permutexvar_epi64(all_lanes8, _mm512_set1_epi64(7), v);
+  }
+  static RAJA_INLINE vec add(vec a, vec b) { return _mm512_add_epi64(a, b); }
+  static RAJA_INLINE vec min(vec a, vec b)
+  {
+    return std::is_signed<T>::value ? _mm512_maskz_min_epi64(all_lanes8, a, b)
+                                    : _mm512_maskz_min_epu64(all_lanes8, a, b);
+  }
+  static RAJA_INLINE vec max(vec a, vec b)
+  {
+    return std::is_signed<T>::value ? _mm512_maskz_max_epi64(all_lanes8, a, b)
+                                    : _mm512_maskz_max_epu64(all_lanes8, a, b);
+  }
+};
+
+#elif defined(__AVX2__)
+
+//! permute4x64 immediate shifting 64-bit lanes up by K.
+template <int K>
+struct shift_imm4 {
+  static constexpr int value = shift_source(0, K) | shift_source(1, K) << 2
+                               | shift_source(2, K) << 4
+                               | shift_source(3, K) << 6;
+};
+
+//! blend_epi32 mask selecting the lowest K 64-bit lanes.
+template <int K>
+struct low_lanes64 {
+  static constexpr int value = static_cast<int>(low_lanes(2 * K, 8));
+};
+
+template <>
+struct lanes<float> {
+  static constexpr bool available = true;
+  static constexpr int width = 8;
+  using vec = __m256;
+  static RAJA_INLINE vec load(float const *p) { return _mm256_loadu_ps(p); }
+  static RAJA_INLINE void store(float *p, vec v) { _mm256_storeu_ps(p, v); }
+  static RAJA_INLINE vec set1(float x) { return _mm256_set1_ps(x); }
+  template <int K>
+  static RAJA_INLINE vec shift(vec v, vec ident)
+  {
+    const __m256i idx = _mm256_setr_epi32(shift_source(0, K),
+                                          shift_source(1, K),
+                                          shift_source(2, K),
+                                          shift_source(3, K),
+                                          shift_source(4, K),
+                                          shift_source(5, K),
+                                          shift_source(6, K),
+                                          shift_source(7, K));
+    return _mm256_blend_ps(_mm256_permutevar8x32_ps(v, idx),
+                           ident,
+                           static_cast<int>(low_lanes(K, 8)));
+  }
+  static RAJA_INLINE vec last(vec v)
+  {
+    return _mm256_permutevar8x32_ps(v, _mm256_set1_epi32(7));
+  }
+  static RAJA_INLINE vec add(vec a, vec b) { return _mm256_add_ps(a, b); }
+  static RAJA_INLINE vec min(vec a, vec b) { return _mm256_min_ps(a, b); }
+  static RAJA_INLINE vec max(vec a, vec b) { return _mm256_max_ps(a, b); }
+};
+
+template <>
+struct lanes<double> {
+  static constexpr bool available = true;
+  static constexpr int width = 4;
+  using vec = __m256d;
+  static RAJA_INLINE vec load(double const *p) { return _mm256_loadu_pd(p); }
+  static RAJA_INLINE void store(double *p, vec v) { _mm256_storeu_pd(p, v); }
+  static RAJA_INLINE vec set1(double x) { return _mm256_set1_pd(x); }
+  template <int K>
+  static RAJA_INLINE vec shift(vec v, vec ident)
+  {
+    return _mm256_blend_pd(_mm256_permute4x64_pd(v, shift_imm4<K>::value),
+                           ident,
+                           static_cast<int>(low_lanes(K, 4)));
+  }
+  static RAJA_INLINE vec last(vec v) { return _mm256_permute4x64_pd(v, 0xff); }
+  static RAJA_INLINE vec add(vec a, vec b) { return _mm256_add_pd(a, b); }
+  static RAJA_INLINE vec min(vec a, vec b) { return _mm256_min_pd(a, b); }
+  static RAJA_INLINE vec max(vec a, vec b) { return _mm256_max_pd(a, b); }
+};
+
+template <typename T>
+struct lanes<T, typename std::enable_if<is_int32<T>::value>::type> {
+  static constexpr bool available = true;
+  static constexpr int width = 8;
+  using vec = __m256i;
+  static RAJA_INLINE vec load(T const *p)
+  {
+    return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p));
+  }
+  static RAJA_INLINE void store(T *p, vec v)
+  {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v);
+  }
+  static RAJA_INLINE vec set1(T x)
+  {
+    return _mm256_set1_epi32(static_cast<int>(x));
+  }
+  template <int K>
+  static RAJA_INLINE vec shift(vec v, vec ident)
+  {
+    const __m256i idx = _mm256_setr_epi32(shift_source(0, K),
+                                          shift_source(1, K),
+                                          shift_source(2, K),
+                                          shift_source(3, K),
+                                          shift_source(4, K),
+                                          shift_source(5, K),
+                                          shift_source(6, K),
+                                          shift_source(7, K));
+    return _mm256_blend_epi32(_mm256_permutevar8x32_epi32(v, idx),
+                              ident,
+                              static_cast<int>(low_lanes(K, 8)));
+  }
+  static RAJA_INLINE vec last(vec v)
+  {
+    return _mm256_permutevar8x32_epi32(v, _mm256_set1_epi32(7));
+  }
+  static RAJA_INLINE vec add(vec a, vec b) { return _mm256_add_epi32(a, b); }
+  static RAJA_INLINE vec min(vec a, vec b)
+  {
+    return std::is_signed<T>::value ? _mm256_min_epi32(a, b)
+                                    : _mm256_min_epu32(a, b);
+  }
+  static RAJA_INLINE vec max(vec a, vec b)
+  {
+    return std::is_signed<T>::value ? _mm256_max_epi32(a, b)
+                                    : _mm256_max_epu32(a, b);
+  }
+};
+
+template <typename T>
+struct lanes<T, typename std::enable_if<is_int64<T>::value>::type> {
+  static constexpr bool available = true;
+  static constexpr int width = 4;
+  using vec = __m256i;
+  static RAJA_INLINE vec load(T const *p)
+  {
+    return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p));
+  }
+  static RAJA_INLINE void store(T *p, vec v)
+  {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v);
+  }
+  static RAJA_INLINE vec set1(T x)
+  {
+    return _mm256_set1_epi64x(static_cast<long long>(x));
+  }
+  template <int K>
+  static RAJA_INLINE vec shift(vec v, vec ident)
+  {
+    return _mm256_blend_epi32(_mm256_permute4x64_epi64(v, shift_imm4<K>::value),
+                              ident,
+                              low_lanes64<K>::value);
+  }
+  static RAJA_INLINE vec last(vec v)
+  {
+    return _mm256_permute4x64_epi64(v, 0xff);
+  }
+  static RAJA_INLINE vec add(vec a, vec b) { return _mm256_add_epi64(a, b); }
+  //! a > b, as signed or unsigned 64-bit integers
+  static RAJA_INLINE vec greater(vec a, vec b)
+  {
+    const vec flip = _mm256_set1_epi64x(
+        std::is_signed<T>::value ? 0 : static_cast<long long>(1ull << 63));
+    return _mm256_cmpgt_epi64(_mm256_xor_si256(a, flip),
+                              _mm256_xor_si256(b, flip));
+  }
+  static RAJA_INLINE vec min(vec a, vec b)
+  {
+    return _mm256_blendv_epi8(a, b, greater(a, b));
+  }
+  static RAJA_INLINE vec max(vec a, vec b)
+  {
+    return _mm256_blendv_epi8(b, a, greater(a, b));
+  }
+};
+
+#endif
+
+//! Vector form of BinFn on T; unspecialized means no kernel.
+template <typename T, typename BinFn>
+struct vec_op {
+  static constexpr bool available = false;
+};
+
+template <typename T>
+struct vec_op<T, operators::plus<T>> {
+  static constexpr bool available = lanes<T>::available;
+  template <typename V>
+  static RAJA_INLINE V apply(V a, V b)
+  {
+    return lanes<T>::add(a, b);
+  }
+};
+
+template <typename T>
+struct vec_op<T, operators::minimum<T>> {
+  static constexpr bool available = lanes<T>::available;
+  template <typename V>
+  static RAJA_INLINE V apply(V a, V b)
+  {
+    return lanes<T>::min(a, b);
+  }
+};
+
+template <typename T>
+struct vec_op<T, operators::maximum<T>> {
+  static constexpr bool available = lanes<T>::available;
+  template <typename V>
+  static RAJA_INLINE V apply(V a, V b)
+  {
+    return lanes<T>::max(a, b);
+  }
+};
+
+template <typename T, typename BinFn>
+struct kernel {
+  using L = lanes<T>;
+  using O = vec_op<T, BinFn>;
+  using vec = typename L::vec;
+  static constexpr int W = L::width;
+
+  //! Inclusive scan of one vector.
+  static RAJA_INLINE vec local(vec v, vec ident)
+  {
+    v = O::apply(v, L::template shift<1>(v, ident));
+    v = O::apply(v, L::template shift<2>(v, ident));
+    if (W > 4) v = O::apply(v, L::template shift<4>(v, ident));
+    if (W > 8) v = O::apply(v, L::template shift<8>(v, ident));
+    return v;
+  }
+
+  static RAJA_INLINE T first(vec v)
+  {
+    T lane[W];
+    L::store(lane, v);
+    return lane[0];
+  }
+
+  //! out[i] = carry op in[0] op ... op in[i]; returns the last value.
+  //! The vector loop counts blocks and the tail restarts from the block
+  //! count, which lets GCC bound both loops without spurious array-bounds
+  //! warnings on small fixed-size arrays.
+  static T inclusive(T const *in, T *out, Index_type n, BinFn op, T carry)
+  {
+    const vec ident = L::set1(BinFn::identity());
+    vec c = L::set1(carry);
+    const Index_type blocks = n > 0 ? n / (2 * W) : 0;
+    Index_type i = 0;
+    for (Index_type k = blocks; k > 0; --k, i += 2 * W) {
+      const vec a = local(L::load(in + i), ident);
+      const vec b = O::apply(local(L::load(in + i + W), ident), L::last(a));
+      L::store(out + i, O::apply(c, a));
+      L::store(out + i + W, O::apply(c, b));
+      c = O::apply(c, L::last(b));
+    }
+    carry = first(c);
+    for (i = blocks * 2 * W; i < n; ++i) {
+      carry = op(carry, in[i]);
+      out[i] = carry;
+    }
+    return carry;
+  }
+
+  //! out[i] = carry op in[0] op ... op in[i-1]; returns the total.
+  static T exclusive(T const *in, T *out, Index_type n, BinFn op, T carry)
+  {
+    const vec ident = L::set1(BinFn::identity());
+    vec c = L::set1(carry);
+    const Index_type blocks = n > 0 ? n / (2 * W) : 0;
+    Index_type i = 0;
+    for (Index_type k = blocks; k > 0; --k, i += 2 * W) {
+      const vec a = local(L::load(in + i), ident);
+      const vec b = local(L::load(in + i + W), ident);
+      const vec a_last = L::last(a);
+      const vec ea = L::template shift<1>(a, ident);
+      const vec eb = O::apply(L::template shift<1>(b, ident), a_last);
+      L::store(out + i, O::apply(c, ea));
+      L::store(out + i + W, O::apply(c, eb));
+      c = O::apply(c, O::apply(a_last, L::last(b)));
+    }
+    carry = first(c);
+    for (i = blocks * 2 * W; i < n; ++i) {
+      const T t = in[i];
+      out[i] = carry;
+      carry = op(carry, t);
+    }
+    return carry;
+  }
+
+  //! carry op in[0] op ... op in[n-1].
+  static T reduce(T const *in, Index_type n, BinFn op, T carry)
+  {
+    const Index_type nv = n > 0 ? n - n % (2 * W) : 0;
+    Index_type i = 0;
+    if (nv > 0) {
+      vec a = L::load(in);
+      vec b = L::load(in + W);
+      for (i = 2 * W; i < nv; i += 2 * W) {
+        a = O::apply(a, L::load(in + i));
+        b = O::apply(b, L::load(in + i + W));
+      }
+      T lane[W];
+      L::store(lane, O::apply(a, b));
+      for (int l = 0; l < W; ++l) {
+        carry = op(carry, lane[l]);
+      }
+    }
+    for (; i < n; ++i) {
+      carry = op(carry, in[i]);
+    }
+    return carry;
+  }
+};
+
+template <typename Iter>
+using pointee =
+    typename std::remove_cv<typename std::remove_pointer<Iter>::type>::type;
+
+//! True if the kernels handle scanning InIter into OutIter with BinFn.
+template <typename InIter, typename OutIter, typename BinFn, typename T>
+struct vectorized
+    : std::integral_constant<
+          bool,
+          std::is_pointer<InIter>::value && std::is_pointer<OutIter>::value
+              && !std::is_const<
+                     typename std::remove_pointer<OutIter>::type>::value
+              && std::is_same<pointee<InIter>, T>::value
+              && std::is_same<pointee<OutIter>, T>::value
+              && vec_op<T, BinFn>::available> {
+};
+
+/*!
+ * \brief Inclusive scan of [in, in + n) into out starting from carry, which
+ *        is updated to the last value; false if no kernel applies.
+ */
+template <typename InIter, typename OutIter, typename BinFn, typename T>
+RAJA_INLINE
+    typename std::enable_if<vectorized<InIter, OutIter, BinFn, T>::value,
+                            bool>::type
+    try_inclusive(InIter in, Index_type n, OutIter out, BinFn op, T &carry)
+{
+  carry = kernel<T, BinFn>::inclusive(in, out, n, op, carry);
+  return true;
+}
+
+template <typename InIter, typename OutIter, typename BinFn, typename T>
+RAJA_INLINE
+    typename std::enable_if<!vectorized<InIter, OutIter, BinFn, T>::value,
+                            bool>::type
+    try_inclusive(InIter, Index_type, OutIter, BinFn, T &)
+{
+  return false;
+}
+
+/*!
+ * \brief Exclusive scan of [in, in + n) into out starting from carry, which
+ *        is updated to the total; false if no kernel applies.
+ */
+template <typename InIter, typename OutIter, typename BinFn, typename T>
+RAJA_INLINE
+    typename std::enable_if<vectorized<InIter, OutIter, BinFn, T>::value,
+                            bool>::type
+    try_exclusive(InIter in, Index_type n, OutIter out, BinFn op, T &carry)
+{
+  carry = kernel<T, BinFn>::exclusive(in, out, n, op, carry);
+  return true;
+}
+
+template <typename InIter, typename OutIter, typename BinFn, typename T>
+RAJA_INLINE
+    typename std::enable_if<!vectorized<InIter, OutIter, BinFn, T>::value,
+                            bool>::type
+    try_exclusive(InIter, Index_type, OutIter, BinFn, T &)
+{
+  return false;
+}
+
+/*!
+ * \brief Fold [in, in + n) into carry; false if no kernel applies.
+ */
+template <typename InIter, typename BinFn, typename T>
+RAJA_INLINE typename std::enable_if<
+    vectorized<InIter, typename std::add_pointer<T>::type, BinFn, T>::value,
+    bool>::type
+try_reduce(InIter in, Index_type n, BinFn op, T &carry)
+{
+  carry = kernel<T, BinFn>::reduce(in, n, op, carry);
+  return true;
+}
+
+template <typename InIter, typename BinFn, typename T>
+RAJA_INLINE typename std::enable_if<
+    !vectorized<InIter, typename std::add_pointer<T>::type, BinFn, T>::value,
+    bool>::type
+try_reduce(InIter, Index_type, BinFn, T &)
+{
+  return false;
+}
+
+}  // namespace simd_scan
+
+}  // namespace internal
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -29,10 +29,21 @@
 
 #include "RAJA/config.hpp"
 
+#include <limits>
+#include <type_traits>
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+#include "RAJA/util/types.hpp"
+
 #if defined(RAJA_ENABLE_OPENMP)
 #include <omp.h>
 #endif
 
+#if defined(RAJA_ENABLE_TBB)
+#include <tbb/tbb.h>
+#endif
+
 namespace RAJA
 {
 
@@ -55,6 +66,77 @@ int getMaxOMPThreadsCPU()
   return nthreads;
 }
 
+/*!
+*************************************************************************
+*
+* Return the number of worker threads an execution policy runs on: the
+* OpenMP or TBB thread count for those policies, 1 for all others.
+*
+*************************************************************************
+*/
+template <typename ExecPolicy>
+RAJA_INLINE typename std::enable_if<
+    type_traits::is_openmp_policy<ExecPolicy>::value,
+    int>::type
+getMaxThreadsCPU(ExecPolicy const &)
+{
+  return getMaxOMPThreadsCPU();
+}
+
+#if defined(RAJA_ENABLE_TBB)
+template <typename ExecPolicy>
+RAJA_INLINE
+    typename std::enable_if<type_traits::is_tbb_policy<ExecPolicy>::value,
+                            int>::type
+    getMaxThreadsCPU(ExecPolicy const &)
+{
+#if TBB_VERSION_MAJOR >= 2017
+  return ::tbb::this_task_arena::max_concurrency();
+#else
+  return ::tbb::task_scheduler_init::default_num_threads();
+#endif
+}
+#endif
+
+template <typename ExecPolicy>
+RAJA_INLINE typename std::enable_if<
+    !type_traits::is_openmp_policy<ExecPolicy>::value
+        && !type_traits::is_tbb_policy<ExecPolicy>::value,
+    int>::type
+getMaxThreadsCPU(ExecPolicy const &)
+{
+  return 1;
+}
+
+namespace detail
+{
+
+//! Fewest elements per part worth handing to another thread.
+constexpr Index_type min_partition_size = 4096;
+
+/*!
+*************************************************************************
+*
+* Return the number of contiguous parts to split n elements into under an
+* execution policy: one per thread, at most max_parts, and no more than
+* leave min_part elements in each; at least 1.
+*
+*************************************************************************
+*/
+template <typename ExecPolicy>
+RAJA_INLINE int partition_count(ExecPolicy const &p,
+                                Index_type n,
+                                Index_type min_part = min_partition_size,
+                                int max_parts = std::numeric_limits<int>::max())
+{
+  Index_type parts = getMaxThreadsCPU(p);
+  if (parts > max_parts) parts = max_parts;
+  if (parts > n / min_part) parts = n / min_part;
+  return parts < 1 ? 1 : static_cast<int>(parts);
+}
+
+}  // namespace detail
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
@@ -0,0 +1,502 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing batched small dense matrix operations
+ *          vectorized across the batch.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_batched_HPP
+#define RAJA_pattern_batched_HPP
+
+#include "RAJA/config.hpp"
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+#include "RAJA/util/Permutations.hpp"
+#include "RAJA/util/StaticLayout.hpp"
+#include "RAJA/util/StaticView.hpp"
+#include "RAJA/util/View.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Batched operations on many small dense matrices.
+ *
+ *         Vectorizing inside a 3x3 product gains little, so the batch is
+ *         stored interleaved instead: matrices are grouped in blocks of
+ *         Lanes, and within a block entry (i, j) of all Lanes matrices is
+ *         contiguous. Every operation then runs the same scalar algorithm
+ *         with an innermost RAJA_SIMD loop over the lanes of a block, one
+ *         matrix per SIMD lane, and the execution policy distributes the
+ *         blocks:
+ *
+ * \verbatim
+ *
+ *   using Mat = RAJA::batched::BatchedView<double, 3, 3>;
+ *   RAJA::batched::InterleavedLayout<3, 3> layout(num_matrices);
+ *   Mat a(RAJA::aligned_allocate<double>(layout.size()), num_matrices);
+ *   ...
+ *   a(e, i, j) = ...;   // entry (i, j) of matrix e
+ *   RAJA::batched::multiply<RAJA::omp_parallel_for_exec>(a, b, c);
+ *
+ * \endverbatim
+ *
+ *         Matrix dimensions are compile-time constants, at most
+ *         max_extent, so all loops but the lane loop unroll completely.
+ *         When the batch size is not a multiple of Lanes the last block
+ *         is padded; padding lanes are computed along with the others and
+ *         their contents are unspecified.
+ *
+ ******************************************************************************
+ */
+namespace batched
+{
+
+//! Largest supported matrix extent.
+constexpr camp::idx_t max_extent = 8;
+
+/*!
+ * \brief Default number of matrices per block: as many values of T as fit
+ *        in DATA_ALIGN bytes, i.e. one aligned vector register or cache
+ *        line.
+ */
+template <typename T>
+struct default_lanes
+    : camp::num<(static_cast<camp::idx_t>(DATA_ALIGN / sizeof(T)) > 0
+                     ? static_cast<camp::idx_t>(DATA_ALIGN / sizeof(T))
+                     : 1)> {
+};
+
+/*!
+ * \brief Layout of a batch of Rows x Cols matrices interleaved in blocks
+ *        of Lanes: entry (i, j) of matrix e lives at
+ *
+ *          (e / Lanes) * Rows * Cols * Lanes + (i * Cols + j) * Lanes
+ *            + e % Lanes
+ *
+ *        Each block is a StaticLayout<PERM_IJK, Rows, Cols, Lanes>.
+ */
+template <camp::idx_t Rows, camp::idx_t Cols, camp::idx_t Lanes>
+struct InterleavedLayout {
+  static_assert(Rows > 0 && Cols > 0 && Lanes > 0,
+                "InterleavedLayout extents must be positive");
+
+  using block_layout = StaticLayout<PERM_IJK, Rows, Cols, Lanes>;
+
+  static constexpr camp::idx_t rows = Rows;
+  static constexpr camp::idx_t cols = Cols;
+  static constexpr camp::idx_t lanes = Lanes;
+  static constexpr Index_type block_size = Rows * Cols * Lanes;
+  static constexpr size_t n_dims = 3;
+
+  Index_type num_matrices;
+
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr InterleavedLayout(Index_type count)
+      : num_matrices(count)
+  {
+  }
+
+  //! Number of blocks, including a padded last one.
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr Index_type num_blocks() const
+  {
+    return (num_matrices + Lanes - 1) / Lanes;
+  }
+
+  //! Number of elements to allocate for the batch.
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr Index_type size() const
+  {
+    return num_blocks() * block_size;
+  }
+
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr Index_type operator()(
+      Index_type e,
+      Index_type i,
+      Index_type j) const
+  {
+    return (e / Lanes) * block_size + (i * Cols + j) * Lanes + e % Lanes;
+  }
+};
+
+template <camp::idx_t Rows, camp::idx_t Cols, camp::idx_t Lanes>
+constexpr camp::idx_t InterleavedLayout<Rows, Cols, Lanes>::rows;
+template <camp::idx_t Rows, camp::idx_t Cols, camp::idx_t Lanes>
+constexpr camp::idx_t InterleavedLayout<Rows, Cols, Lanes>::cols;
+template <camp::idx_t Rows, camp::idx_t Cols, camp::idx_t Lanes>
+constexpr camp::idx_t InterleavedLayout<Rows, Cols, Lanes>::lanes;
+template <camp::idx_t Rows, camp::idx_t Cols, camp::idx_t Lanes>
+constexpr Index_type InterleavedLayout<Rows, Cols, Lanes>::block_size;
+template <camp::idx_t Rows, camp::idx_t Cols, camp::idx_t Lanes>
+constexpr size_t InterleavedLayout<Rows, Cols, Lanes>::n_dims;
+
+/*!
+ * \brief View of a batch of Rows x Cols matrices, indexed (e, i, j).
+ *        Constructed from a pointer and the number of matrices.
+ */
+template <typename T,
+          camp::idx_t Rows,
+          camp::idx_t Cols,
+          camp::idx_t Lanes = default_lanes<
+              typename std::remove_const<T>::type>::value>
+using BatchedView = View<T, InterleavedLayout<Rows, Cols, Lanes>>;
+
+//! View of one block of Lanes interleaved matrices, indexed (i, j, lane).
+template <typename T, camp::idx_t Rows, camp::idx_t Cols, camp::idx_t Lanes>
+using BlockView = StaticView<T, PERM_IJK, Rows, Cols, Lanes>;
+
+namespace detail
+{
+
+//! Block b of a batch as a BlockView.
+template <typename T, camp::idx_t Rows, camp::idx_t Cols, camp::idx_t Lanes>
+RAJA_HOST_DEVICE RAJA_INLINE BlockView<T, Rows, Cols, Lanes> block(
+    View<T, InterleavedLayout<Rows, Cols, Lanes>> const &view,
+    Index_type b)
+{
+  return BlockView<T, Rows, Cols, Lanes>(
+      view.data + b * InterleavedLayout<Rows, Cols, Lanes>::block_size);
+}
+
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE T abs_value(T x)
+{
+  return x < T(0) ? -x : x;
+}
+
+/*!
+ * \brief Exchange entries (k, c) and (r, c) in the lanes l where
+ *        p[l] == target, using selects rather than branches so that all
+ *        lanes follow the same instruction stream.
+ */
+template <typename T, typename U, camp::idx_t R, camp::idx_t C, camp::idx_t W>
+RAJA_HOST_DEVICE RAJA_INLINE void swap_rows(BlockView<T, R, C, W> a,
+                                            U const (&p)[W],
+                                            U target,
+                                            camp::idx_t k,
+                                            camp::idx_t r,
+                                            camp::idx_t c)
+{
+  T new_k[W];
+  T new_r[W];
+  RAJA_SIMD
+  for (camp::idx_t l = 0; l < W; ++l) {
+    const T x = a(k, c, l);
+    const T y = a(r, c, l);
+    const bool swap = p[l] == target;
+    new_k[l] = swap ? y : x;
+    new_r[l] = swap ? x : y;
+  }
+  RAJA_SIMD
+  for (camp::idx_t l = 0; l < W; ++l) {
+    a(k, c, l) = new_k[l];
+    a(r, c, l) = new_r[l];
+  }
+}
+
+//! c = a * b for one block.
+template <typename TA,
+          typename TB,
+          typename TC,
+          camp::idx_t R,
+          camp::idx_t K,
+          camp::idx_t C,
+          camp::idx_t W>
+RAJA_HOST_DEVICE RAJA_INLINE void multiply_block(BlockView<TA, R, K, W> a,
+                                                 BlockView<TB, K, C, W> b,
+                                                 BlockView<TC, R, C, W> c)
+{
+  for (camp::idx_t i = 0; i < R; ++i) {
+    for (camp::idx_t j = 0; j < C; ++j) {
+      TC acc[W];
+      RAJA_SIMD
+      for (camp::idx_t l = 0; l < W; ++l) {
+        acc[l] = a(i, 0, l) * b(0, j, l);
+      }
+      for (camp::idx_t k = 1; k < K; ++k) {
+        RAJA_SIMD
+        for (camp::idx_t l = 0; l < W; ++l) {
+          acc[l] += a(i, k, l) * b(k, j, l);
+        }
+      }
+      RAJA_SIMD
+      for (camp::idx_t l = 0; l < W; ++l) {
+        c(i, j, l) = acc[l];
+      }
+    }
+  }
+}
+
+/*!
+ * \brief In-place LU factorization with partial pivoting of one block.
+ *
+ *        Pivot search and row swaps are per-lane selects; piv(k, 0, l)
+ *        receives the row swapped with row k.
+ */
+template <typename T, typename P, camp::idx_t N, camp::idx_t W>
+RAJA_HOST_DEVICE RAJA_INLINE void lu_factor_block(BlockView<T, N, N, W> a,
+                                                  BlockView<P, N, 1, W> piv)
+{
+  for (camp::idx_t k = 0; k < N; ++k) {
+    // pivot rows are tracked as T so that the selects vectorize with the
+    // same width as the data
+    T p[W];
+    T best[W];
+    RAJA_SIMD
+    for (camp::idx_t l = 0; l < W; ++l) {
+      p[l] = T(k);
+      best[l] = abs_value(a(k, k, l));
+    }
+    for (camp::idx_t r = k + 1; r < N; ++r) {
+      RAJA_SIMD
+      for (camp::idx_t l = 0; l < W; ++l) {
+        const T v = abs_value(a(r, k, l));
+        const bool larger = v > best[l];
+        best[l] = larger ? v : best[l];
+        p[l] = larger ? T(r) : p[l];
+      }
+    }
+    RAJA_SIMD
+    for (camp::idx_t l = 0; l < W; ++l) {
+      piv(k, 0, l) = static_cast<P>(p[l]);
+    }
+
+    for (camp::idx_t r = k + 1; r < N; ++r) {
+      for (camp::idx_t c = 0; c < N; ++c) {
+        swap_rows(a, p, T(r), k, r, c);
+      }
+    }
+
+    T inv[W];
+    RAJA_SIMD
+    for (camp::idx_t l = 0; l < W; ++l) {
+      inv[l] = T(1) / a(k, k, l);
+    }
+    for (camp::idx_t r = k + 1; r < N; ++r) {
+      T m[W];
+      RAJA_SIMD
+      for (camp::idx_t l = 0; l < W; ++l) {
+        m[l] = a(r, k, l) * inv[l];
+        a(r, k, l) = m[l];
+      }
+      for (camp::idx_t c = k + 1; c < N; ++c) {
+        RAJA_SIMD
+        for (camp::idx_t l = 0; l < W; ++l) {
+          a(r, c, l) -= m[l] * a(k, c, l);
+        }
+      }
+    }
+  }
+}
+
+//! Overwrite b with the solution of (P L U) x = b for one block.
+template <typename TLU,
+          typename P,
+          typename T,
+          camp::idx_t N,
+          camp::idx_t K,
+          camp::idx_t W>
+RAJA_HOST_DEVICE RAJA_INLINE void lu_solve_block(BlockView<TLU, N, N, W> lu,
+                                                 BlockView<P, N, 1, W> piv,
+                                                 BlockView<T, N, K, W> b)
+{
+  for (camp::idx_t k = 0; k < N; ++k) {
+    T p[W];
+    RAJA_SIMD
+    for (camp::idx_t l = 0; l < W; ++l) {
+      p[l] = static_cast<T>(piv(k, 0, l));
+    }
+    for (camp::idx_t r = k + 1; r < N; ++r) {
+      for (camp::idx_t c = 0; c < K; ++c) {
+        swap_rows(b, p, T(r), k, r, c);
+      }
+    }
+  }
+
+  // forward substitution with unit lower triangle
+  for (camp::idx_t r = 1; r < N; ++r) {
+    for (camp::idx_t k = 0; k < r; ++k) {
+      for (camp::idx_t c = 0; c < K; ++c) {
+        RAJA_SIMD
+        for (camp::idx_t l = 0; l < W; ++l) {
+          b(r, c, l) -= lu(r, k, l) * b(k, c, l);
+        }
+      }
+    }
+  }
+
+  // back substitution with upper triangle
+  for (camp::idx_t r = N - 1; r >= 0; --r) {
+    T inv[W];
+    RAJA_SIMD
+    for (camp::idx_t l = 0; l < W; ++l) {
+      inv[l] = T(1) / lu(r, r, l);
+    }
+    for (camp::idx_t c = 0; c < K; ++c) {
+      for (camp::idx_t k = r + 1; k < N; ++k) {
+        RAJA_SIMD
+        for (camp::idx_t l = 0; l < W; ++l) {
+          b(r, c, l) -= lu(r, k, l) * b(k, c, l);
+        }
+      }
+      RAJA_SIMD
+      for (camp::idx_t l = 0; l < W; ++l) {
+        b(r, c, l) *= inv[l];
+      }
+    }
+  }
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Batched product c(e) = a(e) * b(e) for every matrix e of c.
+ *
+ *        a and b must hold at least as many matrices as c; c must not
+ *        overlap a or b.
+ */
+template <typename ExecPolicy,
+          typename TA,
+          typename TB,
+          typename TC,
+          camp::idx_t R,
+          camp::idx_t K,
+          camp::idx_t C,
+          camp::idx_t W>
+RAJA_INLINE void multiply(View<TA, InterleavedLayout<R, K, W>> const &a,
+                          View<TB, InterleavedLayout<K, C, W>> const &b,
+                          View<TC, InterleavedLayout<R, C, W>> const &c)
+{
+  static_assert(R <= max_extent && K <= max_extent && C <= max_extent,
+                "batched operations support matrices up to 8x8");
+  forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, c.layout.num_blocks()),
+                     [=](Index_type blk) {
+                       detail::multiply_block(detail::block(a, blk),
+                                              detail::block(b, blk),
+                                              detail::block(c, blk));
+                     });
+}
+
+/*!
+ * \brief In-place batched LU factorization with partial pivoting,
+ *        P a(e) = L U with unit lower triangular L.
+ *
+ *        L (below the diagonal) and U overwrite a(e); piv(e, k, 0) holds
+ *        the row exchanged with row k at step k. A singular matrix yields
+ *        infinities or NaNs in its own lane only.
+ */
+template <typename ExecPolicy,
+          typename T,
+          typename P,
+          camp::idx_t N,
+          camp::idx_t W>
+RAJA_INLINE void lu_factor(View<T, InterleavedLayout<N, N, W>> const &a,
+                           View<P, InterleavedLayout<N, 1, W>> const &piv)
+{
+  static_assert(N <= max_extent,
+                "batched operations support matrices up to 8x8");
+  forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, a.layout.num_blocks()),
+                     [=](Index_type blk) {
+                       detail::lu_factor_block(detail::block(a, blk),
+                                               detail::block(piv, blk));
+                     });
+}
+
+/*!
+ * \brief Batched solve with the factors from lu_factor: overwrite each
+ *        N x K right-hand side b(e) with the solution of a(e) x = b(e).
+ */
+template <typename ExecPolicy,
+          typename TLU,
+          typename P,
+          typename T,
+          camp::idx_t N,
+          camp::idx_t K,
+          camp::idx_t W>
+RAJA_INLINE void lu_solve(View<TLU, InterleavedLayout<N, N, W>> const &lu,
+                          View<P, InterleavedLayout<N, 1, W>> const &piv,
+                          View<T, InterleavedLayout<N, K, W>> const &b)
+{
+  static_assert(N <= max_extent && K <= max_extent,
+                "batched operations support matrices up to 8x8");
+  forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, b.layout.num_blocks()),
+                     [=](Index_type blk) {
+                       detail::lu_solve_block(detail::block(lu, blk),
+                                              detail::block(piv, blk),
+                                              detail::block(b, blk));
+                     });
+}
+
+/*!
+ * \brief Batched inverse ainv(e) = a(e)^-1, computed by LU with partial
+ *        pivoting in per-block scratch storage; a is not modified.
+ */
+template <typename ExecPolicy,
+          typename TA,
+          typename T,
+          camp::idx_t N,
+          camp::idx_t W>
+RAJA_INLINE void inverse(View<TA, InterleavedLayout<N, N, W>> const &a,
+                         View<T, InterleavedLayout<N, N, W>> const &ainv)
+{
+  static_assert(N <= max_extent,
+                "batched operations support matrices up to 8x8");
+  using block_layout = typename InterleavedLayout<N, N, W>::block_layout;
+  forall<ExecPolicy>(
+      TypedRangeSegment<Index_type>(0, ainv.layout.num_blocks()),
+      [=](Index_type blk) {
+        T lu_data[N * N * W];
+        T piv_data[N * W];
+        BlockView<T, N, N, W> lu(lu_data);
+        BlockView<T, N, 1, W> piv(piv_data);
+        BlockView<TA, N, N, W> src = detail::block(a, blk);
+        BlockView<T, N, N, W> dst = detail::block(ainv, blk);
+
+        for (Index_type i = 0; i < block_layout::size(); ++i) {
+          lu.data[i] = src.data[i];
+        }
+        detail::lu_factor_block(lu, piv);
+
+        for (camp::idx_t i = 0; i < N; ++i) {
+          for (camp::idx_t j = 0; j < N; ++j) {
+            RAJA_SIMD
+            for (camp::idx_t l = 0; l < W; ++l) {
+              dst(i, j, l) = i == j ? T(1) : T(0);
+            }
+          }
+        }
+        detail::lu_solve_block(lu, piv, dst);
+      });
+}
+
+}  // namespace batched
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,203 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing a stable bucket partition (counting sort
+ *          permutation) of indices by integer key.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_bucket_partition_HPP
+#define RAJA_pattern_bucket_partition_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "camp/concepts.hpp"
+
+#include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/internal/ThreadUtils_CPU.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/scan.hpp"
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+******************************************************************************
+*
+* \brief  Stable partition of the indices of keys into nbuckets buckets.
+*
+*         On return out_perm[out_offsets[b] .. out_offsets[b + 1]) holds,
+*         in increasing order, every index i with keys[i] == b, and
+*         out_offsets[nbuckets] is the number of keys. Every key must lie
+*         in [0, nbuckets).
+*
+*         The keys are split into one contiguous part per thread. Each
+*         part counts its keys into a private histogram, with no atomics;
+*         the histograms are combined by a scan over (bucket, part) pairs
+*         in bucket-major order, which gives every part its own starting
+*         position within each bucket; each part then scatters its indices
+*         in order, which keeps the permutation stable. The histograms take
+*         (threads x nbuckets) indices of temporary storage.
+*
+* \param[in] p Execution policy
+* \param[in] keys Random-access range of integer keys
+* \param[in] nbuckets Number of buckets
+* \param[out] out_perm Random-access iterator to keys.size() indices
+* \param[out] out_offsets Random-access iterator to nbuckets + 1 offsets
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Keys,
+          typename PermIter,
+          typename OffsetIter>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<Keys>,
+                    type_traits::is_iterator<PermIter>,
+                    type_traits::is_iterator<OffsetIter>>
+bucket_partition(const ExecPolicy &p,
+                 Keys const &keys,
+                 Index_type nbuckets,
+                 PermIter out_perm,
+                 OffsetIter out_offsets)
+{
+  using IndexT = detail::IterVal<PermIter>;
+  static_assert(type_traits::is_random_access_iterator<PermIter>::value,
+                "Permutation iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<OffsetIter>::value,
+                "Offset iterator must model RandomAccessIterator");
+  if (nbuckets <= 0) return;
+
+  auto key = keys.begin();
+  const Index_type n = keys.end() - keys.begin();
+  const Index_type parts = detail::partition_count(p, n);
+
+  // counts[t * nbuckets + b]: keys of part t in bucket b, then the output
+  // position of the next index of part t in bucket b
+  std::vector<Index_type> histograms(parts * nbuckets, 0);
+  Index_type *counts = histograms.data();
+
+  forall<ExecPolicy>(
+      TypedRangeSegment<Index_type>(0, parts), [=](Index_type t) {
+        Index_type *hist = counts + t * nbuckets;
+        const Index_type hi = (t + 1) * n / parts;
+        for (Index_type i = t * n / parts; i < hi; ++i) {
+          ++hist[static_cast<Index_type>(key[i])];
+        }
+      });
+
+  if (parts == 1) {
+    exclusive_scan_inplace<seq_exec>(counts, counts + nbuckets);
+    for (Index_type b = 0; b < nbuckets; ++b) {
+      out_offsets[b] = counts[b];
+    }
+  } else {
+    forall<ExecPolicy>(
+        TypedRangeSegment<Index_type>(0, nbuckets), [=](Index_type b) {
+          Index_type total = 0;
+          for (Index_type t = 0; t < parts; ++t) {
+            total += counts[t * nbuckets + b];
+          }
+          out_offsets[b] = total;
+        });
+    exclusive_scan_inplace<ExecPolicy>(out_offsets, out_offsets + nbuckets);
+    forall<ExecPolicy>(
+        TypedRangeSegment<Index_type>(0, nbuckets), [=](Index_type b) {
+          Index_type pos = out_offsets[b];
+          for (Index_type t = 0; t < parts; ++t) {
+            const Index_type c = counts[t * nbuckets + b];
+            counts[t * nbuckets + b] = pos;
+            pos += c;
+          }
+        });
+  }
+  out_offsets[nbuckets] = n;
+
+  forall<ExecPolicy>(
+      TypedRangeSegment<Index_type>(0, parts), [=](Index_type t) {
+        Index_type *pos = counts + t * nbuckets;
+        const Index_type hi = (t + 1) * n / parts;
+        for (Index_type i = t * n / parts; i < hi; ++i) {
+          out_perm[pos[static_cast<Index_type>(key[i])]++] =
+              static_cast<IndexT>(i);
+        }
+      });
+}
+
+/*!
+******************************************************************************
+*
+* \brief  Bucket partition that also appends one TypedListSegment per
+*         bucket, in bucket order, to iset for later traversals.
+*
+*         The segments do not own their indices: they refer to out_perm,
+*         which must outlive iset. Empty buckets give empty segments, so
+*         segment b of the appended range always holds bucket b.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Keys,
+          typename T,
+          typename OffsetIter,
+          typename... SegmentTypes>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<Keys>,
+                    type_traits::is_iterator<OffsetIter>>
+bucket_partition(const ExecPolicy &p,
+                 Keys const &keys,
+                 Index_type nbuckets,
+                 T *out_perm,
+                 OffsetIter out_offsets,
+                 TypedIndexSet<SegmentTypes...> &iset)
+{
+  bucket_partition(p, keys, nbuckets, out_perm, out_offsets);
+  for (Index_type b = 0; b < nbuckets; ++b) {
+    const Index_type lo = static_cast<Index_type>(out_offsets[b]);
+    const Index_type len = static_cast<Index_type>(out_offsets[b + 1]) - lo;
+    iset.push_back(TypedListSegment<T>(out_perm + lo, len, Unowned));
+  }
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+bucket_partition(Args &&... args)
+{
+  bucket_partition(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
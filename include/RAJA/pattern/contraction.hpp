@@ -0,0 +1,571 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing binary tensor contractions over RAJA
+ *          Views with a loop nest chosen from the Views' layouts.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_contraction_HPP
+#define RAJA_pattern_contraction_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+#include "RAJA/util/Layout.hpp"
+#include "RAJA/util/View.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Binary tensor contractions out += a * b over labeled Views.
+ *
+ *         Every View dimension is named by a one-character label; labels
+ *         of a or b that do not appear in out are summed over. The LTimes
+ *         operator phi(m, g, z) += sum_d L(m, d) * psi(d, g, z) is
+ *
+ * \verbatim
+ *
+ *   using namespace RAJA::contraction;
+ *   contract<RAJA::omp_parallel_for_exec>(phi, labels<'m', 'g', 'z'>(),
+ *                                         L,   labels<'m', 'd'>(),
+ *                                         psi, labels<'d', 'g', 'z'>());
+ *
+ * \endverbatim
+ *
+ *         No loop order is fixed in the source. make_plan inspects the
+ *         extents and strides of the three layouts at run time and picks
+ *
+ *           - the innermost loop: the label with unit stride in as many
+ *             Views as possible and no large stride in any, preferring
+ *             labels with unit stride in out, so the loop vectorizes;
+ *           - the order of the other loops: decreasing largest stride;
+ *           - when the three Views do not fit in cache_bytes, a loop over
+ *             an out label to tile so that each tile's working set does:
+ *             the innermost loop if its tiles stay long enough to
+ *             vectorize well, else the next out label outwards;
+ *           - the loop run by the execution policy: the tile loop if there
+ *             is one, otherwise the outermost loop over an out label.
+ *             Both are free of write conflicts.
+ *
+ *         The innermost loop has specialized variants for the common
+ *         stride patterns (scaled add, elementwise product, dot product)
+ *         and a strided fallback. Views must use RAJA::Layout (including
+ *         permuted layouts) over raw pointers; TypedViews are accepted.
+ *         out must not overlap a or b.
+ *
+ ******************************************************************************
+ */
+namespace contraction
+{
+
+//! Labels naming the dimensions of one View, in order.
+template <char... Labels>
+struct labels {
+};
+
+//! Largest number of distinct labels in one contraction.
+constexpr int max_labels = 8;
+
+//! Cache budget used by make_plan unless one is given.
+constexpr size_t default_cache_bytes = size_t(1) << 20;
+
+//! Tile size when tiles are needed only for parallelism.
+constexpr Index_type parallel_tile = 1024;
+
+//! Shortest innermost tile, in SIMD vectors, worth vectorizing.
+constexpr Index_type min_inner_vectors = 8;
+
+//! Operand positions in Plan::stride.
+enum operand { out_operand = 0, a_operand = 1, b_operand = 2 };
+
+/*!
+ * \brief Loop nest for one contraction, outermost loop first.
+ *
+ *        stride[op][k] is the stride of operand op along loop k, zero if
+ *        the label does not index op. If tile_loop is not -1, that loop
+ *        is split into tiles of tile iterations and the loop over tiles is
+ *        run by the execution policy; otherwise loop 0 is.
+ */
+struct Plan {
+  int num_loops;
+  char label[max_labels];
+  Index_type extent[max_labels];
+  Index_type stride[3][max_labels];
+  bool contracted[max_labels];
+  int tile_loop;
+  Index_type tile;
+};
+
+namespace detail
+{
+
+//! Labels, extents and strides of one View.
+struct Operand {
+  int rank;
+  char label[max_labels];
+  Index_type extent[max_labels];
+  Index_type stride[max_labels];
+};
+
+template <camp::idx_t... RangeInts,
+          typename IdxLin,
+          ptrdiff_t StrideOneDim,
+          char... Labels>
+RAJA_INLINE Operand describe(
+    RAJA::detail::LayoutBase_impl<camp::idx_seq<RangeInts...>,
+                                  IdxLin,
+                                  StrideOneDim> const &layout,
+    labels<Labels...>)
+{
+  static_assert(sizeof...(Labels) == sizeof...(RangeInts),
+                "contraction needs one label per View dimension");
+  static_assert(sizeof...(Labels) <= max_labels,
+                "too many dimensions for a contraction");
+  const char names[] = {Labels...};
+  Operand op;
+  op.rank = static_cast<int>(sizeof...(Labels));
+  for (int d = 0; d < op.rank; ++d) {
+    op.label[d] = names[d];
+    op.extent[d] = static_cast<Index_type>(layout.sizes[d]);
+    op.stride[d] = static_cast<Index_type>(layout.strides[d]);
+  }
+  return op;
+}
+
+template <typename T, typename LayoutType>
+RAJA_INLINE View<T, LayoutType> const &untyped(
+    View<T, LayoutType> const &view)
+{
+  return view;
+}
+
+template <typename T, typename LayoutType, typename... IndexTypes>
+RAJA_INLINE View<T, LayoutType> const &untyped(
+    TypedViewBase<T, T *, LayoutType, IndexTypes...> const &view)
+{
+  return view.base_;
+}
+
+//! Add the labels of op to plan, checking that shared labels agree.
+inline void add_operand(Plan &plan, Operand const &op, int which)
+{
+  for (int d = 0; d < op.rank; ++d) {
+    int k = 0;
+    while (k < plan.num_loops && plan.label[k] != op.label[d]) {
+      ++k;
+    }
+    if (k == plan.num_loops) {
+      if (plan.num_loops == max_labels) {
+        RAJA_ABORT_OR_THROW("contraction: too many distinct labels");
+      }
+      ++plan.num_loops;
+      plan.label[k] = op.label[d];
+      plan.extent[k] = op.extent[d];
+      plan.contracted[k] = which != out_operand;
+    } else if (plan.extent[k] != op.extent[d]) {
+      RAJA_ABORT_OR_THROW("contraction: extents of a label differ");
+    }
+    // a label repeated within one View indexes its diagonal
+    plan.stride[which][k] += op.stride[d];
+  }
+}
+
+//! true if loop j makes a better innermost loop than loop k.
+inline bool better_inner(Plan const &plan, int j, int k)
+{
+  int bad[2] = {0, 0};
+  int unit[2] = {0, 0};
+  const int loops[2] = {j, k};
+  for (int c = 0; c < 2; ++c) {
+    for (int op = 0; op < 3; ++op) {
+      bad[c] += plan.stride[op][loops[c]] > 1;
+      unit[c] += plan.stride[op][loops[c]] == 1;
+    }
+  }
+  if ((bad[0] == 0) != (bad[1] == 0)) return bad[0] == 0;
+  const bool out_unit_j = plan.stride[out_operand][j] == 1;
+  const bool out_unit_k = plan.stride[out_operand][k] == 1;
+  if (out_unit_j != out_unit_k) return out_unit_j;
+  if (unit[0] != unit[1]) return unit[0] > unit[1];
+  return plan.extent[j] > plan.extent[k];
+}
+
+inline Index_type max_stride(Plan const &plan, int k)
+{
+  Index_type s = 0;
+  for (int op = 0; op < 3; ++op) {
+    s = plan.stride[op][k] > s ? plan.stride[op][k] : s;
+  }
+  return s;
+}
+
+//! true if loop j should run outside loop k.
+inline bool outer_before(Plan const &plan, int j, int k)
+{
+  const Index_type sj = max_stride(plan, j);
+  const Index_type sk = max_stride(plan, k);
+  if (sj != sk) return sj > sk;
+  if (plan.contracted[j] != plan.contracted[k]) return !plan.contracted[j];
+  return plan.extent[j] > plan.extent[k];
+}
+
+inline void move_loop(Plan &plan, int from, int to)
+{
+  while (from != to) {
+    const int next = from < to ? from + 1 : from - 1;
+    std::swap(plan.label[from], plan.label[next]);
+    std::swap(plan.extent[from], plan.extent[next]);
+    std::swap(plan.contracted[from], plan.contracted[next]);
+    for (int op = 0; op < 3; ++op) {
+      std::swap(plan.stride[op][from], plan.stride[op][next]);
+    }
+    from = next;
+  }
+}
+
+//! Number of values of the given size in one SIMD vector.
+inline Index_type simd_lanes(size_t value_size)
+{
+  return static_cast<size_t>(DATA_ALIGN) > value_size
+             ? static_cast<Index_type>(static_cast<size_t>(DATA_ALIGN)
+                                       / value_size)
+             : 1;
+}
+
+//! Number of elements of operand op in the loop nest.
+inline Index_type operand_size(Plan const &plan, int op)
+{
+  Index_type elems = 1;
+  for (int k = 0; k < plan.num_loops; ++k) {
+    if (plan.stride[op][k] != 0) elems *= plan.extent[k];
+  }
+  return elems;
+}
+
+/*!
+ * \brief Tile size for loop k so that the part of every operand touched
+ *        by one tile fits in budget elements.
+ */
+inline Index_type tile_size(Plan const &plan, int k, Index_type budget)
+{
+  Index_type fixed = 0;
+  Index_type per_iteration = 0;
+  for (int op = 0; op < 3; ++op) {
+    const Index_type elems = operand_size(plan, op);
+    if (plan.stride[op][k] != 0) {
+      per_iteration += elems / plan.extent[k];
+    } else {
+      fixed += elems;
+    }
+  }
+  if (per_iteration == 0) return plan.extent[k];
+  return budget > fixed ? (budget - fixed) / per_iteration : 0;
+}
+
+/*!
+ * \brief Choose plan.tile_loop and plan.tile for a working-set budget of
+ *        cache_bytes, leaving tile_loop at -1 if the operands fit.
+ */
+inline void choose_tiling(Plan &plan, size_t value_size, size_t cache_bytes)
+{
+  const Index_type budget = static_cast<Index_type>(cache_bytes / value_size);
+  Index_type total = 0;
+  for (int op = 0; op < 3; ++op) {
+    total += operand_size(plan, op);
+  }
+  if (total <= budget) return;
+
+  const int inner = plan.num_loops - 1;
+  const Index_type lanes = simd_lanes(value_size);
+  for (int k = inner; k >= 0; --k) {
+    if (plan.contracted[k]) continue;
+    Index_type tile = tile_size(plan, k, budget);
+    if (k == inner) {
+      tile = tile / lanes * lanes;
+      if (tile < min_inner_vectors * lanes) continue;
+    }
+    tile = tile > 0 ? tile : 1;
+    if (tile < plan.extent[k]) {
+      plan.tile_loop = k;
+      plan.tile = tile;
+    }
+    return;
+  }
+}
+
+/*!
+ * \brief Innermost loop, o[i*so] += a[i*sa] * b[i*sb] for i in [0, n),
+ *        with unit-stride and broadcast cases written out so that they
+ *        vectorize.
+ */
+template <typename TO, typename TA, typename TB>
+RAJA_INLINE void inner_loop(Index_type n,
+                            TO *RAJA_RESTRICT o,
+                            Index_type so,
+                            TA *RAJA_RESTRICT a,
+                            Index_type sa,
+                            TB *RAJA_RESTRICT b,
+                            Index_type sb)
+{
+  if (so == 1 && sa == 0 && sb == 1) {
+    const TA s = *a;
+    RAJA_SIMD
+    for (Index_type i = 0; i < n; ++i) {
+      o[i] += s * b[i];
+    }
+  } else if (so == 1 && sa == 1 && sb == 0) {
+    const TB s = *b;
+    RAJA_SIMD
+    for (Index_type i = 0; i < n; ++i) {
+      o[i] += a[i] * s;
+    }
+  } else if (so == 1 && sa == 1 && sb == 1) {
+    RAJA_SIMD
+    for (Index_type i = 0; i < n; ++i) {
+      o[i] += a[i] * b[i];
+    }
+  } else if (so == 0) {
+    using value_type = typename std::remove_const<TO>::type;
+    value_type acc(0);
+    if (sa == 1 && sb == 1) {
+      // independent partial sums so that the reduction vectorizes
+      constexpr Index_type parts = 8;
+      value_type part[parts] = {};
+      Index_type i = 0;
+      for (; i + parts <= n; i += parts) {
+        RAJA_SIMD
+        for (Index_type l = 0; l < parts; ++l) {
+          part[l] += a[i + l] * b[i + l];
+        }
+      }
+      for (; i < n; ++i) {
+        acc += a[i] * b[i];
+      }
+      for (Index_type l = 0; l < parts; ++l) {
+        acc += part[l];
+      }
+    } else {
+      for (Index_type i = 0; i < n; ++i) {
+        acc += a[i * sa] * b[i * sb];
+      }
+    }
+    *o += acc;
+  } else {
+    for (Index_type i = 0; i < n; ++i) {
+      o[i * so] += a[i * sa] * b[i * sb];
+    }
+  }
+}
+
+//! Run loops depth.. of plan, the tiled one over [lo, hi).
+template <typename TO, typename TA, typename TB>
+void run_loops(Plan const &plan,
+               int depth,
+               Index_type lo,
+               Index_type hi,
+               TO *o,
+               TA *a,
+               TB *b)
+{
+  const Index_type so = plan.stride[out_operand][depth];
+  const Index_type sa = plan.stride[a_operand][depth];
+  const Index_type sb = plan.stride[b_operand][depth];
+  const Index_type begin = depth == plan.tile_loop ? lo : 0;
+  const Index_type end = depth == plan.tile_loop ? hi : plan.extent[depth];
+  if (depth == plan.num_loops - 1) {
+    inner_loop(end - begin,
+               o + begin * so,
+               so,
+               a + begin * sa,
+               sa,
+               b + begin * sb,
+               sb);
+    return;
+  }
+  for (Index_type i = begin; i < end; ++i) {
+    run_loops(plan, depth + 1, lo, hi, o + i * so, a + i * sa, b + i * sb);
+  }
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Choose the loop nest for out += a * b from the labels and the
+ *        run-time layouts of the three Views.
+ *
+ *        cache_bytes is the working-set budget used for tiling,
+ *        typically the per-core L2 size. Throws (or aborts, with
+ *        RAJA_NO_EXCEPT set) if a label's extents differ between Views.
+ */
+template <typename OutView,
+          char... OutLabels,
+          typename AView,
+          char... ALabels,
+          typename BView,
+          char... BLabels>
+Plan make_plan(OutView const &out,
+               labels<OutLabels...> out_labels,
+               AView const &a,
+               labels<ALabels...> a_labels,
+               BView const &b,
+               labels<BLabels...> b_labels,
+               size_t cache_bytes = default_cache_bytes)
+{
+  Plan plan;
+  plan.num_loops = 0;
+  plan.tile_loop = -1;
+  plan.tile = 0;
+  for (int op = 0; op < 3; ++op) {
+    for (int k = 0; k < max_labels; ++k) {
+      plan.stride[op][k] = 0;
+    }
+  }
+
+  detail::add_operand(plan,
+                      detail::describe(detail::untyped(out).layout, out_labels),
+                      out_operand);
+  detail::add_operand(plan,
+                      detail::describe(detail::untyped(a).layout, a_labels),
+                      a_operand);
+  detail::add_operand(plan,
+                      detail::describe(detail::untyped(b).layout, b_labels),
+                      b_operand);
+
+  // innermost loop last, the others by decreasing stride
+  int inner = 0;
+  for (int k = 1; k < plan.num_loops; ++k) {
+    if (detail::better_inner(plan, k, inner)) inner = k;
+  }
+  detail::move_loop(plan, inner, plan.num_loops - 1);
+  for (int k = 1; k < plan.num_loops - 1; ++k) {
+    int j = k;
+    while (j > 0 && detail::outer_before(plan, j, j - 1)) {
+      detail::move_loop(plan, j, j - 1);
+      --j;
+    }
+  }
+
+  using value_type = typename std::remove_const<
+      typename std::remove_reference<decltype(
+          detail::untyped(out).data[0])>::type>::type;
+  const int last = plan.num_loops - 1;
+  detail::choose_tiling(plan, sizeof(value_type), cache_bytes);
+
+  if (plan.tile_loop < 0) {
+    // run the outermost out label in parallel, or tiles of the innermost
+    // loop if that is the only out label
+    int k = 0;
+    while (plan.contracted[k]) {
+      ++k;
+    }
+    if (k < last) {
+      detail::move_loop(plan, k, 0);
+    } else {
+      plan.tile_loop = last;
+      plan.tile = plan.extent[last] < parallel_tile ? plan.extent[last]
+                                                     : parallel_tile;
+      plan.tile = plan.tile > 0 ? plan.tile : 1;
+    }
+  }
+  return plan;
+}
+
+/*!
+ * \brief Execute plan on the data of out, a and b, which must have the
+ *        layouts plan was made for.
+ */
+template <typename ExecPolicy, typename TO, typename TA, typename TB>
+void execute(Plan const &plan, TO *out, TA *a, TB *b)
+{
+  using RAJA::contraction::detail::run_loops;
+  if (plan.tile_loop >= 0) {
+    const Index_type n = plan.extent[plan.tile_loop];
+    const Index_type tile = plan.tile;
+    forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, (n + tile - 1) / tile),
+                       [=](Index_type t) {
+                         const Index_type lo = t * tile;
+                         const Index_type hi = lo + tile < n ? lo + tile : n;
+                         run_loops(plan, 0, lo, hi, out, a, b);
+                       });
+  } else {
+    const Index_type so = plan.stride[out_operand][0];
+    const Index_type sa = plan.stride[a_operand][0];
+    const Index_type sb = plan.stride[b_operand][0];
+    forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, plan.extent[0]),
+                       [=](Index_type i) {
+                         run_loops(plan,
+                                   1,
+                                   0,
+                                   0,
+                                   out + i * so,
+                                   a + i * sa,
+                                   b + i * sb);
+                       });
+  }
+}
+
+/*!
+ * \brief out += a * b, contracting over labels absent from out, with the
+ *        loop nest from make_plan and the parallel loop run by ExecPolicy.
+ */
+template <typename ExecPolicy,
+          typename OutView,
+          char... OutLabels,
+          typename AView,
+          char... ALabels,
+          typename BView,
+          char... BLabels>
+void contract(OutView const &out,
+              labels<OutLabels...> out_labels,
+              AView const &a,
+              labels<ALabels...> a_labels,
+              BView const &b,
+              labels<BLabels...> b_labels,
+              size_t cache_bytes = default_cache_bytes)
+{
+  const Plan plan =
+      make_plan(out, out_labels, a, a_labels, b, b_labels, cache_bytes);
+  execute<ExecPolicy>(plan,
+                      detail::untyped(out).data,
+                      detail::untyped(a).data,
+                      detail::untyped(b).data);
+}
+
+}  // namespace contraction
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
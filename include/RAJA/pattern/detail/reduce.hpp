@@ -27,6 +27,7 @@
 #define RAJA_PATTERN_DETAIL_REDUCE_HPP
 
 #include "RAJA/util/Operators.hpp"
+#include "RAJA/util/SoAFields.hpp"
 #include "RAJA/util/types.hpp"
 
 #define RAJA_DECLARE_REDUCER(OP, POL, COMBINER)               \
@@ -134,6 +135,17 @@ struct limits<::RAJA::reduce::detail::ValueLoc<T, B>> : limits<T> {
 };
 }  // namespace operators
 
+//! ValueLoc is stored as separate value and index arrays by SoAArray and
+//! SoAPtr.
+template <typename T, bool B>
+struct soa_fields<reduce::detail::ValueLoc<T, B>>
+    : soa_field_list<
+          SoAField<T reduce::detail::ValueLoc<T, B>::*,
+                   &reduce::detail::ValueLoc<T, B>::val>,
+          SoAField<Index_type reduce::detail::ValueLoc<T, B>::*,
+                   &reduce::detail::ValueLoc<T, B>::loc>> {
+};
+
 namespace reduce
 {
 
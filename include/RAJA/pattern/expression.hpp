@@ -0,0 +1,724 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing lazy elementwise expressions over RAJA
+ *          Views that evaluate in a single fused loop.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_expression_HPP
+#define RAJA_pattern_expression_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cmath>
+#include <type_traits>
+#include <utility>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/reduce.hpp"
+
+#include "RAJA/policy/reduce_policy.hpp"
+
+#include "RAJA/util/Layout.hpp"
+#include "RAJA/util/OffsetLayout.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/View.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Lazy elementwise expressions over RAJA::View.
+ *
+ *         Arithmetic operators on Views and scalars build an expression
+ *         tree instead of computing anything. assign() and the reductions
+ *         then evaluate the whole tree in one forall, so
+ *
+ * \verbatim
+ *
+ *   RAJA::expr::assign<RAJA::omp_parallel_for_exec>(a, b + alpha * c - d * e);
+ *   double n2 = RAJA::expr::sum<RAJA::omp_parallel_for_exec>(a * a);
+ *
+ * \endverbatim
+ *
+ *         each read every operand once and never allocate temporaries.
+ *
+ *         The outermost View dimension is run by the execution policy and
+ *         the remaining dimensions by nested sequential loops, with the
+ *         innermost one marked RAJA_SIMD. That loop vectorizes when the
+ *         layouts declare their stride-one dimension, e.g.
+ *         Layout<2, Index_type, 1>. Reductions accumulate each
+ *         outer index into a scalar and update the reducer once per
+ *         outer index. Every View in an expression must be defined over
+ *         the index space of the destination (assign) or of the first
+ *         View in the expression (reductions); assign and the reductions
+ *         raise an error otherwise.
+ *
+ ******************************************************************************
+ */
+namespace expr
+{
+
+namespace detail
+{
+
+//
+// Index space of a layout. Layouts start at zero, offset layouts at their
+// lower bounds.
+//
+template <camp::idx_t... RangeInts, typename IdxLin, ptrdiff_t StrideOneDim>
+RAJA_INLINE camp::num<sizeof...(RangeInts)> layout_rank(
+    RAJA::detail::LayoutBase_impl<camp::idx_seq<RangeInts...>,
+                                  IdxLin,
+                                  StrideOneDim> const &);
+
+template <camp::idx_t... RangeInts, typename IdxLin>
+RAJA_INLINE camp::num<sizeof...(RangeInts)> layout_rank(
+    RAJA::internal::OffsetLayout_impl<camp::idx_seq<RangeInts...>,
+                                      IdxLin> const &);
+
+template <camp::idx_t... RangeInts, typename IdxLin, ptrdiff_t StrideOneDim>
+RAJA_INLINE void layout_extent(
+    RAJA::detail::LayoutBase_impl<camp::idx_seq<RangeInts...>,
+                                  IdxLin,
+                                  StrideOneDim> const &layout,
+    camp::idx_t d,
+    Index_type &begin,
+    Index_type &end)
+{
+  begin = 0;
+  end = static_cast<Index_type>(layout.sizes[d]);
+}
+
+template <camp::idx_t... RangeInts, typename IdxLin>
+RAJA_INLINE void layout_extent(
+    RAJA::internal::OffsetLayout_impl<camp::idx_seq<RangeInts...>,
+                                      IdxLin> const &layout,
+    camp::idx_t d,
+    Index_type &begin,
+    Index_type &end)
+{
+  begin = static_cast<Index_type>(layout.offsets[d]);
+  end = begin + static_cast<Index_type>(layout.base_.sizes[d]);
+}
+
+//! Rectangular index space [begin[d], end[d]) of rank Rank.
+template <camp::idx_t Rank>
+struct Shape {
+  Index_type begin[Rank];
+  Index_type end[Rank];
+};
+
+template <typename LayoutType>
+RAJA_INLINE Shape<decltype(layout_rank(std::declval<LayoutType>()))::value>
+layout_shape(LayoutType const &layout)
+{
+  Shape<decltype(layout_rank(std::declval<LayoutType>()))::value> shape;
+  for (camp::idx_t d = 0;
+       d < decltype(layout_rank(std::declval<LayoutType>()))::value;
+       ++d) {
+    layout_extent(layout, d, shape.begin[d], shape.end[d]);
+  }
+  return shape;
+}
+
+template <camp::idx_t Rank>
+RAJA_INLINE bool same_shape(Shape<Rank> const &a, Shape<Rank> const &b)
+{
+  for (camp::idx_t d = 0; d < Rank; ++d) {
+    if (a.begin[d] != b.begin[d] || a.end[d] != b.end[d]) return false;
+  }
+  return true;
+}
+
+//
+// Elementwise operations. Arguments are taken by value since they are
+// always values computed from the leaves; results are decayed so that the
+// selecting operations never return references to their arguments.
+//
+#define RAJA_EXPR_BINARY_OP(NAME, EXPR)                                     \
+  struct NAME {                                                             \
+    template <typename A, typename B>                                       \
+    RAJA_HOST_DEVICE RAJA_INLINE auto operator()(A a, B b) const            \
+        -> typename std::decay<decltype(EXPR)>::type                        \
+    {                                                                       \
+      return EXPR;                                                          \
+    }                                                                       \
+  };
+
+RAJA_EXPR_BINARY_OP(add, a + b)
+RAJA_EXPR_BINARY_OP(subtract, a - b)
+RAJA_EXPR_BINARY_OP(multiply, a * b)
+RAJA_EXPR_BINARY_OP(divide, a / b)
+RAJA_EXPR_BINARY_OP(minimum, b < a ? b : a)
+RAJA_EXPR_BINARY_OP(maximum, b > a ? b : a)
+RAJA_EXPR_BINARY_OP(power, std::pow(a, b))
+
+#undef RAJA_EXPR_BINARY_OP
+
+#define RAJA_EXPR_UNARY_OP(NAME, EXPR)                                      \
+  struct NAME {                                                             \
+    template <typename A>                                                   \
+    RAJA_HOST_DEVICE RAJA_INLINE auto operator()(A a) const                 \
+        -> typename std::decay<decltype(EXPR)>::type                        \
+    {                                                                       \
+      return EXPR;                                                          \
+    }                                                                       \
+  };
+
+RAJA_EXPR_UNARY_OP(negate, -a)
+RAJA_EXPR_UNARY_OP(absolute, std::abs(a))
+RAJA_EXPR_UNARY_OP(square_root, std::sqrt(a))
+RAJA_EXPR_UNARY_OP(exponential, std::exp(a))
+RAJA_EXPR_UNARY_OP(logarithm, std::log(a))
+RAJA_EXPR_UNARY_OP(sine, std::sin(a))
+RAJA_EXPR_UNARY_OP(cosine, std::cos(a))
+
+#undef RAJA_EXPR_UNARY_OP
+
+}  // namespace detail
+
+/*!
+ * \brief Leaf holding a scalar, broadcast to every index.
+ */
+template <typename T>
+struct Scalar {
+  using value_type = T;
+  static constexpr camp::idx_t rank = 0;
+
+  T value;
+
+  template <camp::idx_t Rank>
+  bool conforms(detail::Shape<Rank> const &) const
+  {
+    return true;
+  }
+
+  template <typename... Args>
+  RAJA_HOST_DEVICE RAJA_INLINE value_type eval(Args...) const
+  {
+    return value;
+  }
+};
+
+/*!
+ * \brief Leaf holding a copy of a View.
+ */
+template <typename ViewType>
+struct ViewLeaf {
+  using value_type = typename std::remove_const<
+      typename ViewType::value_type>::type;
+  static constexpr camp::idx_t rank = decltype(detail::layout_rank(
+      std::declval<typename ViewType::layout_type>()))::value;
+
+  ViewType view;
+
+  detail::Shape<rank> shape() const
+  {
+    return detail::layout_shape(view.layout);
+  }
+
+  bool conforms(detail::Shape<rank> const &s) const
+  {
+    return detail::same_shape(shape(), s);
+  }
+
+  template <typename... Args>
+  RAJA_HOST_DEVICE RAJA_INLINE value_type eval(Args... args) const
+  {
+    return view(args...);
+  }
+};
+
+template <typename Op, typename Lhs, typename Rhs>
+struct Binary {
+  using value_type = decltype(Op{}(std::declval<typename Lhs::value_type>(),
+                                   std::declval<typename Rhs::value_type>()));
+  static constexpr camp::idx_t rank =
+      Lhs::rank > Rhs::rank ? Lhs::rank : Rhs::rank;
+
+  Lhs lhs;
+  Rhs rhs;
+
+  detail::Shape<rank> shape() const
+  {
+    return shape_of(camp::num<Lhs::rank == rank>{});
+  }
+
+  bool conforms(detail::Shape<rank> const &s) const
+  {
+    return lhs.conforms(s) && rhs.conforms(s);
+  }
+
+  template <typename... Args>
+  RAJA_HOST_DEVICE RAJA_INLINE value_type eval(Args... args) const
+  {
+    return Op{}(lhs.eval(args...), rhs.eval(args...));
+  }
+
+private:
+  detail::Shape<rank> shape_of(camp::num<true>) const { return lhs.shape(); }
+  detail::Shape<rank> shape_of(camp::num<false>) const { return rhs.shape(); }
+};
+
+template <typename Op, typename Arg>
+struct Unary {
+  using value_type = decltype(Op{}(std::declval<typename Arg::value_type>()));
+  static constexpr camp::idx_t rank = Arg::rank;
+
+  Arg arg;
+
+  detail::Shape<rank> shape() const { return arg.shape(); }
+
+  bool conforms(detail::Shape<rank> const &s) const
+  {
+    return arg.conforms(s);
+  }
+
+  template <typename... Args>
+  RAJA_HOST_DEVICE RAJA_INLINE value_type eval(Args... args) const
+  {
+    return Op{}(arg.eval(args...));
+  }
+};
+
+//
+// Operand classification and conversion to expression nodes.
+//
+template <typename T>
+struct is_expression : std::false_type {
+};
+
+template <typename ValueType, typename LayoutType, typename PointerType>
+struct is_expression<View<ValueType, LayoutType, PointerType>>
+    : std::true_type {
+};
+
+template <typename ViewType>
+struct is_expression<ViewLeaf<ViewType>> : std::true_type {
+};
+
+template <typename Op, typename Lhs, typename Rhs>
+struct is_expression<Binary<Op, Lhs, Rhs>> : std::true_type {
+};
+
+template <typename Op, typename Arg>
+struct is_expression<Unary<Op, Arg>> : std::true_type {
+};
+
+template <typename T>
+struct is_scalar : std::is_arithmetic<T> {
+};
+
+template <typename T>
+struct is_operand
+    : camp::num<is_expression<T>::value || is_scalar<T>::value> {
+};
+
+template <typename T, typename Enable = void>
+struct node {
+  using type = T;
+  static RAJA_INLINE T const &make(T const &t) { return t; }
+};
+
+template <typename T>
+struct node<T, typename std::enable_if<is_scalar<T>::value>::type> {
+  using type = Scalar<T>;
+  static RAJA_INLINE type make(T t) { return type{t}; }
+};
+
+template <typename ValueType, typename LayoutType, typename PointerType>
+struct node<View<ValueType, LayoutType, PointerType>> {
+  using view_type = View<ValueType, LayoutType, PointerType>;
+  using type = ViewLeaf<view_type>;
+  static RAJA_INLINE type make(view_type const &v) { return type{v}; }
+};
+
+template <typename T>
+using node_t = typename node<T>::type;
+
+template <typename Op, typename Lhs, typename Rhs>
+RAJA_INLINE Binary<Op, node_t<Lhs>, node_t<Rhs>> make_binary(Lhs const &lhs,
+                                                             Rhs const &rhs)
+{
+  return {node<Lhs>::make(lhs), node<Rhs>::make(rhs)};
+}
+
+template <typename Op, typename Arg>
+RAJA_INLINE Unary<Op, node_t<Arg>> make_unary(Arg const &arg)
+{
+  return {node<Arg>::make(arg)};
+}
+
+//! Enabled when the operands form an expression: at least one is a View
+//! or expression and the other is a View, expression or arithmetic value.
+template <typename Lhs, typename Rhs>
+using enable_if_binary = typename std::enable_if<
+    is_operand<Lhs>::value && is_operand<Rhs>::value
+        && (is_expression<Lhs>::value || is_expression<Rhs>::value),
+    int>::type;
+
+template <typename Arg>
+using enable_if_unary =
+    typename std::enable_if<is_expression<Arg>::value, int>::type;
+
+//
+// Elementwise math functions.
+//
+#define RAJA_EXPR_UNARY_FUNCTION(NAME, OP)                                  \
+  template <typename Arg, enable_if_unary<Arg> = 0>                         \
+  RAJA_INLINE Unary<detail::OP, node_t<Arg>> NAME(Arg const &arg)           \
+  {                                                                         \
+    return make_unary<detail::OP>(arg);                                     \
+  }
+
+RAJA_EXPR_UNARY_FUNCTION(abs, absolute)
+RAJA_EXPR_UNARY_FUNCTION(sqrt, square_root)
+RAJA_EXPR_UNARY_FUNCTION(exp, exponential)
+RAJA_EXPR_UNARY_FUNCTION(log, logarithm)
+RAJA_EXPR_UNARY_FUNCTION(sin, sine)
+RAJA_EXPR_UNARY_FUNCTION(cos, cosine)
+
+#undef RAJA_EXPR_UNARY_FUNCTION
+
+#define RAJA_EXPR_BINARY_FUNCTION(NAME, OP)                                 \
+  template <typename Lhs, typename Rhs, enable_if_binary<Lhs, Rhs> = 0>     \
+  RAJA_INLINE Binary<detail::OP, node_t<Lhs>, node_t<Rhs>> NAME(            \
+      Lhs const &lhs, Rhs const &rhs)                                       \
+  {                                                                         \
+    return make_binary<detail::OP>(lhs, rhs);                               \
+  }
+
+RAJA_EXPR_BINARY_FUNCTION(min, minimum)
+RAJA_EXPR_BINARY_FUNCTION(max, maximum)
+RAJA_EXPR_BINARY_FUNCTION(pow, power)
+
+#undef RAJA_EXPR_BINARY_FUNCTION
+
+namespace detail
+{
+
+//
+// Loop nest over dimensions D..Rank-1 of a shape; the outermost dimension
+// is handled by forall.
+//
+template <camp::idx_t D, camp::idx_t Rank, bool Innermost = (D + 1 == Rank)>
+struct InnerLoops {
+  template <typename Body, typename... Idx>
+  static RAJA_HOST_DEVICE RAJA_INLINE void run(Shape<Rank> const &shape,
+                                               Body const &body,
+                                               Idx... idx)
+  {
+    for (Index_type i = shape.begin[D]; i < shape.end[D]; ++i) {
+      InnerLoops<D + 1, Rank>::run(shape, body, idx..., i);
+    }
+  }
+};
+
+template <camp::idx_t D, camp::idx_t Rank>
+struct InnerLoops<D, Rank, true> {
+  template <typename Body, typename... Idx>
+  static RAJA_HOST_DEVICE RAJA_INLINE void run(Shape<Rank> const &shape,
+                                               Body const &body,
+                                               Idx... idx)
+  {
+    // A local copy lets the compiler keep the leaves' pointers and strides
+    // in registers instead of reloading them after every store. Bodies
+    // only hold Views here; reductions go through InnerReduce.
+    const Body local_body = body;
+    const Index_type begin = shape.begin[D];
+    const Index_type end = shape.end[D];
+    RAJA_SIMD
+    for (Index_type i = begin; i < end; ++i) {
+      local_body(idx..., i);
+    }
+  }
+};
+
+template <camp::idx_t Rank>
+struct InnerLoops<Rank, Rank, false> {
+  template <typename Body, typename... Idx>
+  static RAJA_HOST_DEVICE RAJA_INLINE void run(Shape<Rank> const &,
+                                               Body const &body,
+                                               Idx... idx)
+  {
+    body(idx...);
+  }
+};
+
+//
+// Reduction of dimensions D..Rank-1 of a shape with Op, starting from acc.
+// The innermost loop accumulates into a scalar local, so a row costs one
+// update of the reducer instead of one per element.
+//
+template <camp::idx_t D, camp::idx_t Rank, bool Innermost = (D + 1 == Rank)>
+struct InnerReduce {
+  template <typename Op, typename Src, typename T, typename... Idx>
+  static RAJA_HOST_DEVICE RAJA_INLINE T run(Shape<Rank> const &shape,
+                                            Src const &src,
+                                            Op op,
+                                            T acc,
+                                            Idx... idx)
+  {
+    for (Index_type i = shape.begin[D]; i < shape.end[D]; ++i) {
+      acc = InnerReduce<D + 1, Rank>::run(shape, src, op, acc, idx..., i);
+    }
+    return acc;
+  }
+};
+
+template <camp::idx_t D, camp::idx_t Rank>
+struct InnerReduce<D, Rank, true> {
+  template <typename Op, typename Src, typename T, typename... Idx>
+  static RAJA_HOST_DEVICE RAJA_INLINE T run(Shape<Rank> const &shape,
+                                            Src const &src,
+                                            Op op,
+                                            T acc,
+                                            Idx... idx)
+  {
+    const Index_type begin = shape.begin[D];
+    const Index_type end = shape.end[D];
+    for (Index_type i = begin; i < end; ++i) {
+      acc = op(acc, src.eval(idx..., i));
+    }
+    return acc;
+  }
+};
+
+template <camp::idx_t Rank>
+struct InnerReduce<Rank, Rank, false> {
+  template <typename Op, typename Src, typename T, typename... Idx>
+  static RAJA_HOST_DEVICE RAJA_INLINE T run(Shape<Rank> const &,
+                                            Src const &src,
+                                            Op op,
+                                            T acc,
+                                            Idx... idx)
+  {
+    return op(acc, src.eval(idx...));
+  }
+};
+
+template <typename ExecPolicy, camp::idx_t Rank, typename Body>
+RAJA_INLINE void for_each_index(Shape<Rank> const &shape, Body const &body)
+{
+  static_assert(Rank > 0, "expression must contain at least one View");
+  forall<ExecPolicy>(TypedRangeSegment<Index_type>(shape.begin[0],
+                                                   shape.end[0]),
+                     [=](Index_type i) {
+                       InnerLoops<1, Rank>::run(shape, body, i);
+                     });
+}
+
+//! Reduce src with Op over each outer index and hand every partial to
+//! combine. combine holds the reducer and is captured by the loop body,
+//! which the parallel policies privatize once per thread.
+template <typename ExecPolicy, typename Op, typename Src, typename Combine>
+RAJA_INLINE void reduce_each_index(Src const &src, Combine const &combine)
+{
+  constexpr camp::idx_t Rank = Src::rank;
+  static_assert(Rank > 0, "expression must contain at least one View");
+  const Shape<Rank> shape = src.shape();
+  forall<ExecPolicy>(TypedRangeSegment<Index_type>(shape.begin[0],
+                                                   shape.end[0]),
+                     [=](Index_type i) {
+                       combine(InnerReduce<1, Rank>::run(
+                           shape, src, Op{}, Op::identity(), i));
+                     });
+}
+
+template <typename Dst, typename Src>
+struct AssignBody {
+  Dst dst;
+  Src src;
+
+  template <typename... Idx>
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(Idx... idx) const
+  {
+    dst(idx...) = src.eval(idx...);
+  }
+};
+
+template <typename Reducer>
+struct SumInto {
+  Reducer reducer;
+
+  template <typename T>
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(T partial) const
+  {
+    reducer += partial;
+  }
+};
+
+template <typename Reducer>
+struct MinInto {
+  Reducer reducer;
+
+  template <typename T>
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(T partial) const
+  {
+    reducer.min(partial);
+  }
+};
+
+template <typename Reducer>
+struct MaxInto {
+  Reducer reducer;
+
+  template <typename T>
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(T partial) const
+  {
+    reducer.max(partial);
+  }
+};
+
+}  // namespace detail
+
+/*!
+ * \brief Evaluate src at every index of dst and store the result in dst,
+ *        in one fused loop run by ExecPolicy. src may be an expression,
+ *        a View or a scalar.
+ */
+template <typename ExecPolicy,
+          typename ValueType,
+          typename LayoutType,
+          typename PointerType,
+          typename Src>
+RAJA_INLINE void assign(View<ValueType, LayoutType, PointerType> const &dst,
+                        Src const &src)
+{
+  using dst_type = View<ValueType, LayoutType, PointerType>;
+  using body_type = detail::AssignBody<dst_type, node_t<Src>>;
+  auto const shape = detail::layout_shape(dst.layout);
+  auto const src_node = node<Src>::make(src);
+  if (!src_node.conforms(shape)) {
+    RAJA_ABORT_OR_THROW("RAJA::expr::assign: operand extents differ");
+  }
+  detail::for_each_index<ExecPolicy>(shape, body_type{dst, src_node});
+}
+
+/*!
+ * \brief Sum of an expression over its index space.
+ */
+template <typename ExecPolicy, typename Expr, enable_if_unary<Expr> = 0>
+RAJA_INLINE typename node_t<Expr>::value_type sum(Expr const &e)
+{
+  using value_type = typename node_t<Expr>::value_type;
+  using reduce_policy =
+      typename RAJA::detail::default_reduce_policy<ExecPolicy>::type;
+  using reducer_type = ReduceSum<reduce_policy, value_type>;
+
+  auto const src = node<Expr>::make(e);
+  if (!src.conforms(src.shape())) {
+    RAJA_ABORT_OR_THROW("RAJA::expr::sum: operand extents differ");
+  }
+  reducer_type reducer(value_type(0));
+  detail::reduce_each_index<ExecPolicy, operators::plus<value_type>>(
+      src, detail::SumInto<reducer_type>{reducer});
+  return reducer.get();
+}
+
+/*!
+ * \brief Minimum of an expression over its index space.
+ */
+template <typename ExecPolicy, typename Expr, enable_if_unary<Expr> = 0>
+RAJA_INLINE typename node_t<Expr>::value_type min(Expr const &e)
+{
+  using value_type = typename node_t<Expr>::value_type;
+  using reduce_policy =
+      typename RAJA::detail::default_reduce_policy<ExecPolicy>::type;
+  using reducer_type = ReduceMin<reduce_policy, value_type>;
+
+  auto const src = node<Expr>::make(e);
+  if (!src.conforms(src.shape())) {
+    RAJA_ABORT_OR_THROW("RAJA::expr::min: operand extents differ");
+  }
+  reducer_type reducer(operators::limits<value_type>::max());
+  detail::reduce_each_index<ExecPolicy, operators::minimum<value_type>>(
+      src, detail::MinInto<reducer_type>{reducer});
+  return reducer.get();
+}
+
+/*!
+ * \brief Maximum of an expression over its index space.
+ */
+template <typename ExecPolicy, typename Expr, enable_if_unary<Expr> = 0>
+RAJA_INLINE typename node_t<Expr>::value_type max(Expr const &e)
+{
+  using value_type = typename node_t<Expr>::value_type;
+  using reduce_policy =
+      typename RAJA::detail::default_reduce_policy<ExecPolicy>::type;
+  using reducer_type = ReduceMax<reduce_policy, value_type>;
+
+  auto const src = node<Expr>::make(e);
+  if (!src.conforms(src.shape())) {
+    RAJA_ABORT_OR_THROW("RAJA::expr::max: operand extents differ");
+  }
+  reducer_type reducer(operators::limits<value_type>::min());
+  detail::reduce_each_index<ExecPolicy, operators::maximum<value_type>>(
+      src, detail::MaxInto<reducer_type>{reducer});
+  return reducer.get();
+}
+
+}  // namespace expr
+
+//
+// Arithmetic operators build expressions. They live in namespace RAJA so
+// that argument-dependent lookup finds them for RAJA::View operands, and
+// they only participate when at least one operand is a View or expression.
+//
+#define RAJA_EXPR_OPERATOR(OPERATOR, OP)                                    \
+  template <typename Lhs,                                                   \
+            typename Rhs,                                                   \
+            expr::enable_if_binary<Lhs, Rhs> = 0>                           \
+  RAJA_INLINE expr::Binary<expr::detail::OP,                                \
+                           expr::node_t<Lhs>,                               \
+                           expr::node_t<Rhs>>                               \
+  OPERATOR(Lhs const &lhs, Rhs const &rhs)                                  \
+  {                                                                         \
+    return expr::make_binary<expr::detail::OP>(lhs, rhs);                   \
+  }
+
+RAJA_EXPR_OPERATOR(operator+, add)
+RAJA_EXPR_OPERATOR(operator-, subtract)
+RAJA_EXPR_OPERATOR(operator*, multiply)
+RAJA_EXPR_OPERATOR(operator/, divide)
+
+#undef RAJA_EXPR_OPERATOR
+
+template <typename Arg, expr::enable_if_unary<Arg> = 0>
+RAJA_INLINE expr::Unary<expr::detail::negate, expr::node_t<Arg>> operator-(
+    Arg const &arg)
+{
+  return expr::make_unary<expr::detail::negate>(arg);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
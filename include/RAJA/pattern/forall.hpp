@@ -102,12 +102,33 @@ namespace RAJA
 namespace internal
 {
 
+#if defined(RAJA_ENABLE_CHAI)
+
+/*!
+ * Copy the loop body before dispatch so that the copy constructors of any
+ * captured chai::ManagedArray objects trigger their data movement into the
+ * execution space set by setChaiExecutionSpace.
+ */
 template <typename T>
 auto trigger_updates_before(T&& item) -> typename std::remove_reference<T>::type
 {
   return item;
 }
 
+#else
+
+/*!
+ * Without CHAI there is nothing to trigger, so forward the loop body
+ * untouched instead of paying for a copy of every captured value.
+ */
+template <typename T>
+RAJA_INLINE T&& trigger_updates_before(T&& item)
+{
+  return std::forward<T>(item);
+}
+
+#endif
+
 
 }  // end namespace internal
 
@@ -177,7 +198,7 @@ forall(ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
 {
 
   using RAJA::internal::trigger_updates_before;
-  auto body = trigger_updates_before(loop_body);
+  auto&& body = trigger_updates_before(loop_body);
 
   forall_impl(std::forward<ExecutionPolicy>(p),
               std::forward<Container>(c),
@@ -201,7 +222,7 @@ RAJA_INLINE void forall_Icount(ExecutionPolicy&& p,
                                LoopBody&& loop_body)
 {
   using RAJA::internal::trigger_updates_before;
-  auto body = trigger_updates_before(loop_body);
+  auto&& body = trigger_updates_before(loop_body);
 
   using std::begin;
   using std::distance;
@@ -233,7 +254,7 @@ RAJA_INLINE void forall_Icount(ExecPolicy<SegmentIterPolicy, SegmentExecPolicy>,
 {
 
   using RAJA::internal::trigger_updates_before;
-  auto body = trigger_updates_before(loop_body);
+  auto&& body = trigger_updates_before(loop_body);
 
   // no need for icount variant here
   wrap::forall(SegmentIterPolicy(), iset, [=](int segID) {
@@ -254,7 +275,7 @@ RAJA_INLINE void forall(ExecPolicy<SegmentIterPolicy, SegmentExecPolicy>,
 {
 
   using RAJA::internal::trigger_updates_before;
-  auto body = trigger_updates_before(loop_body);
+  auto&& body = trigger_updates_before(loop_body);
 
   wrap::forall(SegmentIterPolicy(), iset, [=](int segID) {
     iset.segmentCall(segID, detail::CallForall{}, SegmentExecPolicy(), body);
@@ -436,32 +457,25 @@ forall_Icount(ExecutionPolicy&& p,
               LoopBody&& loop_body)
 {
 
-  detail::setChaiExecutionSpace<ExecutionPolicy>();
-
-  // turn into an iterator
+  // turn into an iterator, the container overload sets the CHAI space
   forall_Icount(std::forward<ExecutionPolicy>(p),
                 TypedListSegment<ArrayIdxType>(idx, len, Unowned),
                 icount,
                 std::forward<LoopBody>(loop_body));
-
-  detail::clearChaiExecutionSpace();
 }
 
 /*!
  * \brief Conversion from template-based policy to value-based policy for forall
  *
- * this reduces implementation overhead and perfectly forwards all arguments
+ * this reduces implementation overhead and perfectly forwards all arguments;
+ * the value-based overloads set and clear the CHAI execution space, so it is
+ * not done a second time here
  */
 template <typename ExecutionPolicy, typename... Args>
 RAJA_INLINE void forall(Args&&... args)
 {
-
-  detail::setChaiExecutionSpace<ExecutionPolicy>();
-
   RAJA_FORCEINLINE_RECURSIVE
   forall(ExecutionPolicy(), std::forward<Args>(args)...);
-
-  detail::clearChaiExecutionSpace();
 }
 
 /*!
@@ -473,12 +487,7 @@ RAJA_INLINE void forall(Args&&... args)
 template <typename ExecutionPolicy, typename... Args>
 RAJA_INLINE void forall_Icount(Args&&... args)
 {
-
-  detail::setChaiExecutionSpace<ExecutionPolicy>();
-
   forall_Icount(ExecutionPolicy(), std::forward<Args>(args)...);
-
-  detail::clearChaiExecutionSpace();
 }
 
 namespace detail
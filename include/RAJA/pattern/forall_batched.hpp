@@ -0,0 +1,152 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing a forall over many small index ranges
+ *          described by a CSR-style offset array.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_forall_batched_HPP
+#define RAJA_pattern_forall_batched_HPP
+
+#include "RAJA/config.hpp"
+
+#include <utility>
+
+#include "camp/concepts.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/internal/ThreadUtils_CPU.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/segmented_reduce.hpp"
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+******************************************************************************
+*
+* \brief  Execute body(b, j) for every batch b in [0, num_batches) and
+*         every index j in [offsets[b], offsets[b + 1]), in one launch.
+*
+*         This replaces one forall per batch, or a TypedIndexSet with one
+*         RangeSegment per batch, for many small independent loops such as
+*         one per patch or block: there is a single parallel region and no
+*         per-segment dispatch.
+*
+*         Parallel policies split the merged sequence of batch ends and
+*         indices into equal parts (the merge-path partitioning of
+*         segmented_reduce), one per thread, so every thread gets the same
+*         number of indices plus batches however the batch sizes are
+*         distributed; a large batch may be shared by several threads.
+*         Within a thread, indices are visited in increasing order.
+*
+* Usage example:
+*
+* \verbatim
+*
+*   // offsets[b] = first zone of patch b, offsets[num_patches] = num_zones
+*   RAJA::forall_batched<RAJA::omp_parallel_for_exec>(
+*       num_patches, offsets, [=](RAJA::Index_type b, RAJA::Index_type z) {
+*         u[z] += dt[b] * du[z];
+*       });
+*
+* \endverbatim
+*
+* \param[in] p Execution policy
+* \param[in] num_batches Number of batches
+* \param[in] offsets Random-access iterator to num_batches + 1
+*            non-decreasing offsets
+* \param[in] body Callable taking the batch id and the index
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename OffsetIter, typename Body>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<OffsetIter>>
+forall_batched(const ExecPolicy &p,
+               Index_type num_batches,
+               OffsetIter offsets,
+               Body body)
+{
+  static_assert(type_traits::is_random_access_iterator<OffsetIter>::value,
+                "Offset iterator must model RandomAccessIterator");
+  if (num_batches <= 0) return;
+
+  const Index_type base = static_cast<Index_type>(offsets[0]);
+  const Index_type num_items =
+      static_cast<Index_type>(offsets[num_batches]) - base;
+  const Index_type path = num_batches + num_items;
+  const Index_type num_parts = detail::partition_count(p, path, 1);
+
+  if (num_parts <= 1) {
+    for (Index_type b = 0; b < num_batches; ++b) {
+      const Index_type hi = static_cast<Index_type>(offsets[b + 1]);
+      for (Index_type j = static_cast<Index_type>(offsets[b]); j < hi; ++j) {
+        body(b, j);
+      }
+    }
+    return;
+  }
+
+  forall<ExecPolicy>(
+      TypedRangeSegment<Index_type>(0, num_parts), [=](Index_type t) {
+        const Index_type d0 = t * path / num_parts;
+        const Index_type d1 = (t + 1) * path / num_parts;
+        const Index_type b0 =
+            detail::merge_path_search(offsets, num_batches, num_items, d0);
+        const Index_type b1 =
+            detail::merge_path_search(offsets, num_batches, num_items, d1);
+        const Index_type j1 = base + d1 - b1;
+
+        // batches ending in this partition, then the start of the one
+        // continuing past it
+        Index_type j = base + d0 - b0;
+        for (Index_type b = b0; b < b1; ++b) {
+          const Index_type hi = static_cast<Index_type>(offsets[b + 1]);
+          for (; j < hi; ++j) {
+            body(b, j);
+          }
+        }
+        for (; j < j1; ++j) {
+          body(b1, j);
+        }
+      });
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+forall_batched(Args &&... args)
+{
+  forall_batched(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
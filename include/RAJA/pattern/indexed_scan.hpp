@@ -0,0 +1,672 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing scans over TypedIndexSets and along one
+ *          axis of a multi-dimensional View.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_indexed_scan_HPP
+#define RAJA_pattern_indexed_scan_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+#include "camp/concepts.hpp"
+
+#include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/internal/Iterators.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/scan.hpp"
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/policy/sequential/policy.hpp"
+
+#include "RAJA/util/Layout.hpp"
+#include "RAJA/util/OffsetLayout.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/View.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Scan over the values data[i] of an index set, one segment at a
+ *         time, carrying the running value from each segment to the next.
+ *
+ *         Called through TypedIndexSet::segmentCall. RangeSegments scan the
+ *         contiguous values through raw pointers; other segments scan
+ *         through a gather_iterator over the segment's indices, so no
+ *         values are copied to a temporary. Out-of-place scans copy each
+ *         segment to out and scan it there.
+ *
+ ******************************************************************************
+ */
+template <typename SegExec, typename T, typename Function, bool Inclusive>
+struct IndexSetScan {
+  T const *in;
+  T *out;
+  Function f;
+  T carry;
+  bool started;
+
+  template <typename Segment>
+  void operator()(Segment const &seg)
+  {
+    using Iter = typename Segment::iterator;
+    scan(Iterators::gather_iterator<Iter, T const>(in, seg.begin()),
+         Iterators::gather_iterator<Iter, T>(out, seg.begin()),
+         static_cast<Index_type>(seg.end() - seg.begin()));
+  }
+
+  template <typename StorageT, typename DiffT>
+  void operator()(TypedRangeSegment<StorageT, DiffT> const &seg)
+  {
+    const Index_type first = static_cast<Index_type>(*seg.begin());
+    scan(in + first,
+         out + first,
+         static_cast<Index_type>(seg.end() - seg.begin()));
+  }
+
+  template <typename InIter, typename OutIter>
+  void scan(InIter src, OutIter dst, Index_type n)
+  {
+    if (n <= 0) return;
+    const T last = src[n - 1];
+    if (static_cast<void const *>(in) != static_cast<void const *>(out)) {
+      forall<SegExec>(TypedRangeSegment<Index_type>(0, n),
+                      [=](Index_type k) { dst[k] = src[k]; });
+    }
+    if (Inclusive) {
+      if (started) dst[0] = f(carry, dst[0]);
+      impl::scan::inclusive_inplace(SegExec{}, dst, dst + n, f);
+      carry = dst[n - 1];
+    } else {
+      impl::scan::exclusive_inplace(SegExec{}, dst, dst + n, f, carry);
+      carry = f(dst[n - 1], last);
+    }
+    started = true;
+  }
+};
+
+template <typename SegExec,
+          typename T,
+          typename Function,
+          bool Inclusive,
+          typename... SegmentTypes>
+RAJA_INLINE void indexset_scan(TypedIndexSet<SegmentTypes...> const &iset,
+                               T const *in,
+                               T *out,
+                               Function f,
+                               T init)
+{
+  IndexSetScan<SegExec, T, Function, Inclusive> scan{in, out, f, init, false};
+  const size_t num_segments = iset.getNumSegments();
+  for (size_t s = 0; s < num_segments; ++s) {
+    iset.segmentCall(s, scan);
+  }
+}
+
+//! Storage sizes and strides of a layout, without its index offsets.
+template <typename Range, typename IdxLin, std::ptrdiff_t StrideOneDim>
+RAJA_INLINE LayoutBase_impl<Range, IdxLin, StrideOneDim> const &dense_layout(
+    LayoutBase_impl<Range, IdxLin, StrideOneDim> const &layout)
+{
+  return layout;
+}
+
+template <typename Range, typename IdxLin>
+RAJA_INLINE LayoutBase_impl<Range, IdxLin> const &dense_layout(
+    internal::OffsetLayout_impl<Range, IdxLin> const &layout)
+{
+  return layout.base_;
+}
+
+//! Lines scanned together by one work unit of a strided axis scan.
+constexpr Index_type axis_scan_batch = 256;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  The lines of an N-dimensional array along one axis.
+ *
+ *         The dimension other than the axis with the smallest stride is the
+ *         inner dimension; the rest are outer dimensions. A work unit is a
+ *         batch of adjacent lines along the inner dimension at one outer
+ *         index. When the axis has unit stride each line is contiguous and
+ *         a unit holds a single line; otherwise a unit holds up to
+ *         axis_scan_batch lines, which are scanned together row by row so
+ *         the inner loop runs over adjacent memory.
+ *
+ ******************************************************************************
+ */
+template <size_t N>
+struct AxisLines {
+  Index_type length;
+  Index_type in_step;
+  Index_type out_step;
+  Index_type width;
+  Index_type in_inner;
+  Index_type out_inner;
+  Index_type batch;
+  Index_type num_batches;
+  Index_type num_outer;
+  int num_outer_dims;
+  Index_type outer_size[N];
+  Index_type in_outer[N];
+  Index_type out_outer[N];
+
+  bool contiguous() const { return in_step == 1 && out_step == 1; }
+  Index_type num_units() const { return num_outer * num_batches; }
+
+  //! Offsets of the first line of unit u and its range of inner indices.
+  RAJA_INLINE void unit(Index_type u,
+                        Index_type &in_off,
+                        Index_type &out_off,
+                        Index_type &j0,
+                        Index_type &j1) const
+  {
+    Index_type outer = u / num_batches;
+    j0 = (u % num_batches) * batch;
+    j1 = j0 + batch < width ? j0 + batch : width;
+    in_off = 0;
+    out_off = 0;
+    for (int d = num_outer_dims - 1; d >= 0; --d) {
+      const Index_type idx = outer % outer_size[d];
+      outer /= outer_size[d];
+      in_off += idx * in_outer[d];
+      out_off += idx * out_outer[d];
+    }
+  }
+};
+
+template <typename InLayout, typename OutLayout>
+AxisLines<InLayout::n_dims> make_axis_lines(InLayout const &in,
+                                            OutLayout const &out,
+                                            Index_type axis)
+{
+  constexpr size_t N = InLayout::n_dims;
+  static_assert(N == OutLayout::n_dims,
+                "Input and output Views must have the same rank");
+  if (axis < 0 || axis >= static_cast<Index_type>(N)) {
+    RAJA_ABORT_OR_THROW("RAJA scan: axis out of range for View");
+  }
+  for (size_t d = 0; d < N; ++d) {
+    if (in.sizes[d] != out.sizes[d]) {
+      RAJA_ABORT_OR_THROW("RAJA scan: input and output View sizes differ");
+    }
+  }
+
+  // inner dimension: smallest output stride among the non-unit dimensions
+  Index_type inner = -1;
+  for (size_t d = 0; d < N; ++d) {
+    const Index_type dd = static_cast<Index_type>(d);
+    if (dd == axis || out.sizes[d] <= 1) continue;
+    if (inner < 0 || out.strides[d] < out.strides[inner]) inner = dd;
+  }
+
+  AxisLines<N> lines;
+  lines.length = out.sizes[axis];
+  lines.in_step = in.strides[axis];
+  lines.out_step = out.strides[axis];
+  lines.width = inner < 0 ? 1 : out.sizes[inner];
+  lines.in_inner = inner < 0 ? 0 : in.strides[inner];
+  lines.out_inner = inner < 0 ? 0 : out.strides[inner];
+  lines.batch = lines.contiguous() ? 1 : axis_scan_batch;
+  lines.num_batches = (lines.width + lines.batch - 1) / lines.batch;
+  lines.num_outer = 1;
+  lines.num_outer_dims = 0;
+  for (size_t d = 0; d < N; ++d) {
+    const Index_type dd = static_cast<Index_type>(d);
+    if (dd == axis || dd == inner || out.sizes[d] <= 1) continue;
+    lines.outer_size[lines.num_outer_dims] = out.sizes[d];
+    lines.in_outer[lines.num_outer_dims] = in.strides[d];
+    lines.out_outer[lines.num_outer_dims] = out.strides[d];
+    lines.num_outer *= out.sizes[d];
+    ++lines.num_outer_dims;
+  }
+  for (size_t d = 0; d < N; ++d) {
+    if (out.sizes[d] == 0) lines.width = 0;
+  }
+  return lines;
+}
+
+/*!
+ * \brief Scan lines [j0, j1) of a unit together, one row along the axis at
+ *        a time.
+ */
+template <bool Inclusive, size_t N, typename T, typename Function>
+RAJA_INLINE void scan_line_batch(AxisLines<N> const &lines,
+                                 T const *in,
+                                 T *out,
+                                 Index_type j0,
+                                 Index_type j1,
+                                 Function f,
+                                 T value)
+{
+  const Index_type ii = lines.in_inner;
+  const Index_type oi = lines.out_inner;
+  const Index_type nj = j1 - j0;
+  in += j0 * ii;
+  out += j0 * oi;
+  if (Inclusive) {
+    if (in != out) {
+      RAJA_SIMD
+      for (Index_type j = 0; j < nj; ++j) {
+        out[j * oi] = in[j * ii];
+      }
+    }
+    for (Index_type k = 1; k < lines.length; ++k) {
+      T const *prev = out + (k - 1) * lines.out_step;
+      T const *src = in + k * lines.in_step;
+      T *dst = out + k * lines.out_step;
+      if (ii == 1 && oi == 1) {
+        RAJA_SIMD
+        for (Index_type j = 0; j < nj; ++j) {
+          dst[j] = f(prev[j], src[j]);
+        }
+      } else {
+        RAJA_SIMD
+        for (Index_type j = 0; j < nj; ++j) {
+          dst[j * oi] = f(prev[j * oi], src[j * ii]);
+        }
+      }
+    }
+  } else {
+    T carry[axis_scan_batch];
+    for (Index_type j = 0; j < nj; ++j) {
+      carry[j] = value;
+    }
+    for (Index_type k = 0; k < lines.length; ++k) {
+      T const *src = in + k * lines.in_step;
+      T *dst = out + k * lines.out_step;
+      if (ii == 1 && oi == 1) {
+        RAJA_SIMD
+        for (Index_type j = 0; j < nj; ++j) {
+          const T t = src[j];
+          dst[j] = carry[j];
+          carry[j] = f(carry[j], t);
+        }
+      } else {
+        RAJA_SIMD
+        for (Index_type j = 0; j < nj; ++j) {
+          const T t = src[j * ii];
+          dst[j * oi] = carry[j];
+          carry[j] = f(carry[j], t);
+        }
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Scan every line of in along an axis into out (possibly in place).
+ *
+ *        A single contiguous line, e.g. a 1-D View, is scanned with the
+ *        parallel scan of ExecPolicy. Otherwise the work units run in
+ *        parallel under ExecPolicy: contiguous lines with the sequential
+ *        scan on each line, strided lines in batches.
+ */
+template <typename ExecPolicy,
+          bool Inclusive,
+          size_t N,
+          typename T,
+          typename Function>
+void axis_scan(AxisLines<N> const &lines,
+               T const *in,
+               T *out,
+               Function f,
+               T value)
+{
+  if (lines.length <= 0 || lines.width <= 0) return;
+  const bool inplace = static_cast<T const *>(out) == in;
+
+  if (lines.contiguous() && lines.num_units() == 1) {
+    const Index_type n = lines.length;
+    if (!inplace) {
+      forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, n),
+                         [=](Index_type k) { out[k] = in[k]; });
+    }
+    if (Inclusive) {
+      impl::scan::inclusive_inplace(ExecPolicy{}, out, out + n, f);
+    } else {
+      impl::scan::exclusive_inplace(ExecPolicy{}, out, out + n, f, value);
+    }
+    return;
+  }
+
+  forall<ExecPolicy>(
+      TypedRangeSegment<Index_type>(0, lines.num_units()),
+      [=](Index_type u) {
+        Index_type in_off, out_off, j0, j1;
+        lines.unit(u, in_off, out_off, j0, j1);
+        if (!lines.contiguous()) {
+          scan_line_batch<Inclusive>(
+              lines, in + in_off, out + out_off, j0, j1, f, value);
+          return;
+        }
+        for (Index_type j = j0; j < j1; ++j) {
+          T const *src = in + in_off + j * lines.in_inner;
+          T *dst = out + out_off + j * lines.out_inner;
+          if (!inplace) {
+            RAJA_SIMD
+            for (Index_type k = 0; k < lines.length; ++k) {
+              dst[k] = src[k];
+            }
+          }
+          if (Inclusive) {
+            impl::scan::inclusive_inplace(
+                seq_exec{}, dst, dst + lines.length, f);
+          } else {
+            impl::scan::exclusive_inplace(
+                seq_exec{}, dst, dst + lines.length, f, value);
+          }
+        }
+      });
+}
+
+}  // namespace detail
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive in-place scan of the values data[i] for the indices i of
+*         an index set, in index set order
+*
+*         Segments are processed one after another and the running value is
+*         carried from each segment into the next; each segment is scanned
+*         with the segment execution policy of p (the segment iteration
+*         policy is not used). Indices must be distinct.
+*
+* \param[in] p IndexSet execution policy
+* \param[in] iset Index set
+* \param[in,out] data Pointer to the values addressed by iset
+* \param[in] binop binary function to apply for scan
+*
+******************************************************************************
+*/
+template <typename SegIterPolicy,
+          typename SegExecPolicy,
+          typename... SegmentTypes,
+          typename T,
+          typename Function = operators::plus<T>>
+void inclusive_scan_inplace(const ExecPolicy<SegIterPolicy, SegExecPolicy> &,
+                            const TypedIndexSet<SegmentTypes...> &iset,
+                            T *data,
+                            Function binop = Function{})
+{
+  static_assert(type_traits::is_binary_function<Function, T, T, T>::value,
+                "Function must model BinaryFunction");
+  detail::indexset_scan<SegExecPolicy, T, Function, true>(
+      iset, data, data, binop, T());
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive in-place scan of the values data[i] for the indices i of
+*         an index set, in index set order, starting from value
+*
+******************************************************************************
+*/
+template <typename SegIterPolicy,
+          typename SegExecPolicy,
+          typename... SegmentTypes,
+          typename T,
+          typename Function = operators::plus<T>>
+void exclusive_scan_inplace(const ExecPolicy<SegIterPolicy, SegExecPolicy> &,
+                            const TypedIndexSet<SegmentTypes...> &iset,
+                            T *data,
+                            Function binop = Function{},
+                            T value = Function::identity())
+{
+  static_assert(type_traits::is_binary_function<Function, T, T, T>::value,
+                "Function must model BinaryFunction");
+  detail::indexset_scan<SegExecPolicy, T, Function, false>(
+      iset, data, data, binop, value);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive scan of in[i] into out[i] for the indices i of an index
+*         set, in index set order
+*
+******************************************************************************
+*/
+template <typename SegIterPolicy,
+          typename SegExecPolicy,
+          typename... SegmentTypes,
+          typename T,
+          typename Function = operators::plus<T>>
+void inclusive_scan(const ExecPolicy<SegIterPolicy, SegExecPolicy> &,
+                    const TypedIndexSet<SegmentTypes...> &iset,
+                    const T *in,
+                    T *out,
+                    Function binop = Function{})
+{
+  static_assert(type_traits::is_binary_function<Function, T, T, T>::value,
+                "Function must model BinaryFunction");
+  detail::indexset_scan<SegExecPolicy, T, Function, true>(
+      iset, in, out, binop, T());
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive scan of in[i] into out[i] for the indices i of an index
+*         set, in index set order, starting from value
+*
+******************************************************************************
+*/
+template <typename SegIterPolicy,
+          typename SegExecPolicy,
+          typename... SegmentTypes,
+          typename T,
+          typename Function = operators::plus<T>>
+void exclusive_scan(const ExecPolicy<SegIterPolicy, SegExecPolicy> &,
+                    const TypedIndexSet<SegmentTypes...> &iset,
+                    const T *in,
+                    T *out,
+                    Function binop = Function{},
+                    T value = Function::identity())
+{
+  static_assert(type_traits::is_binary_function<Function, T, T, T>::value,
+                "Function must model BinaryFunction");
+  detail::indexset_scan<SegExecPolicy, T, Function, false>(
+      iset, in, out, binop, value);
+}
+
+// =============================================================================
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive in-place scan of every line of a View along one axis
+*
+*         Lines run in parallel under p. Lines along a unit-stride axis are
+*         scanned one by one through raw pointers; lines along a strided
+*         axis are scanned in batches of adjacent lines, a row at a time.
+*         A one-dimensional View uses the parallel scan of p. No temporary
+*         copy of the data is made. Offset layouts scan their whole index
+*         range.
+*
+* \param[in] p Execution policy
+* \param[in,out] view View over raw pointer data
+* \param[in] axis Dimension to scan along
+* \param[in] binop binary function to apply for scan
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename ValueType,
+          typename LayoutType,
+          typename Function =
+              operators::plus<typename std::remove_cv<ValueType>::type>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+inclusive_scan_inplace(const ExecPolicy &,
+                       const View<ValueType, LayoutType> &view,
+                       Index_type axis,
+                       Function binop = Function{})
+{
+  using T = typename std::remove_cv<ValueType>::type;
+  static_assert(type_traits::is_binary_function<Function, T, T, T>::value,
+                "Function must model BinaryFunction");
+  auto const &layout = detail::dense_layout(view.layout);
+  detail::axis_scan<ExecPolicy, true>(
+      detail::make_axis_lines(layout, layout, axis),
+      view.data,
+      view.data,
+      binop,
+      T());
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive in-place scan of every line of a View along one axis,
+*         each line starting from value
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename ValueType,
+          typename LayoutType,
+          typename T = typename std::remove_cv<ValueType>::type,
+          typename Function = operators::plus<T>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+exclusive_scan_inplace(const ExecPolicy &,
+                       const View<ValueType, LayoutType> &view,
+                       Index_type axis,
+                       Function binop = Function{},
+                       T value = Function::identity())
+{
+  using R = typename std::remove_cv<ValueType>::type;
+  static_assert(type_traits::is_binary_function<Function, R, R, R>::value,
+                "Function must model BinaryFunction");
+  auto const &layout = detail::dense_layout(view.layout);
+  detail::axis_scan<ExecPolicy, false>(
+      detail::make_axis_lines(layout, layout, axis),
+      view.data,
+      view.data,
+      binop,
+      static_cast<R>(value));
+}
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive scan of every line of a View along one axis into the
+*         same line of another View with the same sizes
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename InValueType,
+          typename InLayoutType,
+          typename ValueType,
+          typename LayoutType,
+          typename Function = operators::plus<ValueType>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+inclusive_scan(const ExecPolicy &,
+               const View<InValueType, InLayoutType> &in,
+               const View<ValueType, LayoutType> &out,
+               Index_type axis,
+               Function binop = Function{})
+{
+  static_assert(
+      std::is_same<typename std::remove_cv<InValueType>::type,
+                   ValueType>::value,
+      "Input and output Views must have the same value type");
+  static_assert(type_traits::is_binary_function<Function,
+                                                ValueType,
+                                                ValueType,
+                                                ValueType>::value,
+                "Function must model BinaryFunction");
+  detail::axis_scan<ExecPolicy, true>(
+      detail::make_axis_lines(detail::dense_layout(in.layout),
+                              detail::dense_layout(out.layout),
+                              axis),
+      static_cast<ValueType const *>(in.data),
+      out.data,
+      binop,
+      ValueType());
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive scan of every line of a View along one axis into the
+*         same line of another View with the same sizes, each line starting
+*         from value
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename InValueType,
+          typename InLayoutType,
+          typename ValueType,
+          typename LayoutType,
+          typename T = ValueType,
+          typename Function = operators::plus<T>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+exclusive_scan(const ExecPolicy &,
+               const View<InValueType, InLayoutType> &in,
+               const View<ValueType, LayoutType> &out,
+               Index_type axis,
+               Function binop = Function{},
+               T value = Function::identity())
+{
+  static_assert(
+      std::is_same<typename std::remove_cv<InValueType>::type,
+                   ValueType>::value,
+      "Input and output Views must have the same value type");
+  static_assert(type_traits::is_binary_function<Function,
+                                                ValueType,
+                                                ValueType,
+                                                ValueType>::value,
+                "Function must model BinaryFunction");
+  detail::axis_scan<ExecPolicy, false>(
+      detail::make_axis_lines(detail::dense_layout(in.layout),
+                              detail::dense_layout(out.layout),
+                              axis),
+      static_cast<ValueType const *>(in.data),
+      out.data,
+      binop,
+      static_cast<ValueType>(value));
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,115 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the kernel ForUnroll statement.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#ifndef RAJA_pattern_kernel_ForUnroll_HPP
+#define RAJA_pattern_kernel_ForUnroll_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cassert>
+#include <type_traits>
+
+#include "RAJA/pattern/kernel/For.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/policy/sequential/policy.hpp"
+
+namespace RAJA
+{
+
+namespace statement
+{
+
+
+/*!
+ * A RAJA::kernel statement that implements a fully unrolled loop over a
+ * segment whose length is the compile-time constant Extent, for instance
+ * static_extent<StaticViewType, D>::value.
+ * Assigns the loop iterate to argument ArgumentId
+ *
+ */
+template <camp::idx_t ArgumentId, camp::idx_t Extent, typename... EnclosedStmts>
+struct ForUnroll : public internal::ForList,
+                   public internal::ForTraitBase<ArgumentId, seq_exec>,
+                   public internal::Statement<seq_exec, EnclosedStmts...> {
+  static_assert(Extent >= 0, "ForUnroll extent must not be negative");
+};
+
+
+}  // end namespace statement
+
+namespace internal
+{
+
+template <camp::idx_t I, camp::idx_t N>
+struct UnrolledFor {
+  template <typename Wrapper>
+  static RAJA_INLINE void exec(Wrapper &wrapper)
+  {
+    wrapper(static_cast<Index_type>(I));
+    UnrolledFor<I + 1, N>::exec(wrapper);
+  }
+};
+
+template <camp::idx_t N>
+struct UnrolledFor<N, N> {
+  template <typename Wrapper>
+  static RAJA_INLINE void exec(Wrapper &)
+  {
+  }
+};
+
+
+/*!
+ * A RAJA::kernel executor for statement::ForUnroll
+ *
+ *
+ */
+template <camp::idx_t ArgumentId,
+          camp::idx_t Extent,
+          typename... EnclosedStmts>
+struct StatementExecutor<
+    statement::ForUnroll<ArgumentId, Extent, EnclosedStmts...>> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    assert(segment_length<ArgumentId>(data) == Extent
+           && "ForUnroll: segment length differs from Extent");
+
+    ForWrapper<ArgumentId, Data, EnclosedStmts...> for_wrapper(data);
+
+    UnrolledFor<0, Extent>::exec(for_wrapper);
+  }
+};
+
+
+}  // namespace internal
+}  // end namespace RAJA
+
+
+#endif /* RAJA_pattern_kernel_ForUnroll_HPP */
@@ -356,19 +356,20 @@ template <typename T>
 struct NestedPrivatizer {
   using data_t = typename T::data_t;
   using value_type = camp::decay<T>;
-  using reference_type = value_type &;
 
   data_t privatized_data;
-  value_type privatized_wrapper;
 
   RAJA_INLINE
   constexpr NestedPrivatizer(const T &o)
-      : privatized_data{o.data}, privatized_wrapper(privatized_data)
+      : privatized_data{o.data}
   {
   }
 
+  // The wrapper is built on demand rather than stored next to the data it
+  // refers to: a self-referencing privatizer keeps the compiler from
+  // promoting the LoopData offsets to registers inside parallel regions.
   RAJA_INLINE
-  reference_type get_priv() { return privatized_wrapper; }
+  value_type get_priv() { return value_type(privatized_data); }
 };
 
 
@@ -0,0 +1,594 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing merge and set operations on sorted ranges
+ *          with merge-path partitioning.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_merge_HPP
+#define RAJA_pattern_merge_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+#include "camp/concepts.hpp"
+
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/internal/ThreadUtils_CPU.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/scan.hpp"
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/policy/sequential/policy.hpp"
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! Most partitions a merge splits its input into; the per-partition
+//! output offsets live on the stack.
+constexpr int max_merge_parts = 256;
+
+//! Return type of the buffer merge and set operations: the output size.
+template <typename ExecPolicy, typename... Iters>
+using enable_if_merge = typename std::enable_if<
+    concepts::all_of<type_traits::is_execution_policy<ExecPolicy>,
+                     type_traits::is_iterator<Iters>...>::value,
+    Index_type>::type;
+
+//! Index type of the list segment built from container C.
+template <typename C>
+using SegmentValue = camp::decay<type_traits::IterableValue<C>>;
+
+//! Return type of the merge and set operations on containers.
+template <typename ExecPolicy, typename ContainerA, typename ContainerB>
+using enable_if_merge_segment = typename std::enable_if<
+    concepts::all_of<type_traits::is_execution_policy<ExecPolicy>,
+                     type_traits::is_range<ContainerA>,
+                     type_traits::is_range<ContainerB>>::value,
+    TypedListSegment<SegmentValue<ContainerA>>>::type;
+
+/*!
+ * \brief Merge-path search: the number of elements of a among the first
+ *        diag elements of the stable merge of a[0, na) and b[0, nb), in
+ *        which elements of a precede equal elements of b.
+ */
+template <typename IterA, typename IterB, typename Compare>
+RAJA_INLINE Index_type merge_split(IterA a,
+                                   Index_type na,
+                                   IterB b,
+                                   Index_type nb,
+                                   Index_type diag,
+                                   Compare comp)
+{
+  Index_type lo = diag > nb ? diag - nb : 0;
+  Index_type hi = diag < na ? diag : na;
+  while (lo < hi) {
+    const Index_type mid = lo + (hi - lo) / 2;
+    if (comp(b[diag - 1 - mid], a[mid])) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+  return lo;
+}
+
+/*!
+ * \brief Split a and b before the first element not less than element
+ *        diag of their merge, so runs of equivalent elements are never
+ *        cut and each side can run a set operation on its own.
+ */
+template <typename IterA, typename IterB, typename Compare>
+RAJA_INLINE void key_split(IterA a,
+                           Index_type na,
+                           IterB b,
+                           Index_type nb,
+                           Index_type diag,
+                           Compare comp,
+                           Index_type &i,
+                           Index_type &j)
+{
+  i = merge_split(a, na, b, nb, diag, comp);
+  j = diag - i;
+  if (i < na && (j >= nb || !comp(b[j], a[i]))) {
+    auto const &key = a[i];
+    i = std::lower_bound(a, a + na, key, comp) - a;
+    j = std::lower_bound(b, b + nb, key, comp) - b;
+  } else if (j < nb) {
+    auto const &key = b[j];
+    i = std::lower_bound(a, a + na, key, comp) - a;
+    j = std::lower_bound(b, b + nb, key, comp) - b;
+  }
+}
+
+//! Sequential stable merge of a[i, ie) and b[j, je) into out[r, ...).
+template <typename IterA, typename IterB, typename OutIter, typename Compare>
+RAJA_INLINE void merge_range(IterA a,
+                             Index_type i,
+                             Index_type ie,
+                             IterB b,
+                             Index_type j,
+                             Index_type je,
+                             OutIter out,
+                             Index_type r,
+                             Compare comp)
+{
+  while (i < ie && j < je) {
+    if (comp(b[j], a[i])) {
+      out[r++] = b[j++];
+    } else {
+      out[r++] = a[i++];
+    }
+  }
+  for (; i < ie; ++i) {
+    out[r++] = a[i];
+  }
+  for (; j < je; ++j) {
+    out[r++] = b[j];
+  }
+}
+
+//! Which elements a set operation keeps: those only in a, those only in
+//! b and, for matched pairs, the element from a.
+template <bool AOnly, bool BOnly, bool Both>
+struct set_operation {
+  static constexpr bool a_only = AOnly;
+  static constexpr bool b_only = BOnly;
+  static constexpr bool both = Both;
+};
+
+using set_union_op = set_operation<true, true, true>;
+using set_intersection_op = set_operation<false, false, true>;
+using set_difference_op = set_operation<true, false, false>;
+
+/*!
+ * \brief Run set operation Op on a[i, ie) and b[j, je), writing the
+ *        result to out[r, ...) if Write; returns the result size.
+ */
+template <typename Op,
+          bool Write,
+          typename IterA,
+          typename IterB,
+          typename OutIter,
+          typename Compare>
+RAJA_INLINE Index_type set_range(IterA a,
+                                 Index_type i,
+                                 Index_type ie,
+                                 IterB b,
+                                 Index_type j,
+                                 Index_type je,
+                                 OutIter out,
+                                 Index_type r,
+                                 Compare comp)
+{
+  const Index_type r0 = r;
+  while (i < ie && j < je) {
+    if (comp(a[i], b[j])) {
+      if (Op::a_only) {
+        if (Write) out[r] = a[i];
+        ++r;
+      }
+      ++i;
+    } else if (comp(b[j], a[i])) {
+      if (Op::b_only) {
+        if (Write) out[r] = b[j];
+        ++r;
+      }
+      ++j;
+    } else {
+      if (Op::both) {
+        if (Write) out[r] = a[i];
+        ++r;
+      }
+      ++i;
+      ++j;
+    }
+  }
+  if (Op::a_only) {
+    for (; i < ie; ++i, ++r) {
+      if (Write) out[r] = a[i];
+    }
+  }
+  if (Op::b_only) {
+    for (; j < je; ++j, ++r) {
+      if (Write) out[r] = b[j];
+    }
+  }
+  return r - r0;
+}
+
+/*!
+ * \brief Fill offsets[0..parts] with the output position of each of parts
+ *        key-aligned partitions of set operation Op, followed by the
+ *        output size: results are counted per partition in parallel and
+ *        the counts turned into offsets by an exclusive scan.
+ */
+template <typename Op,
+          typename ExecPolicy,
+          typename IterA,
+          typename IterB,
+          typename Compare>
+RAJA_INLINE void set_offsets(IterA a,
+                             Index_type na,
+                             IterB b,
+                             Index_type nb,
+                             Compare comp,
+                             int parts,
+                             Index_type *offsets)
+{
+  using T = IterVal<IterA>;
+  const Index_type n = na + nb;
+  forall<ExecPolicy>(
+      TypedRangeSegment<Index_type>(0, parts), [=](Index_type t) {
+        Index_type i0, j0, i1, j1;
+        key_split(a, na, b, nb, t * n / parts, comp, i0, j0);
+        key_split(a, na, b, nb, (t + 1) * n / parts, comp, i1, j1);
+        offsets[t] = set_range<Op, false>(
+            a, i0, i1, b, j0, j1, static_cast<T *>(nullptr), 0, comp);
+      });
+  offsets[parts] = 0;
+  exclusive_scan_inplace<seq_exec>(offsets, offsets + parts + 1);
+}
+
+//! Write set operation Op per partition at the offsets from set_offsets.
+template <typename Op,
+          typename ExecPolicy,
+          typename IterA,
+          typename IterB,
+          typename OutIter,
+          typename Compare>
+RAJA_INLINE void set_fill(IterA a,
+                          Index_type na,
+                          IterB b,
+                          Index_type nb,
+                          OutIter out,
+                          Compare comp,
+                          int parts,
+                          const Index_type *offsets)
+{
+  const Index_type n = na + nb;
+  forall<ExecPolicy>(
+      TypedRangeSegment<Index_type>(0, parts), [=](Index_type t) {
+        Index_type i0, j0, i1, j1;
+        key_split(a, na, b, nb, t * n / parts, comp, i0, j0);
+        key_split(a, na, b, nb, (t + 1) * n / parts, comp, i1, j1);
+        set_range<Op, true>(a, i0, i1, b, j0, j1, out, offsets[t], comp);
+      });
+}
+
+//! Set operation Op into a buffer; returns the output size.
+template <typename Op,
+          typename ExecPolicy,
+          typename IterA,
+          typename IterB,
+          typename OutIter,
+          typename Compare>
+RAJA_INLINE Index_type set_to_buffer(const ExecPolicy &p,
+                                     IterA a,
+                                     Index_type na,
+                                     IterB b,
+                                     Index_type nb,
+                                     OutIter out,
+                                     Compare comp)
+{
+  const int parts =
+      partition_count(p, na + nb, min_partition_size, max_merge_parts);
+  if (parts == 1) {
+    return set_range<Op, true>(a, 0, na, b, 0, nb, out, 0, comp);
+  }
+  Index_type offsets[max_merge_parts + 1];
+  set_offsets<Op, ExecPolicy>(a, na, b, nb, comp, parts, offsets);
+  set_fill<Op, ExecPolicy>(a, na, b, nb, out, comp, parts, offsets);
+  return offsets[parts];
+}
+
+//! Set operation Op into a new list segment of exactly the output size.
+template <typename Op,
+          typename ExecPolicy,
+          typename ContainerA,
+          typename ContainerB,
+          typename Compare>
+RAJA_INLINE TypedListSegment<SegmentValue<ContainerA>>
+set_to_segment(const ExecPolicy &p,
+               ContainerA const &a,
+               ContainerB const &b,
+               Compare comp)
+{
+  using T = detail::SegmentValue<ContainerA>;
+  const Index_type na = a.end() - a.begin();
+  const Index_type nb = b.end() - b.begin();
+  const int parts =
+      partition_count(p, na + nb, min_partition_size, max_merge_parts);
+  Index_type offsets[max_merge_parts + 1];
+  set_offsets<Op, ExecPolicy>(
+      a.begin(), na, b.begin(), nb, comp, parts, offsets);
+  TypedListSegment<T> segment(offsets[parts], ListUninitialized{});
+  set_fill<Op, ExecPolicy>(
+      a.begin(), na, b.begin(), nb, segment.begin(), comp, parts, offsets);
+  return segment;
+}
+
+}  // namespace detail
+
+/*!
+******************************************************************************
+*
+* \brief  Stable merge of the sorted ranges [a_begin, a_end) and
+*         [b_begin, b_end) into out; returns the number of elements
+*         written. Elements of a precede equivalent elements of b.
+*
+*         Parallel policies split the merged output into equal parts and
+*         locate each part's start in both inputs by a binary search along
+*         its merge-path diagonal, so every thread merges the same number
+*         of elements. out must not overlap the inputs.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename IterA,
+          typename IterB,
+          typename OutIter,
+          typename Compare = operators::less<detail::IterVal<IterA>>>
+detail::enable_if_merge<ExecPolicy, IterA, IterB, OutIter> merge(
+    const ExecPolicy &p,
+    IterA a_begin,
+    IterA a_end,
+    IterB b_begin,
+    IterB b_end,
+    OutIter out,
+    Compare comp = Compare{})
+{
+  static_assert(type_traits::is_random_access_iterator<IterA>::value,
+                "Input iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterB>::value,
+                "Input iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<OutIter>::value,
+                "Output iterator must model RandomAccessIterator");
+  const Index_type na = a_end - a_begin;
+  const Index_type nb = b_end - b_begin;
+  const Index_type n = na + nb;
+  const int parts = detail::partition_count(
+      p, n, detail::min_partition_size, detail::max_merge_parts);
+  if (parts == 1) {
+    detail::merge_range(a_begin, 0, na, b_begin, 0, nb, out, 0, comp);
+    return n;
+  }
+  forall<ExecPolicy>(
+      TypedRangeSegment<Index_type>(0, parts), [=](Index_type t) {
+        const Index_type d0 = t * n / parts;
+        const Index_type d1 = (t + 1) * n / parts;
+        const Index_type i0 =
+            detail::merge_split(a_begin, na, b_begin, nb, d0, comp);
+        const Index_type i1 =
+            detail::merge_split(a_begin, na, b_begin, nb, d1, comp);
+        detail::merge_range(
+            a_begin, i0, i1, b_begin, d0 - i0, d1 - i1, out, d0, comp);
+      });
+  return n;
+}
+
+/*!
+******************************************************************************
+*
+* \brief  Set union of the sorted ranges [a_begin, a_end) and
+*         [b_begin, b_end) into out, with std::set_union semantics for
+*         repeated elements; returns the number of elements written.
+*
+*         Parallel policies cut the inputs at merge-path diagonals moved
+*         back to the start of a run of equivalent elements, count each
+*         part's output, scan the counts into offsets and then write the
+*         parts in parallel. out needs room for the whole output (at most
+*         the sum of the input sizes) and must not overlap the inputs.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename IterA,
+          typename IterB,
+          typename OutIter,
+          typename Compare = operators::less<detail::IterVal<IterA>>>
+detail::enable_if_merge<ExecPolicy, IterA, IterB, OutIter> set_union(
+    const ExecPolicy &p,
+    IterA a_begin,
+    IterA a_end,
+    IterB b_begin,
+    IterB b_end,
+    OutIter out,
+    Compare comp = Compare{})
+{
+  return detail::set_to_buffer<detail::set_union_op>(
+      p, a_begin, a_end - a_begin, b_begin, b_end - b_begin, out, comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  Set intersection of two sorted ranges into out, taking elements
+*         from a; returns the number of elements written. Partitioned as
+*         set_union.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename IterA,
+          typename IterB,
+          typename OutIter,
+          typename Compare = operators::less<detail::IterVal<IterA>>>
+detail::enable_if_merge<ExecPolicy, IterA, IterB, OutIter> set_intersection(
+    const ExecPolicy &p,
+    IterA a_begin,
+    IterA a_end,
+    IterB b_begin,
+    IterB b_end,
+    OutIter out,
+    Compare comp = Compare{})
+{
+  return detail::set_to_buffer<detail::set_intersection_op>(
+      p, a_begin, a_end - a_begin, b_begin, b_end - b_begin, out, comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  Elements of sorted range a not in sorted range b, written to out;
+*         returns the number of elements written. Partitioned as
+*         set_union.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename IterA,
+          typename IterB,
+          typename OutIter,
+          typename Compare = operators::less<detail::IterVal<IterA>>>
+detail::enable_if_merge<ExecPolicy, IterA, IterB, OutIter> set_difference(
+    const ExecPolicy &p,
+    IterA a_begin,
+    IterA a_end,
+    IterB b_begin,
+    IterB b_end,
+    OutIter out,
+    Compare comp = Compare{})
+{
+  return detail::set_to_buffer<detail::set_difference_op>(
+      p, a_begin, a_end - a_begin, b_begin, b_end - b_begin, out, comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  Merge and set operations on sorted containers (such as
+*         TypedListSegments or std::vectors), returning a new
+*         TypedListSegment sized to the result.
+*
+*         The result is written in place into the segment's storage; set
+*         operations count their output first so the segment is allocated
+*         once at its exact size.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename ContainerA,
+          typename ContainerB,
+          typename Compare =
+              operators::less<detail::SegmentValue<ContainerA>>>
+detail::enable_if_merge_segment<ExecPolicy, ContainerA, ContainerB> merge(
+    const ExecPolicy &p,
+    ContainerA const &a,
+    ContainerB const &b,
+    Compare comp = Compare{})
+{
+  using T = detail::SegmentValue<ContainerA>;
+  TypedListSegment<T> segment((a.end() - a.begin()) + (b.end() - b.begin()),
+                              ListUninitialized{});
+  RAJA::merge(
+      p, a.begin(), a.end(), b.begin(), b.end(), segment.begin(), comp);
+  return segment;
+}
+
+template <typename ExecPolicy,
+          typename ContainerA,
+          typename ContainerB,
+          typename Compare =
+              operators::less<detail::SegmentValue<ContainerA>>>
+detail::enable_if_merge_segment<ExecPolicy, ContainerA, ContainerB> set_union(
+    const ExecPolicy &p,
+    ContainerA const &a,
+    ContainerB const &b,
+    Compare comp = Compare{})
+{
+  return detail::set_to_segment<detail::set_union_op>(p, a, b, comp);
+}
+
+template <typename ExecPolicy,
+          typename ContainerA,
+          typename ContainerB,
+          typename Compare =
+              operators::less<detail::SegmentValue<ContainerA>>>
+detail::enable_if_merge_segment<ExecPolicy, ContainerA, ContainerB>
+set_intersection(const ExecPolicy &p,
+                 ContainerA const &a,
+                 ContainerB const &b,
+                 Compare comp = Compare{})
+{
+  return detail::set_to_segment<detail::set_intersection_op>(p, a, b, comp);
+}
+
+template <typename ExecPolicy,
+          typename ContainerA,
+          typename ContainerB,
+          typename Compare =
+              operators::less<detail::SegmentValue<ContainerA>>>
+detail::enable_if_merge_segment<ExecPolicy, ContainerA, ContainerB>
+set_difference(const ExecPolicy &p,
+               ContainerA const &a,
+               ContainerB const &b,
+               Compare comp = Compare{})
+{
+  return detail::set_to_segment<detail::set_difference_op>(p, a, b, comp);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto merge(Args &&... args)
+    -> decltype(RAJA::merge(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return RAJA::merge(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto set_union(Args &&... args)
+    -> decltype(RAJA::set_union(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return RAJA::set_union(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto set_intersection(Args &&... args) -> decltype(
+    RAJA::set_intersection(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return RAJA::set_intersection(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto set_difference(Args &&... args) -> decltype(
+    RAJA::set_difference(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return RAJA::set_difference(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
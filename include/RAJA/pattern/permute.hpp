@@ -0,0 +1,254 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing gather, scatter and in-place
+ *          permutation of several arrays by one index permutation.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_permute_HPP
+#define RAJA_pattern_permute_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "camp/camp.hpp"
+#include "camp/concepts.hpp"
+#include "camp/tuple.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+template <typename Iter>
+using permute_val = typename std::iterator_traits<Iter>::value_type;
+
+//! One pass over the permutation for a single array.
+template <bool Scatter,
+          typename ExecPolicy,
+          typename IndexIter,
+          typename InIter,
+          typename OutIter>
+RAJA_INLINE void permute_array(IndexIter perm,
+                               Index_type n,
+                               InIter in,
+                               OutIter out)
+{
+  if (Scatter) {
+    forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, n),
+                       [=](Index_type j) { out[perm[j]] = in[j]; });
+  } else {
+    forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, n),
+                       [=](Index_type j) { out[j] = in[perm[j]]; });
+  }
+}
+
+//! Permute every array pair (get<I>(ins), get<I>(outs)) in turn.
+template <bool Scatter,
+          typename ExecPolicy,
+          typename IndexIter,
+          typename Ins,
+          typename Outs,
+          camp::idx_t... I>
+RAJA_INLINE void permute(IndexIter perm,
+                         Index_type n,
+                         Ins const &ins,
+                         Outs const &outs,
+                         camp::idx_seq<I...>)
+{
+  camp::sink((permute_array<Scatter, ExecPolicy>(
+                  perm, n, camp::get<I>(ins), camp::get<I>(outs)),
+              0)...);
+}
+
+//! Gather one array into a temporary and copy it back.
+template <typename ExecPolicy, typename IndexIter, typename Iter>
+RAJA_INLINE void apply_permutation_array(IndexIter perm,
+                                         Index_type n,
+                                         Iter array)
+{
+  std::vector<permute_val<Iter>> scratch(n);
+  auto tmp = scratch.data();
+  permute_array<false, ExecPolicy>(perm, n, array, tmp);
+  forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, n),
+                     [=](Index_type j) { array[j] = tmp[j]; });
+}
+
+template <typename ExecPolicy,
+          typename IndexIter,
+          typename Arrays,
+          camp::idx_t... I>
+RAJA_INLINE void apply_permutation(IndexIter perm,
+                                   Index_type n,
+                                   Arrays const &arrays,
+                                   camp::idx_seq<I...>)
+{
+  camp::sink((apply_permutation_array<ExecPolicy>(
+                  perm, n, camp::get<I>(arrays)),
+              0)...);
+}
+
+}  // namespace detail
+
+/*!
+******************************************************************************
+*
+* \brief  Gather several arrays through one permutation:
+*         get<k>(outs)[i] = get<k>(ins)[perm[i]] for i in [0, n) and every
+*         array k, where n = perm_end - perm_begin.
+*
+*         Each array gets its own pass over the permutation, distributed
+*         over threads by the execution policy. The output arrays must not
+*         overlap the inputs.
+*
+*         Usage example:
+*
+* \verbatim
+*
+*   RAJA::gather<RAJA::omp_parallel_for_exec>(
+*       perm, perm + n,
+*       RAJA::make_tuple(density, energy, material),
+*       RAJA::make_tuple(new_density, new_energy, new_material));
+*
+* \endverbatim
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename IndexIter,
+          typename... Ins,
+          typename... Outs>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<IndexIter>>
+gather(const ExecPolicy &,
+       IndexIter perm_begin,
+       IndexIter perm_end,
+       camp::tuple<Ins...> const &ins,
+       camp::tuple<Outs...> const &outs)
+{
+  static_assert(sizeof...(Ins) == sizeof...(Outs),
+                "gather requires as many output arrays as input arrays");
+  detail::permute<false, ExecPolicy>(
+      perm_begin,
+      perm_end - perm_begin,
+      ins,
+      outs,
+      camp::make_idx_seq_t<sizeof...(Ins)>{});
+}
+
+/*!
+******************************************************************************
+*
+* \brief  Scatter several arrays through one permutation:
+*         get<k>(outs)[perm[i]] = get<k>(ins)[i] for i in [0, n) and every
+*         array k, one pass per array as gather. perm must not repeat an
+*         index.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename IndexIter,
+          typename... Ins,
+          typename... Outs>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<IndexIter>>
+scatter(const ExecPolicy &,
+        IndexIter perm_begin,
+        IndexIter perm_end,
+        camp::tuple<Ins...> const &ins,
+        camp::tuple<Outs...> const &outs)
+{
+  static_assert(sizeof...(Ins) == sizeof...(Outs),
+                "scatter requires as many output arrays as input arrays");
+  detail::permute<true, ExecPolicy>(
+      perm_begin,
+      perm_end - perm_begin,
+      ins,
+      outs,
+      camp::make_idx_seq_t<sizeof...(Ins)>{});
+}
+
+/*!
+******************************************************************************
+*
+* \brief  Permute several arrays in place with the gather convention:
+*         afterwards get<k>(arrays)[i] holds the old value at perm[i].
+*
+*         Each array in turn is gathered into a temporary of n elements,
+*         as by gather, then copied back in parallel.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename IndexIter, typename... Arrays>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<IndexIter>>
+apply_permutation(const ExecPolicy &,
+                  IndexIter perm_begin,
+                  IndexIter perm_end,
+                  camp::tuple<Arrays...> const &arrays)
+{
+  detail::apply_permutation<ExecPolicy>(
+      perm_begin,
+      perm_end - perm_begin,
+      arrays,
+      camp::make_idx_seq_t<sizeof...(Arrays)>{});
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>> gather(
+    Args &&... args)
+{
+  RAJA::gather(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>> scatter(
+    Args &&... args)
+{
+  RAJA::scatter(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+apply_permutation(Args &&... args)
+{
+  RAJA::apply_permutation(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,369 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing unique, run-length encoding and
+ *          reduce_by_key over runs of equal keys.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_run_length_HPP
+#define RAJA_pattern_run_length_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+#include <utility>
+
+#include "camp/concepts.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/internal/ThreadUtils_CPU.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/scan.hpp"
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/policy/sequential/policy.hpp"
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! Most partitions a run algorithm splits its input into; the
+//! per-partition bookkeeping lives on the stack so nothing is allocated.
+constexpr int max_run_parts = 256;
+
+//! Return type of the run algorithms: the number of runs.
+template <typename ExecPolicy, typename... Iters>
+using enable_if_runs = typename std::enable_if<
+    concepts::all_of<type_traits::is_execution_policy<ExecPolicy>,
+                     type_traits::is_iterator<Iters>...>::value,
+    Index_type>::type;
+
+/*!
+ * \brief Fill offsets[0..parts] with the index of the first run starting
+ *        in each of parts equal partitions of keys[0, n), followed by the
+ *        total number of runs.
+ *
+ *        Runs are counted per partition in parallel and the counts turned
+ *        into offsets by an exclusive scan.
+ */
+template <typename ExecPolicy, typename KeyIter, typename EqOp>
+RAJA_INLINE void count_runs(KeyIter keys,
+                            Index_type n,
+                            int parts,
+                            EqOp eq,
+                            Index_type *offsets)
+{
+  forall<ExecPolicy>(
+      TypedRangeSegment<Index_type>(0, parts), [=](Index_type t) {
+        const Index_type lo = t * n / parts;
+        const Index_type hi = (t + 1) * n / parts;
+        Index_type count = lo == 0 ? 1 : 0;
+        for (Index_type i = lo == 0 ? 1 : lo; i < hi; ++i) {
+          count += eq(keys[i - 1], keys[i]) ? 0 : 1;
+        }
+        offsets[t] = count;
+      });
+  offsets[parts] = 0;
+  exclusive_scan_inplace<seq_exec>(offsets, offsets + parts + 1);
+}
+
+/*!
+ * \brief Reduce value(i) over each run of keys[0, n) into vals_out,
+ *        writing the first key of each run to keys_out; return the
+ *        number of runs.
+ *
+ *        Each partition reduces the runs starting in it. Items at the
+ *        front of a partition that continue a run begun earlier are
+ *        reduced into a per-partition carry and folded into that run
+ *        afterwards, in partition order, so a long run does not unbalance
+ *        the threads and op need not be commutative.
+ */
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename KeyOut,
+          typename ValFn,
+          typename ValOut,
+          typename BinOp,
+          typename EqOp>
+RAJA_INLINE Index_type reduce_runs(const ExecPolicy &p,
+                                   KeyIter keys,
+                                   Index_type n,
+                                   KeyOut keys_out,
+                                   ValFn value,
+                                   ValOut vals_out,
+                                   BinOp op,
+                                   EqOp eq)
+{
+  using T = IterVal<ValOut>;
+  if (n <= 0) return 0;
+
+  const int parts =
+      partition_count(p, n, min_partition_size, max_run_parts);
+  Index_type offsets[max_run_parts + 1];
+  T carry[max_run_parts];
+  Index_type *offs = offsets;
+  T *carries = carry;
+
+  // reduce the runs of partition t, writing from run offs[t]; returns the
+  // index one past the last run written
+  auto reduce_part = [=](Index_type t) {
+    const Index_type lo = t * n / parts;
+    const Index_type hi = (t + 1) * n / parts;
+    Index_type r = offs[t];
+    Index_type i = lo;
+    if (lo > 0 && eq(keys[lo - 1], keys[lo])) {
+      T acc = value(i);
+      for (++i; i < hi && eq(keys[i - 1], keys[i]); ++i) {
+        acc = op(acc, value(i));
+      }
+      carries[t] = acc;
+    }
+    while (i < hi) {
+      keys_out[r] = keys[i];
+      T acc = value(i);
+      for (++i; i < hi && eq(keys[i - 1], keys[i]); ++i) {
+        acc = op(acc, value(i));
+      }
+      vals_out[r++] = acc;
+    }
+    return r;
+  };
+
+  // a single partition needs no counting pass
+  if (parts == 1) {
+    offs[0] = 0;
+    return reduce_part(0);
+  }
+
+  count_runs<ExecPolicy>(keys, n, parts, eq, offs);
+  forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, parts),
+                     [=](Index_type t) { reduce_part(t); });
+
+  for (int t = 1; t < parts; ++t) {
+    const Index_type lo = t * n / parts;
+    if (eq(keys[lo - 1], keys[lo])) {
+      vals_out[offs[t] - 1] = op(vals_out[offs[t] - 1], carries[t]);
+    }
+  }
+  return offs[parts];
+}
+
+}  // namespace detail
+
+/*!
+******************************************************************************
+*
+* \brief  Copy the first element of each run of equal consecutive elements
+*         of [begin, end) to out and return the number of runs.
+*
+*         out must have room for end - begin elements and must not overlap
+*         the input. Parallel policies count runs per partition, scan the
+*         counts and then copy in parallel; no memory is allocated.
+*
+* \param[in] p Execution policy
+* \param[in] begin Random-access iterator to the first element
+* \param[in] end Random-access iterator past the last element
+* \param[out] out Random-access iterator receiving the run heads
+* \param[in] eq Equality predicate applied to neighboring elements
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename EqOp = operators::equal_to<detail::IterVal<Iter>>>
+detail::enable_if_runs<ExecPolicy, Iter, OutIter> unique(const ExecPolicy &p,
+                                                         Iter begin,
+                                                         Iter end,
+                                                         OutIter out,
+                                                         EqOp eq = EqOp{})
+{
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Input iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<OutIter>::value,
+                "Output iterator must model RandomAccessIterator");
+  const Index_type n = end - begin;
+  if (n <= 0) return 0;
+
+  const int parts = detail::partition_count(
+      p, n, detail::min_partition_size, detail::max_run_parts);
+  Index_type offsets[detail::max_run_parts + 1];
+  Index_type *offs = offsets;
+
+  auto copy_part = [=](Index_type t) {
+    const Index_type lo = t * n / parts;
+    const Index_type hi = (t + 1) * n / parts;
+    Index_type r = offs[t];
+    for (Index_type i = lo; i < hi; ++i) {
+      if (i == 0 || !eq(begin[i - 1], begin[i])) {
+        out[r++] = begin[i];
+      }
+    }
+    return r;
+  };
+
+  if (parts == 1) {
+    offs[0] = 0;
+    return copy_part(0);
+  }
+
+  detail::count_runs<ExecPolicy>(begin, n, parts, eq, offs);
+  forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, parts),
+                     [=](Index_type t) { copy_part(t); });
+  return offs[parts];
+}
+
+/*!
+******************************************************************************
+*
+* \brief  Run-length encode [begin, end): for each run of equal consecutive
+*         elements, write its first element to keys_out and its length to
+*         counts_out. Returns the number of runs.
+*
+*         Both outputs must have room for end - begin elements. No memory
+*         is allocated.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename KeyOut,
+          typename CountOut,
+          typename EqOp = operators::equal_to<detail::IterVal<Iter>>>
+detail::enable_if_runs<ExecPolicy, Iter, KeyOut, CountOut> run_length_encode(
+    const ExecPolicy &p,
+    Iter begin,
+    Iter end,
+    KeyOut keys_out,
+    CountOut counts_out,
+    EqOp eq = EqOp{})
+{
+  using C = detail::IterVal<CountOut>;
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Input iterator must model RandomAccessIterator");
+  return detail::reduce_runs(p,
+                             begin,
+                             end - begin,
+                             keys_out,
+                             [](Index_type) { return static_cast<C>(1); },
+                             counts_out,
+                             operators::plus<C>(),
+                             eq);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  Reduce values over each run of equal consecutive keys in
+*         [keys_begin, keys_end).
+*
+*         For run r, keys_out[r] is its first key and values_out[r] the op
+*         reduction, in order, of the values paired with its keys. Returns
+*         the number of runs. Both outputs must have room for
+*         keys_end - keys_begin elements; no memory is allocated.
+*
+*         Runs split across partitions are completed by folding one carry
+*         per partition in order, so op needs to be associative but not
+*         commutative, and needs no identity.
+*
+* \param[in] p Execution policy
+* \param[in] keys_begin Random-access iterator to the first key
+* \param[in] keys_end Random-access iterator past the last key
+* \param[in] values Random-access iterator to the value of each key
+* \param[out] keys_out Random-access iterator receiving the run keys
+* \param[out] values_out Random-access iterator receiving the reductions
+* \param[in] op Associative binary reduction operator
+* \param[in] eq Equality predicate applied to neighboring keys
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename KeyOut,
+          typename ValOut,
+          typename BinOp = operators::plus<detail::IterVal<ValOut>>,
+          typename EqOp = operators::equal_to<detail::IterVal<KeyIter>>>
+detail::enable_if_runs<ExecPolicy, KeyIter, ValIter, KeyOut, ValOut>
+reduce_by_key(const ExecPolicy &p,
+              KeyIter keys_begin,
+              KeyIter keys_end,
+              ValIter values,
+              KeyOut keys_out,
+              ValOut values_out,
+              BinOp op = BinOp{},
+              EqOp eq = EqOp{})
+{
+  using T = detail::IterVal<ValOut>;
+  static_assert(type_traits::is_random_access_iterator<KeyIter>::value,
+                "Key iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<ValIter>::value,
+                "Value iterator must model RandomAccessIterator");
+  return detail::reduce_runs(p,
+                             keys_begin,
+                             keys_end - keys_begin,
+                             keys_out,
+                             [=](Index_type i) {
+                               return static_cast<T>(values[i]);
+                             },
+                             values_out,
+                             op,
+                             eq);
+}
+
+template <typename ExecPolicy, typename... Args>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value,
+                        Index_type>::type
+unique(Args &&... args)
+{
+  return RAJA::unique(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value,
+                        Index_type>::type
+run_length_encode(Args &&... args)
+{
+  return RAJA::run_length_encode(ExecPolicy{},
+                                 std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value,
+                        Index_type>::type
+reduce_by_key(Args &&... args)
+{
+  return RAJA::reduce_by_key(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -34,8 +34,10 @@
 #include "camp/concepts.hpp"
 #include "camp/helpers.hpp"
 
+#include "RAJA/index/IndexSet.hpp"
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/util/Operators.hpp"
+#include "RAJA/util/View.hpp"
 
 namespace RAJA
 {
@@ -50,6 +52,16 @@ template <typename Container>
 using ContainerVal =
     camp::decay<decltype(*camp::val<camp::iterator_from<Container>>())>;
 
+//! Ranges taken by the container overloads; index sets and Views have
+//! overloads of their own in indexed_scan.hpp. The iterator overloads
+//! exclude Views as well, since a View plus an integral axis would
+//! otherwise deduce as a begin/end/out triple.
+template <typename Container>
+using is_scan_range = concepts::all_of<
+    type_traits::is_range<Container>,
+    concepts::negate<type_traits::is_index_set<Container>>,
+    concepts::negate<type_traits::is_view<Container>>>;
+
 }  // end namespace detail
 
 /*!
@@ -70,7 +82,8 @@ template <typename ExecPolicy,
           typename Iter,
           typename Function = operators::plus<detail::IterVal<Iter>>>
 concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
-                    type_traits::is_iterator<Iter>>
+                    type_traits::is_iterator<Iter>,
+                    concepts::negate<type_traits::is_view<Iter>>>
 inclusive_scan_inplace(const ExecPolicy &p,
                        Iter begin,
                        Iter end,
@@ -103,7 +116,8 @@ template <typename ExecPolicy,
           typename T = detail::IterVal<Iter>,
           typename Function = operators::plus<T>>
 concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
-                    type_traits::is_iterator<Iter>>
+                    type_traits::is_iterator<Iter>,
+                    concepts::negate<type_traits::is_view<Iter>>>
 exclusive_scan_inplace(const ExecPolicy &p,
                        Iter begin,
                        Iter end,
@@ -142,7 +156,8 @@ template <typename ExecPolicy,
           typename Function = operators::plus<detail::IterVal<Iter>>>
 concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
                     type_traits::is_iterator<Iter>,
-                    type_traits::is_iterator<IterOut>>
+                    type_traits::is_iterator<IterOut>,
+                    concepts::negate<type_traits::is_view<Iter>>>
 inclusive_scan(const ExecPolicy &p,
                Iter begin,
                Iter end,
@@ -185,7 +200,8 @@ template <typename ExecPolicy,
           typename Function = operators::plus<T>>
 concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
                     type_traits::is_iterator<Iter>,
-                    type_traits::is_iterator<IterOut>>
+                    type_traits::is_iterator<IterOut>,
+                    concepts::negate<type_traits::is_view<Iter>>>
 exclusive_scan(const ExecPolicy &p,
                Iter begin,
                Iter end,
@@ -222,7 +238,7 @@ template <typename ExecPolicy,
           typename Container,
           typename Function = operators::plus<detail::ContainerVal<Container>>>
 concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
-                    type_traits::is_range<Container>>
+                    detail::is_scan_range<Container>>
 inclusive_scan_inplace(const ExecPolicy &p,
                        Container &c,
                        Function binop = Function{})
@@ -252,7 +268,7 @@ template <typename ExecPolicy,
           typename T = detail::ContainerVal<Container>,
           typename Function = operators::plus<T>>
 concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
-                    type_traits::is_range<Container>>
+                    detail::is_scan_range<Container>>
 exclusive_scan_inplace(const ExecPolicy &p,
                        Container &c,
                        Function binop = Function{},
@@ -289,7 +305,7 @@ template <typename ExecPolicy,
           typename IterOut,
           typename Function = operators::plus<detail::ContainerVal<Container>>>
 concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
-                    type_traits::is_range<Container>,
+                    detail::is_scan_range<Container>,
                     type_traits::is_iterator<IterOut>>
 inclusive_scan(const ExecPolicy &p,
                Container &c,
@@ -331,7 +347,7 @@ template <typename ExecPolicy,
           typename T = detail::ContainerVal<Container>,
           typename Function = operators::plus<T>>
 concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
-                    type_traits::is_range<Container>,
+                    detail::is_scan_range<Container>,
                     type_traits::is_iterator<IterOut>>
 exclusive_scan(const ExecPolicy &p,
                Container &c,
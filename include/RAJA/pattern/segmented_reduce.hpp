@@ -0,0 +1,285 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing segmented reductions over CSR-style
+ *          offset arrays and CSR sparse matrix-vector products.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_segmented_reduce_HPP
+#define RAJA_pattern_segmented_reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "camp/concepts.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/internal/ThreadUtils_CPU.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/scan.hpp"
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * \brief op-reduction of body(j) over j in [lo, hi), starting from init.
+ *
+ *        Eight independent partial results let the loop vectorize (with
+ *        gathers for indirect bodies such as SpMV); op must be associative
+ *        and commutative.
+ */
+template <typename T, typename Body, typename BinOp>
+RAJA_INLINE T reduce_range(Body const &body,
+                           Index_type lo,
+                           Index_type hi,
+                           BinOp op,
+                           T init)
+{
+  constexpr Index_type parts = 8;
+  T acc = init;
+  Index_type j = lo;
+  if (hi - lo >= 2 * parts) {
+    T part[parts];
+    for (Index_type l = 0; l < parts; ++l) {
+      part[l] = BinOp::identity();
+    }
+    for (; j + parts <= hi; j += parts) {
+      RAJA_SIMD
+      for (Index_type l = 0; l < parts; ++l) {
+        part[l] = op(part[l], static_cast<T>(body(j + l)));
+      }
+    }
+    for (Index_type l = 0; l < parts; ++l) {
+      acc = op(acc, part[l]);
+    }
+  }
+  for (; j < hi; ++j) {
+    acc = op(acc, static_cast<T>(body(j)));
+  }
+  return acc;
+}
+
+/*!
+ * \brief Merge-path search: the number of segments completed after the
+ *        first diag steps of merging the segment ends offsets[1..n] with
+ *        the items offsets[0]..offsets[n]-1, a segment end being taken
+ *        before an item equal to it.
+ */
+template <typename OffsetIter>
+RAJA_INLINE Index_type merge_path_search(OffsetIter offsets,
+                                         Index_type num_segments,
+                                         Index_type num_items,
+                                         Index_type diag)
+{
+  const Index_type base = static_cast<Index_type>(offsets[0]);
+  Index_type lo = diag > num_items ? diag - num_items : 0;
+  Index_type hi = diag < num_segments ? diag : num_segments;
+  while (lo < hi) {
+    const Index_type mid = lo + (hi - lo) / 2;
+    if (static_cast<Index_type>(offsets[mid + 1]) <= base + diag - 1 - mid) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+}  // namespace detail
+
+/*!
+******************************************************************************
+*
+* \brief  Segmented reduction over a CSR-style offset array.
+*
+*         For each segment i in [0, num_segments), out[i] is the op
+*         reduction of body(j) over j in [offsets[i], offsets[i + 1]),
+*         or BinOp::identity() for an empty segment. Reducing an array v
+*         is body = [=](Index_type j) { return v[j]; }.
+*
+*         Parallel policies split the merged sequence of segment ends and
+*         items into equal parts (merge-path partitioning), one per thread,
+*         so every thread gets the same number of items plus segments
+*         regardless of how skewed the segment lengths are. A segment cut
+*         by a partition boundary is completed by a sequential fix-up of
+*         one partial result per thread, which requires op to be
+*         associative and commutative, as for RAJA reducers.
+*
+* \param[in] p Execution policy
+* \param[in] num_segments Number of segments
+* \param[in] offsets Random-access iterator to num_segments + 1
+*            non-decreasing offsets
+* \param[out] out Random-access iterator to num_segments results
+* \param[in] body Callable returning the value of item j
+* \param[in] op Binary reduction operator with a static identity()
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename OffsetIter,
+          typename OutIter,
+          typename Body,
+          typename BinOp = operators::plus<detail::IterVal<OutIter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<OffsetIter>,
+                    type_traits::is_iterator<OutIter>>
+segmented_reduce(const ExecPolicy &p,
+                 Index_type num_segments,
+                 OffsetIter offsets,
+                 OutIter out,
+                 Body body,
+                 BinOp op = BinOp{})
+{
+  using T = detail::IterVal<OutIter>;
+  static_assert(type_traits::is_random_access_iterator<OffsetIter>::value,
+                "Offset iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<OutIter>::value,
+                "Output iterator must model RandomAccessIterator");
+  if (num_segments <= 0) return;
+
+  const Index_type num_items = static_cast<Index_type>(offsets[num_segments])
+                               - static_cast<Index_type>(offsets[0]);
+  const Index_type path = num_segments + num_items;
+  const int num_parts = detail::partition_count(p, path, 1);
+
+  if (num_parts <= 1) {
+    for (Index_type i = 0; i < num_segments; ++i) {
+      out[i] = detail::reduce_range(body,
+                                    static_cast<Index_type>(offsets[i]),
+                                    static_cast<Index_type>(offsets[i + 1]),
+                                    op,
+                                    static_cast<T>(BinOp::identity()));
+    }
+    return;
+  }
+
+  std::vector<Index_type> carry_segment(num_parts);
+  std::vector<T> carry_value(num_parts);
+  Index_type *carry_seg = carry_segment.data();
+  T *carry_val = carry_value.data();
+
+  forall<ExecPolicy>(
+      TypedRangeSegment<Index_type>(0, num_parts), [=](Index_type t) {
+        const Index_type base = static_cast<Index_type>(offsets[0]);
+        const Index_type d0 = t * path / num_parts;
+        const Index_type d1 = (t + 1) * path / num_parts;
+        const Index_type i0 =
+            detail::merge_path_search(offsets, num_segments, num_items, d0);
+        const Index_type i1 =
+            detail::merge_path_search(offsets, num_segments, num_items, d1);
+        const Index_type j0 = base + d0 - i0;
+        const Index_type j1 = base + d1 - i1;
+
+        // segments ending in this partition; the first may have started
+        // in an earlier one and is completed by the fix-up
+        for (Index_type i = i0; i < i1; ++i) {
+          const Index_type lo =
+              i == i0 ? j0 : static_cast<Index_type>(offsets[i]);
+          out[i] = detail::reduce_range(body,
+                                        lo,
+                                        static_cast<Index_type>(offsets[i + 1]),
+                                        op,
+                                        static_cast<T>(BinOp::identity()));
+        }
+
+        // partial result for the segment continuing past this partition
+        carry_seg[t] = i1;
+        if (i1 < num_segments) {
+          const Index_type lo =
+              i1 == i0 ? j0 : static_cast<Index_type>(offsets[i1]);
+          carry_val[t] = detail::reduce_range(
+              body, lo, j1, op, static_cast<T>(BinOp::identity()));
+        }
+      });
+
+  for (int t = 0; t < num_parts; ++t) {
+    if (carry_seg[t] < num_segments) {
+      out[carry_seg[t]] = op(out[carry_seg[t]], carry_val[t]);
+    }
+  }
+}
+
+/*!
+******************************************************************************
+*
+* \brief  CSR sparse matrix-vector product y = A x.
+*
+*         Row i of A holds values[j] in column columns[j] for j in
+*         [row_offsets[i], row_offsets[i + 1]). Rows are distributed with
+*         the merge-path partitioning of segmented_reduce, so rows of very
+*         different lengths do not unbalance the threads.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename OffsetIter,
+          typename IndexIter,
+          typename ValueIter,
+          typename XIter,
+          typename YIter>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<OffsetIter>>
+csr_spmv(const ExecPolicy &p,
+         Index_type num_rows,
+         OffsetIter row_offsets,
+         IndexIter columns,
+         ValueIter values,
+         XIter x,
+         YIter y)
+{
+  segmented_reduce(p, num_rows, row_offsets, y, [=](Index_type j) {
+    return values[j] * x[columns[j]];
+  });
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+segmented_reduce(Args &&... args)
+{
+  segmented_reduce(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>> csr_spmv(
+    Args &&... args)
+{
+  csr_spmv(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
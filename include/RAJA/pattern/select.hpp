@@ -0,0 +1,626 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing parallel selection: nth_element and top_k.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_select_HPP
+#define RAJA_pattern_select_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "camp/concepts.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/internal/ThreadUtils_CPU.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/merge.hpp"
+#include "RAJA/pattern/scan.hpp"
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! Fewest elements per part: each recursion level makes two passes over
+//! every part, so selection splits into fewer, larger parts than
+//! min_partition_size.
+constexpr Index_type min_select_part = 4 * min_partition_size;
+
+//! Number of elements sampled to bracket the selected rank.
+constexpr Index_type select_samples = 16384;
+
+//! Sample positions kept on either side of the sampled rank: six standard
+//! deviations of that position, so the bracket misses the selected
+//! element very rarely.
+constexpr Index_type select_slack = 384;
+
+//! Largest k for which top_k keeps a k-element heap per thread.
+constexpr Index_type max_heap_k = 2048;
+
+//! Value type of the range V.
+template <typename V>
+using RangeVal = camp::decay<type_traits::IterableValue<V>>;
+
+//! Start of part t of [0, n) split into parts contiguous parts.
+RAJA_INLINE Index_type part_begin(Index_type t, Index_type n, Index_type parts)
+{
+  return t * n / parts;
+}
+
+//! An element of top_k: its value and its index in the input.
+template <typename T>
+struct ranked {
+  T value;
+  Index_type index;
+};
+
+//! Order of top_k results: by comp, then by increasing index, which makes
+//! the order total and the results independent of the thread count.
+template <typename T, typename Compare>
+struct ranked_before {
+  Compare comp;
+
+  RAJA_INLINE bool operator()(ranked<T> const &a, ranked<T> const &b) const
+  {
+    if (comp(a.value, b.value)) return true;
+    if (comp(b.value, a.value)) return false;
+    return a.index < b.index;
+  }
+};
+
+/*!
+ * \brief Class of x relative to the bracket [lo, hi] in the order comp:
+ *        0 below lo, 1 within, 2 above hi. A missing bound is open.
+ */
+template <typename T, typename Compare>
+struct bracket {
+  T lo;
+  T hi;
+  bool has_lo;
+  bool has_hi;
+  Compare comp;
+
+  RAJA_INLINE int operator()(T const &x) const
+  {
+    if (has_lo && comp(x, lo)) return 0;
+    if (has_hi && comp(hi, x)) return 2;
+    return 1;
+  }
+};
+
+/*!
+ * \brief Bracket of the element of rank rank in [first, first + n).
+ *
+ *        A stratified random sample of the input is sorted, and the
+ *        sample elements a few positions either side of the rank's
+ *        expected sample position bracket that element; a few percent
+ *        of the input falls within the bracket.
+ */
+template <typename Iter, typename Compare>
+bracket<IterVal<Iter>, Compare> sample_bracket(Iter first,
+                                               Index_type n,
+                                               Index_type rank,
+                                               Compare comp)
+{
+  std::vector<IterVal<Iter>> sample(select_samples);
+  const Index_type stride = n / select_samples;
+  for (Index_type j = 0; j < select_samples; ++j) {
+    const unsigned long long h =
+        static_cast<unsigned long long>(j + 1) * 2654435761ull;
+    sample[j] = first[j * stride + static_cast<Index_type>(h % stride)];
+  }
+  std::sort(sample.begin(), sample.end(), comp);
+
+  const Index_type pos = rank * select_samples / n;
+  const bool has_lo = pos >= select_slack;
+  const bool has_hi = pos + select_slack < select_samples;
+  return bracket<IterVal<Iter>, Compare>{
+      sample[has_lo ? pos - select_slack : 0],
+      sample[has_hi ? pos + select_slack : select_samples - 1],
+      has_lo,
+      has_hi,
+      comp};
+}
+
+/*!
+ * \brief Count the elements x of [first, first + n) in each class
+ *        cls(x) of {0, 1, 2} per part into counts[t * 3 + cls(x)], and
+ *        return the totals in total[0..2].
+ */
+template <typename ExecPolicy, typename Iter, typename Classify>
+RAJA_INLINE void count_classes(Iter first,
+                               Index_type n,
+                               Index_type parts,
+                               Classify cls,
+                               Index_type *counts,
+                               Index_type *total)
+{
+  forall<ExecPolicy>(
+      TypedRangeSegment<Index_type>(0, parts), [=](Index_type t) {
+        Index_type c[3] = {0, 0, 0};
+        const Index_type hi = part_begin(t + 1, n, parts);
+        for (Index_type i = part_begin(t, n, parts); i < hi; ++i) {
+          ++c[cls(first[i])];
+        }
+        for (int k = 0; k < 3; ++k) {
+          counts[t * 3 + k] = c[k];
+        }
+      });
+  total[0] = total[1] = total[2] = 0;
+  for (Index_type t = 0; t < parts; ++t) {
+    for (int k = 0; k < 3; ++k) {
+      total[k] += counts[t * 3 + k];
+    }
+  }
+}
+
+/*!
+ * \brief Copy the elements x of [first, first + n) with cls(x) == c to
+ *        out, in order, given per-part class counts counts[t * 3 + c].
+ */
+template <typename ExecPolicy, typename Iter, typename Classify, typename T>
+RAJA_INLINE void compact_class(Iter first,
+                               Index_type n,
+                               Index_type parts,
+                               Classify cls,
+                               int c,
+                               Index_type const *counts,
+                               T *out)
+{
+  std::vector<Index_type> offsets(parts);
+  Index_type total = 0;
+  for (Index_type t = 0; t < parts; ++t) {
+    offsets[t] = total;
+    total += counts[t * 3 + c];
+  }
+  const Index_type *offset = offsets.data();
+  forall<ExecPolicy>(
+      TypedRangeSegment<Index_type>(0, parts), [=](Index_type t) {
+        T *dst = out + offset[t];
+        const Index_type hi = part_begin(t + 1, n, parts);
+        for (Index_type i = part_begin(t, n, parts); i < hi; ++i) {
+          if (cls(first[i]) == c) *dst++ = first[i];
+        }
+      });
+}
+
+/*!
+ * \brief Reorder [first, first + n) into its classes 0, 1 and 2 through
+ *        tmp, given per-part class counts counts[t * 3 + c], which are
+ *        overwritten.
+ */
+template <typename ExecPolicy, typename Iter, typename Classify, typename T>
+RAJA_INLINE void partition_classes(Iter first,
+                                   Index_type n,
+                                   Index_type parts,
+                                   Classify cls,
+                                   Index_type *counts,
+                                   T *tmp)
+{
+  // counts[t * 3 + c] becomes the position of part t's first element of
+  // class c
+  for (Index_type c = 0, pos = 0; c < 3; ++c) {
+    for (Index_type t = 0; t < parts; ++t) {
+      const Index_type count = counts[t * 3 + c];
+      counts[t * 3 + c] = pos;
+      pos += count;
+    }
+  }
+  forall<ExecPolicy>(
+      TypedRangeSegment<Index_type>(0, parts), [=](Index_type t) {
+        Index_type pos[3] = {
+            counts[t * 3], counts[t * 3 + 1], counts[t * 3 + 2]};
+        const Index_type hi = part_begin(t + 1, n, parts);
+        for (Index_type i = part_begin(t, n, parts); i < hi; ++i) {
+          tmp[pos[cls(first[i])]++] = first[i];
+        }
+      });
+  forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, n),
+                     [=](Index_type i) { first[i] = tmp[i]; });
+}
+
+/*!
+ * \brief Return the element of rank rank (0-based) in the order comp of
+ *        [first, first + n), without modifying the input.
+ *
+ *        One parallel pass counts the elements below, within and above a
+ *        sample bracket of the rank, and a second compacts the class that
+ *        holds it; the search then recurses on that class until it is
+ *        small enough for std::nth_element.
+ */
+template <typename ExecPolicy, typename Iter, typename Compare>
+IterVal<Iter> select_value(const ExecPolicy &p,
+                           Iter first,
+                           Index_type n,
+                           Index_type rank,
+                           Compare comp)
+{
+  using T = IterVal<Iter>;
+  const Index_type parts = partition_count(p, n, min_select_part);
+  if (parts == 1 || n < 2 * select_samples) {
+    std::vector<T> copy(first, first + n);
+    std::nth_element(copy.begin(), copy.begin() + rank, copy.end(), comp);
+    return copy[rank];
+  }
+
+  const auto cls = sample_bracket(first, n, rank, comp);
+  std::vector<Index_type> counts(parts * 3);
+  Index_type total[3];
+  count_classes<ExecPolicy>(first, n, parts, cls, counts.data(), total);
+
+  int c = 0;
+  while (rank >= total[c]) {
+    rank -= total[c++];
+  }
+  if (total[c] == n) {
+    // heavily repeated values defeated the bracket
+    std::vector<T> copy(first, first + n);
+    std::nth_element(copy.begin(), copy.begin() + rank, copy.end(), comp);
+    return copy[rank];
+  }
+
+  std::vector<T> part(total[c]);
+  compact_class<ExecPolicy>(
+      first, n, parts, cls, c, counts.data(), part.data());
+  return select_value(p, part.data(), total[c], rank, comp);
+}
+
+/*!
+ * \brief nth_element on [first, first + n) with tmp room for n elements.
+ *
+ *        The range is partitioned in parallel into the elements below,
+ *        within and above a sample bracket of the rank, and the search
+ *        recurses, in place, on the class that holds the rank.
+ */
+template <typename ExecPolicy, typename Iter, typename Compare>
+void nth_element_range(const ExecPolicy &p,
+                       Iter first,
+                       Index_type n,
+                       Index_type rank,
+                       Compare comp,
+                       IterVal<Iter> *tmp)
+{
+  const Index_type parts = partition_count(p, n, min_select_part);
+  if (parts == 1 || n < 2 * select_samples) {
+    std::nth_element(first, first + rank, first + n, comp);
+    return;
+  }
+
+  const auto cls = sample_bracket(first, n, rank, comp);
+  std::vector<Index_type> counts(parts * 3);
+  Index_type total[3];
+  count_classes<ExecPolicy>(first, n, parts, cls, counts.data(), total);
+
+  int c = 0;
+  Index_type offset = 0;
+  while (rank >= offset + total[c]) {
+    offset += total[c++];
+  }
+  if (total[c] == n) {
+    // heavily repeated values defeated the bracket
+    std::nth_element(first, first + rank, first + n, comp);
+    return;
+  }
+
+  partition_classes<ExecPolicy>(first, n, parts, cls, counts.data(), tmp);
+  nth_element_range(p, first + offset, total[c], rank - offset, comp, tmp);
+}
+
+/*!
+ * \brief Sort buf[0, n) by before: one std::sort per part, then rounds
+ *        of parallel merges of neighbouring runs through tmp.
+ */
+template <typename ExecPolicy, typename T, typename Before>
+void sort_parts(const ExecPolicy &p,
+                T *buf,
+                T *tmp,
+                Index_type n,
+                Before before)
+{
+  const Index_type parts = partition_count(p, n, min_select_part);
+  forall<ExecPolicy>(
+      TypedRangeSegment<Index_type>(0, parts), [=](Index_type t) {
+        std::sort(buf + part_begin(t, n, parts),
+                  buf + part_begin(t + 1, n, parts),
+                  before);
+      });
+  T *src = buf;
+  T *dst = tmp;
+  for (Index_type width = 1; width < parts; width *= 2) {
+    for (Index_type t = 0; t < parts; t += 2 * width) {
+      const Index_type lo = part_begin(t, n, parts);
+      const Index_type mid =
+          part_begin(t + width < parts ? t + width : parts, n, parts);
+      const Index_type hi =
+          part_begin(t + 2 * width < parts ? t + 2 * width : parts, n, parts);
+      RAJA::merge(
+          p, src + lo, src + mid, src + mid, src + hi, dst + lo, before);
+    }
+    std::swap(src, dst);
+  }
+  if (src != buf) {
+    forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, n),
+                       [=](Index_type i) { buf[i] = src[i]; });
+  }
+}
+
+/*!
+ * \brief top_k for small k: every part keeps its k best elements in a
+ *        heap whose root is the worst of them, so most elements cost one
+ *        comparison with the root; the parts' heaps are then merged.
+ */
+template <typename ExecPolicy, typename Iter, typename Compare>
+std::vector<ranked<IterVal<Iter>>> top_k_heaps(const ExecPolicy &p,
+                                               Iter first,
+                                               Index_type n,
+                                               Index_type k,
+                                               Compare comp)
+{
+  using T = IterVal<Iter>;
+  using Before = ranked_before<T, Compare>;
+  const Index_type parts = partition_count(p, n, min_select_part);
+  std::vector<ranked<T>> heaps(parts * k);
+  std::vector<Index_type> sizes(parts);
+  ranked<T> *heap_data = heaps.data();
+  Index_type *size = sizes.data();
+  const Before before{comp};
+
+  forall<ExecPolicy>(
+      TypedRangeSegment<Index_type>(0, parts), [=](Index_type t) {
+        ranked<T> *heap = heap_data + t * k;
+        Index_type len = 0;
+        const Index_type hi = part_begin(t + 1, n, parts);
+        for (Index_type i = part_begin(t, n, parts); i < hi; ++i) {
+          const ranked<T> x{first[i], i};
+          if (len < k) {
+            heap[len++] = x;
+            std::push_heap(heap, heap + len, before);
+          } else if (before(x, heap[0])) {
+            std::pop_heap(heap, heap + k, before);
+            heap[k - 1] = x;
+            std::push_heap(heap, heap + k, before);
+          }
+        }
+        size[t] = len;
+      });
+
+  std::vector<ranked<T>> best;
+  best.reserve(parts * k);
+  for (Index_type t = 0; t < parts; ++t) {
+    best.insert(best.end(),
+                heaps.begin() + t * k,
+                heaps.begin() + t * k + sizes[t]);
+  }
+  std::partial_sort(best.begin(), best.begin() + k, best.end(), before);
+  best.resize(k);
+  return best;
+}
+
+/*!
+ * \brief top_k for large k: select the k-th best value v, copy every
+ *        element better than v and the first equivalent ones up to k,
+ *        then sort the k copies in parallel.
+ */
+template <typename ExecPolicy, typename Iter, typename Compare>
+std::vector<ranked<IterVal<Iter>>> top_k_select(const ExecPolicy &p,
+                                                Iter first,
+                                                Index_type n,
+                                                Index_type k,
+                                                Compare comp)
+{
+  using T = IterVal<Iter>;
+  const T v = select_value(p, first, n, k - 1, comp);
+  const bracket<T, Compare> cls{v, v, true, true, comp};
+
+  const Index_type parts = partition_count(p, n, min_select_part);
+  std::vector<Index_type> counts(parts * 3);
+  Index_type total[3];
+  count_classes<ExecPolicy>(first, n, parts, cls, counts.data(), total);
+
+  // offsets[t]: output position of part t's first better element;
+  // offsets[parts + t]: rank of part t's first equivalent element
+  std::vector<Index_type> offsets(2 * parts);
+  for (Index_type t = 0, b = 0, e = 0; t < parts; ++t) {
+    offsets[t] = b;
+    offsets[parts + t] = e;
+    b += counts[t * 3];
+    e += counts[t * 3 + 1];
+  }
+  const Index_type better = total[0];
+  std::vector<ranked<T>> best(k);
+  std::vector<ranked<T>> tmp(k);
+  ranked<T> *out = best.data();
+  const Index_type *offset = offsets.data();
+
+  forall<ExecPolicy>(
+      TypedRangeSegment<Index_type>(0, parts), [=](Index_type t) {
+        Index_type b = offset[t];
+        Index_type e = offset[parts + t];
+        const Index_type hi = part_begin(t + 1, n, parts);
+        for (Index_type i = part_begin(t, n, parts); i < hi; ++i) {
+          const int c = cls(first[i]);
+          if (c == 0) {
+            out[b++] = ranked<T>{first[i], i};
+          } else if (c == 1 && better + e < k) {
+            out[better + e++] = ranked<T>{first[i], i};
+          } else if (c == 1) {
+            ++e;
+          }
+        }
+      });
+
+  sort_parts(p, best.data(), tmp.data(), k, ranked_before<T, Compare>{comp});
+  return best;
+}
+
+}  // namespace detail
+
+/*!
+******************************************************************************
+*
+* \brief  Rearrange [begin, end) so that *nth is the element that would be
+*         there if the range were sorted by comp, every element before nth
+*         is not ordered after it and every element after nth is not
+*         ordered before it, as std::nth_element.
+*
+*         Parallel policies sort a small random sample to bracket the
+*         element, partition the range in parallel into the elements
+*         below, within and above the bracket, through a temporary buffer
+*         the size of the range, and recurse on the few percent within it
+*         until std::nth_element takes over.
+*
+* \param[in] p Execution policy
+* \param[in,out] begin Random-access iterator to the first element
+* \param[in] nth Random-access iterator to the element to place
+* \param[in] end Random-access iterator past the last element
+* \param[in] comp Strict weak order on the elements
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Compare = operators::less<detail::IterVal<Iter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>>
+nth_element(const ExecPolicy &p,
+            Iter begin,
+            Iter nth,
+            Iter end,
+            Compare comp = Compare{})
+{
+  using T = detail::IterVal<Iter>;
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  const Index_type n = end - begin;
+  const Index_type rank = nth - begin;
+  if (rank < 0 || rank >= n) return;
+  const Index_type parts =
+      detail::partition_count(p, n, detail::min_select_part);
+  if (parts == 1) {
+    std::nth_element(begin, nth, end, comp);
+    return;
+  }
+
+  std::vector<T> tmp(n);
+  detail::nth_element_range(p, begin, n, rank, comp, tmp.data());
+}
+
+/*!
+******************************************************************************
+*
+* \brief  Write the k best elements of values by comp, best first, to
+*         out_values and their positions in values to out_indices; returns
+*         the number written, min(k, values.size()).
+*
+*         With the default comp, operators::greater, these are the k
+*         largest values in decreasing order. Equivalent values are
+*         ordered by increasing index, and of several equivalent values
+*         competing for the last places the lowest indices win, so the
+*         results do not depend on the policy or the thread count.
+*
+*         For k up to a few thousand every thread keeps a k-element heap
+*         of its best elements, which rejects most elements with a single
+*         comparison, and the heaps are merged at the end. Larger k select
+*         the k-th best value by sample selection, copy out the elements
+*         that beat it and sort only those.
+*
+* \param[in] p Execution policy
+* \param[in] values Random-access range of values
+* \param[in] k Number of elements to select
+* \param[out] out_values Random-access iterator to room for k values
+* \param[out] out_indices Random-access iterator to room for k indices
+* \param[in] comp Strict weak order; a before b if a is better
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Values,
+          typename ValueIter,
+          typename IndexIter,
+          typename Compare = operators::greater<detail::RangeVal<Values>>>
+typename std::enable_if<
+    concepts::all_of<type_traits::is_execution_policy<ExecPolicy>,
+                     type_traits::is_range<Values>,
+                     type_traits::is_iterator<ValueIter>,
+                     type_traits::is_iterator<IndexIter>>::value,
+    Index_type>::type
+top_k(const ExecPolicy &p,
+      Values const &values,
+      Index_type k,
+      ValueIter out_values,
+      IndexIter out_indices,
+      Compare comp = Compare{})
+{
+  using IndexT = detail::IterVal<IndexIter>;
+  static_assert(type_traits::is_random_access_iterator<ValueIter>::value,
+                "Value iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IndexIter>::value,
+                "Index iterator must model RandomAccessIterator");
+  auto first = values.begin();
+  const Index_type n = values.end() - values.begin();
+  if (k > n) k = n;
+  if (k <= 0) return 0;
+
+  auto best = k <= detail::max_heap_k
+                  ? detail::top_k_heaps(p, first, n, k, comp)
+                  : detail::top_k_select(p, first, n, k, comp);
+  auto *b = best.data();
+  forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, k), [=](Index_type i) {
+    out_values[i] = b[i].value;
+    out_indices[i] = static_cast<IndexT>(b[i].index);
+  });
+  return k;
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+nth_element(Args &&... args)
+{
+  RAJA::nth_element(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto top_k(Args &&... args)
+    -> decltype(RAJA::top_k(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return RAJA::top_k(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
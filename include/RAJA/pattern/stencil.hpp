@@ -0,0 +1,698 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing dense structured-grid stencils with
+ *          cache blocking, interior/boundary splitting and red-black
+ *          ordering.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_stencil_HPP
+#define RAJA_pattern_stencil_HPP
+
+#include "RAJA/config.hpp"
+
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/internal/ThreadUtils_CPU.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+#include "RAJA/util/View.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Stencils over 1, 2 and 3-dimensional structured grids.
+ *
+ *         A stencil is given either as a point function, called with the
+ *         indices of each grid point, or as a set of weighted neighbor
+ *         offsets applied to a View:
+ *
+ * \verbatim
+ *
+ *   using namespace RAJA::stencil;
+ *
+ *   // out(j, i) = in(j-1, i) + in(j+1, i) + in(j, i-1) + in(j, i+1)
+ *   //             - 4 in(j, i) over the interior of an OffsetLayout View
+ *   apply<RAJA::omp_parallel_for_exec>(star<2>({1.0, -2.0, 1.0}),
+ *                                      in, out,
+ *                                      make_box<2>({0, 0}, {ny, nx}));
+ *
+ *   // periodic boundaries: branch-free body inside, wrapping body outside
+ *   apply<RAJA::omp_parallel_for_exec>(make_box<2>({0, 0}, {n, n}), 2,
+ *       [=](Index_type j, Index_type i) { ...p(j, i + 2)... },
+ *       [=](Index_type j, Index_type i) { ...p(j, (i + 2) % n)... });
+ *
+ * \endverbatim
+ *
+ *         Indices are passed in View order and the last index is taken to
+ *         be the unit-stride one. The box is traversed in tiles sized so
+ *         that the 2 * radius + 1 planes (rows in 2D) a stencil reads
+ *         stay in cache while the first dimension is streamed; tiles are
+ *         run by the execution policy and each tile row is a unit-stride
+ *         loop. Point-function rows are left to the compiler's
+ *         vectorizer rather than forced with RAJA_SIMD, so that bodies
+ *         updating reducers stay well-defined.
+ *
+ *         With a boundary body, points closer than radius to the edge of
+ *         the box go to that body and the rest to the interior body, so
+ *         the interior body never needs bounds checks or index wrapping.
+ *         apply_red_black runs all points whose index sum is even, then
+ *         all points whose index sum is odd, for in-place Gauss-Seidel
+ *         sweeps of stencils that couple only neighbors of opposite color.
+ *
+ *         Point functions may be called concurrently for distinct points
+ *         and may capture RAJA reducer objects.
+ *
+ ******************************************************************************
+ */
+namespace stencil
+{
+
+//! Largest number of points in a Weights stencil.
+constexpr int max_points = 64;
+
+//! Cache budget for the planes a tile reads while streaming.
+constexpr size_t default_cache_bytes = size_t(1) << 18;
+
+//! Bytes touched per grid point assumed for point-function stencils.
+constexpr size_t default_point_bytes = 2 * sizeof(double);
+
+//! Shortest tile row kept when the innermost dimension is tiled.
+constexpr Index_type min_tile_row = 256;
+
+//! Half-open box [lower, upper) of grid points.
+template <size_t Dims>
+struct Box {
+  static_assert(Dims >= 1 && Dims <= 3, "stencil boxes have 1 to 3 dims");
+
+  std::array<Index_type, Dims> lower;
+  std::array<Index_type, Dims> upper;
+
+  RAJA_INLINE Index_type extent(size_t d) const
+  {
+    return upper[d] > lower[d] ? upper[d] - lower[d] : 0;
+  }
+
+  RAJA_INLINE Index_type size() const
+  {
+    Index_type n = 1;
+    for (size_t d = 0; d < Dims; ++d) {
+      n *= extent(d);
+    }
+    return n;
+  }
+};
+
+template <size_t Dims>
+RAJA_INLINE Box<Dims> make_box(std::array<Index_type, Dims> const &lower,
+                               std::array<Index_type, Dims> const &upper)
+{
+  return Box<Dims>{lower, upper};
+}
+
+/*!
+ * \brief Weighted neighbor offsets: out(p) = sum_k weight(k) in(p + offset(k)).
+ */
+template <typename T, size_t Dims>
+class Weights
+{
+public:
+  using offset_type = std::array<Index_type, Dims>;
+
+  /*!
+   * \brief Add weight at offset, summing with an existing point at the
+   *        same offset.
+   */
+  Weights &add(offset_type const &offset, T weight)
+  {
+    for (int k = 0; k < m_size; ++k) {
+      if (m_offset[k] == offset) {
+        m_weight[k] += weight;
+        return *this;
+      }
+    }
+    if (m_size == max_points) {
+      RAJA_ABORT_OR_THROW("RAJA::stencil::Weights has too many points");
+    }
+    m_offset[m_size] = offset;
+    m_weight[m_size] = weight;
+    ++m_size;
+    return *this;
+  }
+
+  int size() const { return m_size; }
+
+  offset_type const &offset(int k) const { return m_offset[k]; }
+
+  T weight(int k) const { return m_weight[k]; }
+
+  //! Largest absolute offset in any dimension.
+  Index_type radius() const
+  {
+    Index_type r = 0;
+    for (int k = 0; k < m_size; ++k) {
+      for (size_t d = 0; d < Dims; ++d) {
+        const Index_type o = m_offset[k][d];
+        r = o > r ? o : (-o > r ? -o : r);
+      }
+    }
+    return r;
+  }
+
+private:
+  int m_size = 0;
+  offset_type m_offset[max_points];
+  T m_weight[max_points];
+};
+
+/*!
+ * \brief Star stencil applying the 1D central coefficients c[0..2r] along
+ *        every dimension: c[r] weights the center once per dimension.
+ *
+ *        star<2>({1.0, -2.0, 1.0}) is the 5-point Laplacian.
+ */
+template <size_t Dims, typename T>
+Weights<T, Dims> star(std::initializer_list<T> coefficients)
+{
+  const Index_type n = static_cast<Index_type>(coefficients.size());
+  if (n % 2 == 0) {
+    RAJA_ABORT_OR_THROW("RAJA::stencil::star needs an odd coefficient count");
+  }
+  const Index_type r = n / 2;
+  Weights<T, Dims> w;
+  for (size_t d = 0; d < Dims; ++d) {
+    Index_type o = -r;
+    for (T c : coefficients) {
+      std::array<Index_type, Dims> offset{};
+      offset[d] = o++;
+      w.add(offset, c);
+    }
+  }
+  return w;
+}
+
+namespace detail
+{
+
+//! A box split into tiles; tile u is unit(u), with dimension 0 fastest.
+template <size_t Dims>
+struct Tiling {
+  Box<Dims> box;
+  Index_type tile[Dims];
+  Index_type count[Dims];
+  Index_type num_units;
+
+  RAJA_INLINE Box<Dims> unit(Index_type u) const
+  {
+    Box<Dims> b;
+    for (size_t d = 0; d < Dims; ++d) {
+      const Index_type c = u % count[d];
+      u /= count[d];
+      b.lower[d] = box.lower[d] + c * tile[d];
+      b.upper[d] = b.lower[d] + tile[d] < box.upper[d] ? b.lower[d] + tile[d]
+                                                       : box.upper[d];
+    }
+    return b;
+  }
+};
+
+RAJA_INLINE Index_type ceil_div(Index_type a, Index_type b)
+{
+  return (a + b - 1) / b;
+}
+
+/*!
+ * \brief Tile all but the first dimension so that 2 * radius + 1 slices
+ *        of a tile fit in cache_bytes, then cut the first dimension into
+ *        chunks until there are about four tiles per thread.
+ */
+template <size_t Dims>
+Tiling<Dims> make_tiling(Box<Dims> const &box,
+                         Index_type radius,
+                         size_t point_bytes,
+                         int threads)
+{
+  Tiling<Dims> t;
+  t.box = box;
+  for (size_t d = 0; d < Dims; ++d) {
+    t.tile[d] = box.extent(d) > 0 ? box.extent(d) : 1;
+  }
+
+  if (Dims > 1) {
+    const size_t slice_bytes = (2 * radius + 1) * point_bytes;
+    Index_type budget =
+        static_cast<Index_type>(default_cache_bytes / slice_bytes);
+    Index_type &row = t.tile[Dims - 1];
+    if (row > budget) {
+      row = budget > min_tile_row ? budget / 64 * 64 : min_tile_row;
+    }
+    budget = budget / row > 1 ? budget / row : 1;
+    for (int d = static_cast<int>(Dims) - 2; d >= 1; --d) {
+      const Index_type tile = budget > 4 ? budget : 4;
+      t.tile[d] = tile < t.tile[d] ? tile : t.tile[d];
+      budget = budget / t.tile[d] > 1 ? budget / t.tile[d] : 1;
+    }
+  }
+
+  Index_type cross = 1;
+  for (size_t d = 1; d < Dims; ++d) {
+    cross *= ceil_div(box.extent(d), t.tile[d]);
+  }
+  if (threads > 1 && cross < 4 * threads) {
+    const Index_type ext = box.extent(0);
+    const Index_type min_chunk = Dims > 1 ? 2 * radius + 2 : 1024;
+    Index_type chunk = ceil_div(ext, ceil_div(4 * threads, cross));
+    chunk = chunk > min_chunk ? chunk : min_chunk;
+    t.tile[0] = chunk < t.tile[0] ? chunk : t.tile[0];
+  }
+
+  t.num_units = 1;
+  for (size_t d = 0; d < Dims; ++d) {
+    t.count[d] = ceil_div(box.extent(d), t.tile[d]);
+    t.num_units *= t.count[d];
+  }
+  return t;
+}
+
+/*!
+ * \brief Call row(idx, lo, hi) for each row of b along the last
+ *        dimension, with idx holding the other indices.
+ */
+template <size_t Dims, typename RowFn>
+RAJA_INLINE void for_each_row(Box<Dims> const &b, RowFn const &row)
+{
+  for (size_t d = 0; d < Dims; ++d) {
+    if (b.upper[d] <= b.lower[d]) return;
+  }
+  Index_type idx[Dims];
+  for (size_t d = 0; d < Dims; ++d) {
+    idx[d] = b.lower[d];
+  }
+  while (true) {
+    row(static_cast<Index_type const *>(idx),
+        b.lower[Dims - 1],
+        b.upper[Dims - 1]);
+    int d = static_cast<int>(Dims) - 2;
+    for (; d >= 0; --d) {
+      if (++idx[d] < b.upper[d]) break;
+      idx[d] = b.lower[d];
+    }
+    if (d < 0) break;
+  }
+}
+
+template <typename ExecPolicy, size_t Dims, typename RowFn>
+RAJA_INLINE void traverse(Box<Dims> const &box,
+                          Index_type radius,
+                          size_t point_bytes,
+                          RowFn const &row)
+{
+  if (box.size() == 0) return;
+  const Tiling<Dims> t =
+      make_tiling(box, radius, point_bytes, getMaxThreadsCPU(ExecPolicy{}));
+  forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, t.num_units),
+                     [=](Index_type u) { for_each_row(t.unit(u), row); });
+}
+
+template <typename Body, camp::idx_t... Outer>
+RAJA_INLINE void invoke(Body const &body,
+                        Index_type const *idx,
+                        Index_type i,
+                        camp::idx_seq<Outer...>)
+{
+  body(idx[Outer]..., i);
+}
+
+template <typename Layout, camp::idx_t... Outer>
+RAJA_INLINE Index_type linear(Layout const &layout,
+                              Index_type const *idx,
+                              Index_type i,
+                              camp::idx_seq<Outer...>)
+{
+  return stripIndexType(layout(idx[Outer]..., i));
+}
+
+/*!
+ * \brief Row function calling body on every point (color < 0) or on the
+ *        points whose index sum has the parity of color.
+ */
+template <size_t Dims, typename Body>
+struct PointRow {
+  Body body;
+  int color;
+
+  RAJA_INLINE void operator()(Index_type const *idx,
+                              Index_type lo,
+                              Index_type hi) const
+  {
+    using outer = camp::make_idx_seq_t<Dims - 1>;
+    if (color < 0) {
+      for (Index_type i = lo; i < hi; ++i) {
+        invoke(body, idx, i, outer{});
+      }
+    } else {
+      Index_type sum = lo + color;
+      for (size_t d = 0; d + 1 < Dims; ++d) {
+        sum += idx[d];
+      }
+      for (Index_type i = lo + (sum & 1); i < hi; i += 2) {
+        invoke(body, idx, i, outer{});
+      }
+    }
+  }
+};
+
+template <size_t Dims, typename Body>
+RAJA_INLINE PointRow<Dims, Body> point_row(Body const &body, int color)
+{
+  return PointRow<Dims, Body>{body, color};
+}
+
+/*!
+ * \brief Traverse the points of box closer than radius to its edge with
+ *        boundary and the others with interior.
+ *
+ *        The boundary is cut into 2 * Dims slabs: slab d covers the first
+ *        and last radius indices of dimension d, the interior range of
+ *        the dimensions before d and the full range of those after it.
+ */
+template <typename ExecPolicy,
+          size_t Dims,
+          typename Interior,
+          typename Boundary>
+void split(Box<Dims> const &box,
+           Index_type radius,
+           Interior const &interior,
+           Boundary const &boundary,
+           int color)
+{
+  Box<Dims> inner = box;
+  for (size_t d = 0; d < Dims; ++d) {
+    const Index_type lo = box.lower[d] + radius;
+    const Index_type hi = box.upper[d] - radius;
+    inner.lower[d] = lo < box.upper[d] ? lo : box.upper[d];
+    inner.upper[d] = hi > inner.lower[d] ? hi : inner.lower[d];
+  }
+
+  traverse<ExecPolicy>(inner,
+                       radius,
+                       default_point_bytes,
+                       point_row<Dims>(interior, color));
+
+  for (size_t d = 0; d < Dims; ++d) {
+    Box<Dims> slab = box;
+    for (size_t e = 0; e < d; ++e) {
+      slab.lower[e] = inner.lower[e];
+      slab.upper[e] = inner.upper[e];
+    }
+    slab.upper[d] = inner.lower[d];
+    traverse<ExecPolicy>(slab,
+                         radius,
+                         default_point_bytes,
+                         point_row<Dims>(boundary, color));
+    slab.lower[d] = inner.upper[d];
+    slab.upper[d] = box.upper[d];
+    traverse<ExecPolicy>(slab,
+                         radius,
+                         default_point_bytes,
+                         point_row<Dims>(boundary, color));
+  }
+}
+
+/*!
+ * \brief dst[i] = sum_k w[k] * src[i + off[k]] for i in [0, n), with the
+ *        number of points N known at compile time so that the sum is
+ *        unrolled inside the SIMD loop over i.
+ */
+template <int N, typename T, typename InT>
+RAJA_INLINE void weighted_row(T const *RAJA_RESTRICT w,
+                              Index_type const *RAJA_RESTRICT off,
+                              InT const *RAJA_RESTRICT src,
+                              T *RAJA_RESTRICT dst,
+                              Index_type n)
+{
+  T wl[N];
+  Index_type ol[N];
+  for (int k = 0; k < N; ++k) {
+    wl[k] = w[k];
+    ol[k] = off[k];
+  }
+  RAJA_SIMD
+  for (Index_type i = 0; i < n; ++i) {
+    T acc = wl[0] * src[i + ol[0]];
+    for (int k = 1; k < N; ++k) {
+      acc += wl[k] * src[i + ol[k]];
+    }
+    dst[i] = acc;
+  }
+}
+
+/*!
+ * \brief weighted_row for any number of points: the row is done in
+ *        chunks, each accumulated one point at a time.
+ */
+template <typename T, typename InT>
+RAJA_INLINE void weighted_row(T const *RAJA_RESTRICT w,
+                              Index_type const *RAJA_RESTRICT off,
+                              int np,
+                              InT const *RAJA_RESTRICT src,
+                              T *RAJA_RESTRICT dst,
+                              Index_type n)
+{
+  constexpr Index_type chunk = 512;
+  for (Index_type c = 0; c < n; c += chunk) {
+    const Index_type len = n - c < chunk ? n - c : chunk;
+    T *RAJA_RESTRICT d = dst + c;
+    InT const *RAJA_RESTRICT s0 = src + c + off[0];
+    const T w0 = w[0];
+    RAJA_SIMD
+    for (Index_type i = 0; i < len; ++i) {
+      d[i] = w0 * s0[i];
+    }
+    for (int k = 1; k < np; ++k) {
+      InT const *RAJA_RESTRICT sk = src + c + off[k];
+      const T wk = w[k];
+      RAJA_SIMD
+      for (Index_type i = 0; i < len; ++i) {
+        d[i] += wk * sk[i];
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Row function for Weights stencils on Views.
+ *
+ *        Neighbor offsets are turned into linear offsets once. Rows with
+ *        unit stride in both Views use weighted_row, specialized for the
+ *        point counts of the usual star and box stencils; other rows
+ *        fall back to a scalar loop.
+ */
+template <size_t Dims,
+          typename T,
+          typename InT,
+          typename InLayout,
+          typename OutLayout>
+struct WeightsRow {
+  InT const *in;
+  T *out;
+  InLayout in_layout;
+  OutLayout out_layout;
+  int num_points;
+  Index_type offset[max_points];
+  T weight[max_points];
+
+  RAJA_INLINE void operator()(Index_type const *idx,
+                              Index_type lo,
+                              Index_type hi) const
+  {
+    using outer = camp::make_idx_seq_t<Dims - 1>;
+    const Index_type in_first = linear(in_layout, idx, lo, outer{});
+    const Index_type out_first = linear(out_layout, idx, lo, outer{});
+    const Index_type in_stride =
+        linear(in_layout, idx, lo + 1, outer{}) - in_first;
+    const Index_type out_stride =
+        linear(out_layout, idx, lo + 1, outer{}) - out_first;
+    InT const *RAJA_RESTRICT src = in + in_first;
+    T *RAJA_RESTRICT dst = out + out_first;
+    T const *RAJA_RESTRICT w = weight;
+    Index_type const *RAJA_RESTRICT off = offset;
+    const Index_type n = hi - lo;
+    const int np = num_points;
+
+    if (in_stride == 1 && out_stride == 1) {
+      switch (np) {
+        case 3: weighted_row<3>(w, off, src, dst, n); break;
+        case 5: weighted_row<5>(w, off, src, dst, n); break;
+        case 7: weighted_row<7>(w, off, src, dst, n); break;
+        case 9: weighted_row<9>(w, off, src, dst, n); break;
+        case 13: weighted_row<13>(w, off, src, dst, n); break;
+        case 19: weighted_row<19>(w, off, src, dst, n); break;
+        case 25: weighted_row<25>(w, off, src, dst, n); break;
+        case 27: weighted_row<27>(w, off, src, dst, n); break;
+        default: weighted_row(w, off, np, src, dst, n); break;
+      }
+    } else {
+      for (Index_type i = 0; i < n; ++i) {
+        T acc = w[0] * src[i * in_stride + off[0]];
+        for (int k = 1; k < np; ++k) {
+          acc += w[k] * src[i * in_stride + off[k]];
+        }
+        dst[i * out_stride] = acc;
+      }
+    }
+  }
+};
+
+template <typename Layout, size_t Dims, camp::idx_t... D>
+RAJA_INLINE Index_type linear_at(Layout const &layout,
+                                 std::array<Index_type, Dims> const &p,
+                                 camp::idx_seq<D...>)
+{
+  return stripIndexType(layout(p[D]...));
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Call body(indices...) for every point of box.
+ *
+ *        body may read neighbors without bounds checks only if the Views
+ *        it reads have halos covering them.
+ */
+template <typename ExecPolicy, size_t Dims, typename Body>
+void apply(Box<Dims> const &box, Body const &body)
+{
+  detail::traverse<ExecPolicy>(box,
+                               0,
+                               default_point_bytes,
+                               detail::point_row<Dims>(body, -1));
+}
+
+/*!
+ * \brief Call interior(indices...) for the points of box at least radius
+ *        from its edge and boundary(indices...) for the others.
+ */
+template <typename ExecPolicy,
+          size_t Dims,
+          typename Interior,
+          typename Boundary>
+void apply(Box<Dims> const &box,
+           Index_type radius,
+           Interior const &interior,
+           Boundary const &boundary)
+{
+  detail::split<ExecPolicy>(box, radius, interior, boundary, -1);
+}
+
+/*!
+ * \brief Red-black ordered apply: points of box with even index sum
+ *        first, then those with odd index sum.
+ */
+template <typename ExecPolicy, size_t Dims, typename Body>
+void apply_red_black(Box<Dims> const &box, Body const &body)
+{
+  for (int color = 0; color < 2; ++color) {
+    detail::traverse<ExecPolicy>(box,
+                                 1,
+                                 default_point_bytes,
+                                 detail::point_row<Dims>(body, color));
+  }
+}
+
+/*!
+ * \brief Red-black ordered apply with interior/boundary splitting.
+ */
+template <typename ExecPolicy,
+          size_t Dims,
+          typename Interior,
+          typename Boundary>
+void apply_red_black(Box<Dims> const &box,
+                     Index_type radius,
+                     Interior const &interior,
+                     Boundary const &boundary)
+{
+  for (int color = 0; color < 2; ++color) {
+    detail::split<ExecPolicy>(box, radius, interior, boundary, color);
+  }
+}
+
+/*!
+ * \brief out(p) = sum_k w.weight(k) * in(p + w.offset(k)) for every point
+ *        p of box.
+ *
+ *        in must be indexable at every p + w.offset(k), typically through
+ *        an OffsetLayout with a halo of w.radius(); out must not overlap in.
+ */
+template <typename ExecPolicy,
+          typename T,
+          size_t Dims,
+          typename InT,
+          typename InLayout,
+          typename OutLayout>
+void apply(Weights<T, Dims> const &w,
+           View<InT, InLayout> const &in,
+           View<T, OutLayout> const &out,
+           Box<Dims> const &box)
+{
+  if (w.size() == 0 || box.size() == 0) return;
+
+  using dims = camp::make_idx_seq_t<Dims>;
+  detail::WeightsRow<Dims,
+                     T,
+                     typename std::remove_const<InT>::type,
+                     InLayout,
+                     OutLayout>
+      row{in.data, out.data, in.layout, out.layout, w.size(), {}, {}};
+  const Index_type origin = detail::linear_at(in.layout, box.lower, dims{});
+  for (int k = 0; k < w.size(); ++k) {
+    std::array<Index_type, Dims> p = box.lower;
+    for (size_t d = 0; d < Dims; ++d) {
+      p[d] += w.offset(k)[d];
+    }
+    row.offset[k] = detail::linear_at(in.layout, p, dims{}) - origin;
+    row.weight[k] = w.weight(k);
+  }
+
+  detail::traverse<ExecPolicy>(box,
+                               w.radius(),
+                               sizeof(InT) + sizeof(T),
+                               row);
+}
+
+}  // namespace stencil
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
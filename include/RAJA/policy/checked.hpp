@@ -0,0 +1,40 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA headers for checked (race-detecting)
+ *          execution.
+ *
+ *          These methods work only on platforms that support host threads.
+ *
+ *          Not included by RAJA/RAJA.hpp, since the race checker pulls in
+ *          <mutex> and thread-local state; include it directly to use
+ *          checked_exec.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_checked_HPP
+#define RAJA_checked_HPP
+
+#include "RAJA/policy/checked/forall.hpp"
+#include "RAJA/policy/checked/policy.hpp"
+#include "RAJA/policy/checked/view.hpp"
+
+#endif  // closing endif for header file include guard
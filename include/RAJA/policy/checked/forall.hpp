@@ -0,0 +1,86 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA index set and segment iteration
+ *          template methods for checked execution.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_forall_checked_HPP
+#define RAJA_forall_checked_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+#include <utility>
+
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/policy/checked/policy.hpp"
+#include "RAJA/policy/checked/view.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace checked
+{
+
+/*!
+ * \brief Loop body wrapper that publishes the current iteration to the
+ *        calling thread before invoking the user body.
+ *
+ * Copies of this object are privatized per thread like any other body.
+ */
+template <typename Body>
+struct CheckedBody {
+  Body body;
+  unsigned long epoch;
+
+  template <typename Index, typename... Args>
+  RAJA_INLINE void operator()(Index&& i, Args&&... args) const
+  {
+    RAJA::detail::CheckedIterationScope scope(
+        static_cast<Index_type>(stripIndexType(i)), epoch);
+    body(std::forward<Index>(i), std::forward<Args>(args)...);
+  }
+};
+
+template <typename ExecPolicy, typename Iterable, typename Func>
+RAJA_INLINE void forall_impl(const checked_exec<ExecPolicy>&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  using body_type = CheckedBody<typename std::decay<Func>::type>;
+  body_type body{loop_body, RAJA::detail::next_checked_epoch()};
+
+  forall_impl(ExecPolicy{}, std::forward<Iterable>(iter), body);
+}
+
+}  // namespace checked
+
+}  // namespace policy
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
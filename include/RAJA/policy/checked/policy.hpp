@@ -0,0 +1,68 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA checked policy definitions.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef policy_checked_HPP
+#define policy_checked_HPP
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace checked
+{
+
+//
+//////////////////////////////////////////////////////////////////////
+//
+// Execution policies
+//
+//////////////////////////////////////////////////////////////////////
+//
+
+///
+/// Segment execution policy that runs a forall under ExecPolicy while
+/// checked views (see RAJA::make_checked_view) record which iteration
+/// touched each element. Conflicting accesses from different iterations
+/// are reported to the RAJA::RaceChecker attached to the view.
+///
+/// checked_exec<seq_exec> computes sequential results and still reports
+/// the races a parallel policy would expose. Intended for debugging only.
+///
+template <typename ExecPolicy>
+struct checked_exec : ExecPolicy {
+  using inner_policy = ExecPolicy;
+};
+
+}  // end namespace checked
+
+}  // end namespace policy
+
+using policy::checked::checked_exec;
+
+}  // end namespace RAJA
+
+#endif
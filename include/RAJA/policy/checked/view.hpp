@@ -0,0 +1,463 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the shadow-memory race checker and the
+ *          checked View wrapper used with RAJA::checked_exec.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_checked_view_HPP
+#define RAJA_checked_view_HPP
+
+#include "RAJA/config.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * \brief Description of two accesses to the same View element made by
+ *        different iterations of one checked forall.
+ */
+struct RaceConflict {
+  enum class Kind { write_write, read_write };
+
+  Kind kind;
+  //! name given to make_checked_view
+  std::string view;
+  //! linear offset of the element, as computed by the View's layout
+  Index_type offset;
+  //! iteration that accessed the element earlier
+  Index_type first_iteration;
+  //! iteration whose access exposed the conflict
+  Index_type second_iteration;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Collects the conflicts found by the checked views attached to it.
+ *
+ *         Write-write conflicts are always checked. If check_reads is true,
+ *         reads are recorded as well and a read and a write of the same
+ *         element by different iterations is reported as a read_write
+ *         conflict. Only the first max_reports conflicts are stored;
+ *         num_conflicts() counts all of them.
+ *
+ *         The checker must outlive every view attached to it.
+ *
+ ******************************************************************************
+ */
+class RaceChecker
+{
+public:
+  explicit RaceChecker(bool check_reads = false,
+                       std::size_t max_reports = 100)
+      : m_check_reads(check_reads), m_max_reports(max_reports), m_count(0)
+  {
+  }
+
+  RaceChecker(RaceChecker const&) = delete;
+  RaceChecker& operator=(RaceChecker const&) = delete;
+
+  bool checkReads() const { return m_check_reads; }
+
+  //! true if no conflicts have been found
+  bool ok() const { return num_conflicts() == 0; }
+
+  std::size_t num_conflicts() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_count;
+  }
+
+  std::vector<RaceConflict> conflicts() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_conflicts;
+  }
+
+  void clear()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_conflicts.clear();
+    m_count = 0;
+  }
+
+  void report(std::ostream& os) const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto const& c : m_conflicts) {
+      os << "RAJA race: "
+         << (c.kind == RaceConflict::Kind::write_write ? "write/write"
+                                                       : "read/write")
+         << " conflict on " << (c.view.empty() ? "view" : c.view.c_str())
+         << " element " << c.offset << " between iterations "
+         << c.first_iteration << " and " << c.second_iteration << "\n";
+    }
+    if (m_count > m_conflicts.size()) {
+      os << "RAJA race: " << m_count - m_conflicts.size()
+         << " further conflicts not shown\n";
+    }
+  }
+
+  void add(RaceConflict&& conflict)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_count;
+    if (m_conflicts.size() < m_max_reports) {
+      m_conflicts.push_back(std::move(conflict));
+    }
+  }
+
+private:
+  bool m_check_reads;
+  std::size_t m_max_reports;
+  std::size_t m_count;
+  std::vector<RaceConflict> m_conflicts;
+  mutable std::mutex m_mutex;
+};
+
+namespace detail
+{
+
+//! Per-thread state published by RAJA::checked_exec for each iteration.
+struct CheckedIteration {
+  bool active;
+  Index_type iteration;
+  unsigned long epoch;
+};
+
+inline CheckedIteration& checked_iteration()
+{
+  static thread_local CheckedIteration current{false, 0, 0};
+  return current;
+}
+
+//! Each checked forall gets a new epoch; shadow memory is reset lazily.
+inline unsigned long next_checked_epoch()
+{
+  static std::atomic<unsigned long> epoch{0};
+  return ++epoch;
+}
+
+class CheckedIterationScope
+{
+public:
+  CheckedIterationScope(Index_type iteration, unsigned long epoch)
+      : m_saved(checked_iteration())
+  {
+    checked_iteration() = CheckedIteration{true, iteration, epoch};
+  }
+
+  ~CheckedIterationScope() { checked_iteration() = m_saved; }
+
+private:
+  CheckedIteration m_saved;
+};
+
+/*!
+ * \brief Shadow memory recording, for each element of one View, the
+ *        iteration that last wrote it and up to two iterations that read it.
+ *
+ * Two distinct readers are enough: a write by iteration k conflicts with
+ * some reader other than k whenever any such reader exists.
+ */
+class ShadowMemory
+{
+public:
+  explicit ShadowMemory(Index_type size)
+      : m_size(size < 0 ? 0 : size),
+        m_writer(new std::atomic<Index_type>[m_size]),
+        m_reader(new std::atomic<Index_type>[m_size]),
+        m_other_reader(new std::atomic<Index_type>[m_size]),
+        m_epoch(0)
+  {
+    reset();
+  }
+
+  void write(RaceChecker& checker,
+             std::string const& name,
+             Index_type offset,
+             CheckedIteration const& it)
+  {
+    if (!sync(offset, it.epoch)) return;
+
+    Index_type prev = m_writer[offset].exchange(it.iteration);
+    if (prev != none && prev != it.iteration) {
+      checker.add(RaceConflict{RaceConflict::Kind::write_write,
+                               name,
+                               offset,
+                               prev,
+                               it.iteration});
+    }
+
+    if (checker.checkReads()) {
+      Index_type reader = m_reader[offset].load();
+      if (reader == none || reader == it.iteration) {
+        reader = m_other_reader[offset].load();
+      }
+      if (reader != none && reader != it.iteration) {
+        checker.add(RaceConflict{RaceConflict::Kind::read_write,
+                                 name,
+                                 offset,
+                                 reader,
+                                 it.iteration});
+      }
+    }
+  }
+
+  void read(RaceChecker& checker,
+            std::string const& name,
+            Index_type offset,
+            CheckedIteration const& it)
+  {
+    if (!checker.checkReads() || !sync(offset, it.epoch)) return;
+
+    Index_type expected = none;
+    if (!m_reader[offset].compare_exchange_strong(expected, it.iteration)
+        && expected != it.iteration) {
+      expected = none;
+      m_other_reader[offset].compare_exchange_strong(expected, it.iteration);
+    }
+
+    Index_type writer = m_writer[offset].load();
+    if (writer != none && writer != it.iteration) {
+      checker.add(RaceConflict{RaceConflict::Kind::read_write,
+                               name,
+                               offset,
+                               writer,
+                               it.iteration});
+    }
+  }
+
+private:
+  static constexpr Index_type none = std::numeric_limits<Index_type>::min();
+
+  void reset()
+  {
+    for (Index_type i = 0; i < m_size; ++i) {
+      m_writer[i].store(none, std::memory_order_relaxed);
+      m_reader[i].store(none, std::memory_order_relaxed);
+      m_other_reader[i].store(none, std::memory_order_relaxed);
+    }
+  }
+
+  //! Clear the shadow on first use in a new epoch; false if out of range.
+  bool sync(Index_type offset, unsigned long epoch)
+  {
+    if (offset < 0 || offset >= m_size) return false;
+    if (m_epoch.load(std::memory_order_acquire) != epoch) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_epoch.load(std::memory_order_relaxed) != epoch) {
+        reset();
+        m_epoch.store(epoch, std::memory_order_release);
+      }
+    }
+    return true;
+  }
+
+  Index_type m_size;
+  std::unique_ptr<std::atomic<Index_type>[]> m_writer;
+  std::unique_ptr<std::atomic<Index_type>[]> m_reader;
+  std::unique_ptr<std::atomic<Index_type>[]> m_other_reader;
+  std::atomic<unsigned long> m_epoch;
+  std::mutex m_mutex;
+};
+
+}  // namespace detail
+
+/*!
+ * \brief Proxy reference returned by CheckedViewWrapper. Conversion to the
+ *        value type records a read; assignment records a write.
+ */
+template <typename ValueType>
+class CheckedRef
+{
+public:
+  using value_type = typename std::remove_const<ValueType>::type;
+
+  CheckedRef(ValueType* ptr,
+             detail::ShadowMemory* shadow,
+             RaceChecker* checker,
+             std::string const* name,
+             Index_type offset)
+      : m_ptr(ptr),
+        m_shadow(shadow),
+        m_checker(checker),
+        m_name(name),
+        m_offset(offset)
+  {
+  }
+
+  operator value_type() const
+  {
+    recordRead();
+    return *m_ptr;
+  }
+
+  CheckedRef const& operator=(value_type const& rhs) const
+  {
+    recordWrite();
+    *m_ptr = rhs;
+    return *this;
+  }
+
+  CheckedRef const& operator=(CheckedRef const& rhs) const
+  {
+    return *this = static_cast<value_type>(rhs);
+  }
+
+  CheckedRef const& operator+=(value_type const& rhs) const
+  {
+    return *this = static_cast<value_type>(*this) + rhs;
+  }
+
+  CheckedRef const& operator-=(value_type const& rhs) const
+  {
+    return *this = static_cast<value_type>(*this) - rhs;
+  }
+
+  CheckedRef const& operator*=(value_type const& rhs) const
+  {
+    return *this = static_cast<value_type>(*this) * rhs;
+  }
+
+  CheckedRef const& operator/=(value_type const& rhs) const
+  {
+    return *this = static_cast<value_type>(*this) / rhs;
+  }
+
+private:
+  void recordRead() const
+  {
+    auto const& it = detail::checked_iteration();
+    if (it.active) m_shadow->read(*m_checker, *m_name, m_offset, it);
+  }
+
+  void recordWrite() const
+  {
+    auto const& it = detail::checked_iteration();
+    if (it.active) m_shadow->write(*m_checker, *m_name, m_offset, it);
+  }
+
+  ValueType* m_ptr;
+  detail::ShadowMemory* m_shadow;
+  RaceChecker* m_checker;
+  std::string const* m_name;
+  Index_type m_offset;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  View wrapper whose accesses are tracked inside RAJA::checked_exec
+ *         loops. Accesses outside a checked loop are not tracked.
+ *
+ *         ViewType must expose its layout and data pointer like RAJA::View.
+ *         Elements are identified by their layout offset, so views that
+ *         alias the same memory through different layouts are tracked
+ *         independently.
+ *
+ ******************************************************************************
+ */
+template <typename ViewType>
+struct CheckedViewWrapper {
+  using base_type = ViewType;
+  using pointer_type = typename base_type::pointer_type;
+  using value_type = typename base_type::value_type;
+  using reference_type = CheckedRef<value_type>;
+
+  base_type base_;
+
+  CheckedViewWrapper(ViewType const& view,
+                     RaceChecker& checker,
+                     std::string name)
+      : base_(view),
+        m_checker(&checker),
+        m_name(std::make_shared<std::string>(std::move(name))),
+        m_shadow(std::make_shared<detail::ShadowMemory>(
+            static_cast<Index_type>(view.layout.size())))
+  {
+  }
+
+  RAJA_INLINE void set_data(pointer_type data_ptr) { base_.set_data(data_ptr); }
+
+  template <typename... ARGS>
+  RAJA_INLINE reference_type operator()(ARGS&&... args) const
+  {
+    auto offset = static_cast<Index_type>(
+        stripIndexType(base_.layout(std::forward<ARGS>(args)...)));
+    return reference_type(
+        &base_.data[offset], m_shadow.get(), m_checker, m_name.get(), offset);
+  }
+
+private:
+  RaceChecker* m_checker;
+  std::shared_ptr<std::string> m_name;
+  std::shared_ptr<detail::ShadowMemory> m_shadow;
+};
+
+/*!
+ * \brief Wrap view so that its accesses inside RAJA::checked_exec loops are
+ *        checked for conflicts and reported to checker.
+ *
+ * Usage example:
+ *
+ * \verbatim
+ *
+ *   RAJA::RaceChecker checker;
+ *   auto x = RAJA::make_checked_view(x_view, checker, "x");
+ *
+ *   RAJA::forall<RAJA::checked_exec<RAJA::omp_parallel_for_exec>>(
+ *       RAJA::RangeSegment(0, N), [=](RAJA::Index_type i) {
+ *         x(idx[i]) = 2.0 * y[i];
+ *       });
+ *
+ *   if (!checker.ok()) checker.report(std::cerr);
+ *
+ * \endverbatim
+ */
+template <typename ViewType>
+RAJA_INLINE CheckedViewWrapper<ViewType> make_checked_view(
+    ViewType const& view,
+    RaceChecker& checker,
+    std::string name = std::string())
+{
+  return CheckedViewWrapper<ViewType>(view, checker, std::move(name));
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -34,6 +34,8 @@
 
 #include "RAJA/util/macros.hpp"
 
+#include "RAJA/internal/SimdScan.hpp"
+
 #include "RAJA/util/concepts.hpp"
 
 #include "RAJA/policy/loop/policy.hpp"
@@ -56,6 +58,10 @@ concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> inclusive_inplace(
     BinFn f)
 {
   auto agg = *begin;
+  if (internal::simd_scan::try_inclusive(
+          begin + 1, (end - begin) - 1, begin + 1, f, agg)) {
+    return;
+  }
 
   for (Iter i = ++begin; i != end; ++i) {
     agg = f(*i, agg);
@@ -76,6 +82,10 @@ concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> exclusive_inplace(
     T v)
 {
   const int n = end - begin;
+  typename std::iterator_traits<Iter>::value_type carry = v;
+  if (internal::simd_scan::try_exclusive(begin, n, begin, f, carry)) {
+    return;
+  }
   decltype(*begin) agg = v;
 
   for (int i = 0; i < n; ++i) {
@@ -99,6 +109,10 @@ concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> inclusive(
 {
   auto agg = *begin;
   *out++ = agg;
+  if (internal::simd_scan::try_inclusive(
+          begin + 1, (end - begin) - 1, out, f, agg)) {
+    return;
+  }
 
   for (Iter i = begin + 1; i != end; ++i) {
     agg = f(agg, *i);
@@ -123,6 +137,10 @@ concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> exclusive(
     BinFn f,
     T v)
 {
+  typename std::iterator_traits<Iter>::value_type carry = v;
+  if (internal::simd_scan::try_exclusive(begin, end - begin, out, f, carry)) {
+    return;
+  }
   decltype(*begin) agg = v;
   OutIter o = out;
   *o++ = v;
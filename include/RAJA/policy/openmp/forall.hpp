@@ -124,6 +124,139 @@ RAJA_INLINE void forall_impl(const omp_for_static<ChunkSize>&,
   }
 }
 
+///
+/// OpenMP for policy implementations for the schedules of
+/// omp_for_schedule_exec
+///
+
+template <typename Iterable, typename Func, unsigned int N>
+RAJA_INLINE void forall_impl(const omp_for_schedule_exec<omp::Static<N>>&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+#pragma omp for schedule(static, N)
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    loop_body(begin_it[i]);
+  }
+}
+
+template <typename Iterable, typename Func, unsigned int N>
+RAJA_INLINE void forall_impl(const omp_for_schedule_exec<omp::Dynamic<N>>&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+#pragma omp for schedule(dynamic, N)
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    loop_body(begin_it[i]);
+  }
+}
+
+template <typename Iterable, typename Func, unsigned int N>
+RAJA_INLINE void forall_impl(const omp_for_schedule_exec<omp::Guided<N>>&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+#pragma omp for schedule(guided, N)
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    loop_body(begin_it[i]);
+  }
+}
+
+template <typename Iterable, typename Func>
+RAJA_INLINE void forall_impl(const omp_for_schedule_exec<omp::Runtime>&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+#pragma omp for schedule(runtime)
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    loop_body(begin_it[i]);
+  }
+}
+
+///
+/// Schedule modifiers need OpenMP 4.5; older versions drop them.
+///
+
+#if _OPENMP >= 201511
+
+template <typename Iterable, typename Func, unsigned int N>
+RAJA_INLINE void forall_impl(
+    const omp_for_schedule_exec<omp::Monotonic<omp::Dynamic<N>>>&,
+    Iterable&& iter,
+    Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+#pragma omp for schedule(monotonic : dynamic, N)
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    loop_body(begin_it[i]);
+  }
+}
+
+template <typename Iterable, typename Func, unsigned int N>
+RAJA_INLINE void forall_impl(
+    const omp_for_schedule_exec<omp::Nonmonotonic<omp::Dynamic<N>>>&,
+    Iterable&& iter,
+    Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+#pragma omp for schedule(nonmonotonic : dynamic, N)
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    loop_body(begin_it[i]);
+  }
+}
+
+template <typename Iterable, typename Func, unsigned int N>
+RAJA_INLINE void forall_impl(
+    const omp_for_schedule_exec<omp::Monotonic<omp::Guided<N>>>&,
+    Iterable&& iter,
+    Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+#pragma omp for schedule(monotonic : guided, N)
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    loop_body(begin_it[i]);
+  }
+}
+
+template <typename Iterable, typename Func, unsigned int N>
+RAJA_INLINE void forall_impl(
+    const omp_for_schedule_exec<omp::Nonmonotonic<omp::Guided<N>>>&,
+    Iterable&& iter,
+    Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+#pragma omp for schedule(nonmonotonic : guided, N)
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    loop_body(begin_it[i]);
+  }
+}
+
+#else
+
+template <typename Iterable, typename Func, typename Schedule>
+RAJA_INLINE void forall_impl(
+    const omp_for_schedule_exec<omp::Monotonic<Schedule>>&,
+    Iterable&& iter,
+    Func&& loop_body)
+{
+  forall_impl(omp_for_schedule_exec<Schedule>{}, iter, loop_body);
+}
+
+template <typename Iterable, typename Func, typename Schedule>
+RAJA_INLINE void forall_impl(
+    const omp_for_schedule_exec<omp::Nonmonotonic<Schedule>>&,
+    Iterable&& iter,
+    Func&& loop_body)
+{
+  forall_impl(omp_for_schedule_exec<Schedule>{}, iter, loop_body);
+}
+
+#endif
+
 //
 //////////////////////////////////////////////////////////////////////
 //
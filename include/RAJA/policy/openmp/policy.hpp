@@ -54,6 +54,29 @@ template <unsigned int ChunkSize>
 struct Static : std::integral_constant<unsigned int, ChunkSize> {
 };
 
+template <unsigned int ChunkSize>
+struct Dynamic : std::integral_constant<unsigned int, ChunkSize> {
+};
+
+template <unsigned int ChunkSize>
+struct Guided : std::integral_constant<unsigned int, ChunkSize> {
+};
+
+//! schedule(runtime): kind and chunk size come from omp_set_schedule or
+//! OMP_SCHEDULE when the loop runs
+struct Runtime {
+};
+
+//! OpenMP 4.5 schedule modifiers for Dynamic and Guided; compilers for
+//! older OpenMP versions ignore them
+template <typename Schedule>
+struct Monotonic : Schedule {
+};
+
+template <typename Schedule>
+struct Nonmonotonic : Schedule {
+};
+
 
 //
 //////////////////////////////////////////////////////////////////////
@@ -92,6 +115,31 @@ struct omp_for_static : make_policy_pattern_launch_platform_t<Policy::openmp,
                                                               omp::Static<N>> {
 };
 
+///
+/// omp for with the given schedule: omp::Static<N>, omp::Dynamic<N>,
+/// omp::Guided<N> or omp::Runtime, where Dynamic and Guided may be wrapped
+/// in omp::Monotonic or omp::Nonmonotonic
+///
+template <typename Schedule>
+struct omp_for_schedule_exec
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::For,
+                                            Schedule> {
+};
+
+template <unsigned int N = 1>
+struct omp_for_dynamic : omp_for_schedule_exec<omp::Dynamic<N>> {
+};
+
+template <unsigned int N = 1>
+struct omp_for_guided : omp_for_schedule_exec<omp::Guided<N>> {
+};
+
+struct omp_for_runtime : omp_for_schedule_exec<omp::Runtime> {
+};
 
 template <typename InnerPolicy>
 struct omp_parallel_exec
@@ -110,6 +158,22 @@ template <unsigned int N>
 struct omp_parallel_for_static : omp_parallel_exec<omp_for_static<N>> {
 };
 
+template <typename Schedule>
+struct omp_parallel_for_schedule_exec
+    : omp_parallel_exec<omp_for_schedule_exec<Schedule>> {
+};
+
+template <unsigned int N = 1>
+struct omp_parallel_for_dynamic : omp_parallel_exec<omp_for_dynamic<N>> {
+};
+
+template <unsigned int N = 1>
+struct omp_parallel_for_guided : omp_parallel_exec<omp_for_guided<N>> {
+};
+
+struct omp_parallel_for_runtime : omp_parallel_exec<omp_for_runtime> {
+};
+
 
 
 ///
@@ -120,6 +184,14 @@ using omp_parallel_for_segit = omp_parallel_for_exec;
 
 using omp_parallel_segit = omp_parallel_for_segit;
 
+template <unsigned int N = 1>
+using omp_parallel_for_dynamic_segit = omp_parallel_for_dynamic<N>;
+
+template <unsigned int N = 1>
+using omp_parallel_for_guided_segit = omp_parallel_for_guided<N>;
+
+using omp_parallel_for_runtime_segit = omp_parallel_for_runtime;
+
 struct omp_taskgraph_segit
     : make_policy_pattern_t<Policy::openmp, Pattern::taskgraph, omp::Parallel> {
 };
@@ -152,12 +224,24 @@ struct omp_synchronize : make_policy_pattern_launch_t<Policy::openmp,
 }  // namespace omp
 }  // namespace policy
 
+using policy::omp::omp_for_dynamic;
 using policy::omp::omp_for_exec;
+using policy::omp::omp_for_guided;
 using policy::omp::omp_for_nowait_exec;
+using policy::omp::omp_for_runtime;
+using policy::omp::omp_for_schedule_exec;
 using policy::omp::omp_for_static;
 using policy::omp::omp_parallel_exec;
+using policy::omp::omp_parallel_for_dynamic;
+using policy::omp::omp_parallel_for_dynamic_segit;
 using policy::omp::omp_parallel_for_exec;
+using policy::omp::omp_parallel_for_guided;
+using policy::omp::omp_parallel_for_guided_segit;
+using policy::omp::omp_parallel_for_runtime;
+using policy::omp::omp_parallel_for_runtime_segit;
+using policy::omp::omp_parallel_for_schedule_exec;
 using policy::omp::omp_parallel_for_segit;
+using policy::omp::omp_parallel_for_static;
 using policy::omp::omp_parallel_region;
 using policy::omp::omp_parallel_segit;
 using policy::omp::omp_reduce;
@@ -0,0 +1,85 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file mapping execution policies to the reduction policy
+ *          that is valid inside loops they run.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_reduce_policy_HPP
+#define RAJA_policy_reduce_policy_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/policy/sequential/policy.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include "RAJA/policy/openmp/policy.hpp"
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+#include "RAJA/policy/tbb/policy.hpp"
+#endif
+
+namespace RAJA
+{
+namespace detail
+{
+
+/*!
+ * \brief Reduction policy used by RAJA patterns that reduce internally,
+ *        selected from the back-end of the host execution policy.
+ */
+template <typename ExecPolicy, typename Enable = void>
+struct default_reduce_policy {
+  using type = RAJA::seq_reduce;
+};
+
+#if defined(RAJA_ENABLE_OPENMP)
+template <typename ExecPolicy>
+struct default_reduce_policy<
+    ExecPolicy,
+    typename std::enable_if<
+        type_traits::is_openmp_policy<ExecPolicy>::value>::type> {
+  using type = RAJA::omp_reduce;
+};
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+template <typename ExecPolicy>
+struct default_reduce_policy<
+    ExecPolicy,
+    typename std::enable_if<type_traits::is_tbb_policy<ExecPolicy>::value>::
+        type> {
+  using type = RAJA::tbb_reduce;
+};
+#endif
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
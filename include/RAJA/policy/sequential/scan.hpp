@@ -34,6 +34,8 @@
 
 #include "RAJA/util/macros.hpp"
 
+#include "RAJA/internal/SimdScan.hpp"
+
 #include "RAJA/util/concepts.hpp"
 
 #include "RAJA/policy/sequential/policy.hpp"
@@ -53,6 +55,10 @@ concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
 inclusive_inplace(const ExecPolicy &, Iter begin, Iter end, BinFn f)
 {
   auto agg = *begin;
+  if (internal::simd_scan::try_inclusive(
+          begin + 1, (end - begin) - 1, begin + 1, f, agg)) {
+    return;
+  }
 
   RAJA_NO_SIMD
   for (Iter i = ++begin; i != end; ++i) {
@@ -70,6 +76,10 @@ concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
 exclusive_inplace(const ExecPolicy &, Iter begin, Iter end, BinFn f, T v)
 {
   const int n = end - begin;
+  typename std::iterator_traits<Iter>::value_type carry = v;
+  if (internal::simd_scan::try_exclusive(begin, n, begin, f, carry)) {
+    return;
+  }
   decltype(*begin) agg = v;
 
   RAJA_NO_SIMD
@@ -94,6 +104,10 @@ concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>> inclusive(
 {
   auto agg = *begin;
   *out++ = agg;
+  if (internal::simd_scan::try_inclusive(
+          begin + 1, (end - begin) - 1, out, f, agg)) {
+    return;
+  }
 
   RAJA_NO_SIMD
   for (Iter i = begin + 1; i != end; ++i) {
@@ -119,6 +133,10 @@ concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>> exclusive(
     BinFn f,
     T v)
 {
+  typename std::iterator_traits<Iter>::value_type carry = v;
+  if (internal::simd_scan::try_exclusive(begin, end - begin, out, f, carry)) {
+    return;
+  }
   decltype(*begin) agg = v;
   OutIter o = out;
   *o++ = v;
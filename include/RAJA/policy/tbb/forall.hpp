@@ -35,6 +35,10 @@
 
 #include <tbb/tbb.h>
 
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
 #include "RAJA/util/types.hpp"
 
 #include "RAJA/policy/tbb/policy.hpp"
@@ -136,6 +140,60 @@ RAJA_INLINE void forall_impl(const tbb_for_static<ChunkSize>&,
                       tbb_static_partitioner{});
 }
 
+///
+/// TBB parallel for affinity policy implementation
+///
+
+/**
+ * @brief Affinity partitioner of the loops keyed by Key, one per calling
+ *        thread so that concurrent callers never share one.
+ */
+template <typename Key>
+RAJA_INLINE ::tbb::affinity_partitioner& affinity_partitioner()
+{
+  static thread_local ::tbb::affinity_partitioner partitioner;
+  return partitioner;
+}
+
+/**
+ * @brief TBB affinity for implementation
+ *
+ * @param tbb_for_affinity tbb tag
+ * @param iter any iterable
+ * @param loop_body loop body
+ *
+ * @return None
+ *
+ * This forall implements a TBB parallel_for loop over the specified iterable
+ * with a tbb::affinity_partitioner that persists across calls, which records
+ * the thread that ran each subrange and replays that mapping the next time.
+ * Loops that sweep the same data every time step then find it in the caches
+ * of the threads that touched it last. With Key void the partitioner is
+ * keyed by the iterable and loop body types, i.e. one per call site.
+ */
+template <typename Iterable, typename Func, typename Key, size_t GrainSize>
+RAJA_INLINE void forall_impl(const tbb_for_affinity<Key, GrainSize>&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  using std::begin;
+  using std::end;
+  using brange = ::tbb::blocked_range<decltype(iter.begin())>;
+  using PartitionerKey = typename std::conditional<
+      std::is_void<Key>::value,
+      camp::list<camp::decay<Iterable>, camp::decay<Func>>,
+      Key>::type;
+  ::tbb::parallel_for(brange(begin(iter), end(iter), GrainSize),
+                      [=](const brange& r) {
+                        using RAJA::internal::thread_privatize;
+                        auto privatizer = thread_privatize(loop_body);
+                        auto body = privatizer.get_priv();
+                        for (const auto& i : r)
+                          body(i);
+                      },
+                      affinity_partitioner<PartitionerKey>());
+}
+
 }  // namespace tbb
 }  // namespace policy
 
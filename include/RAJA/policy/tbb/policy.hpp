@@ -68,6 +68,21 @@ struct tbb_for_static : make_policy_pattern_launch_platform_t<Policy::tbb,
 
 using tbb_for_exec = tbb_for_static<>;
 
+///
+/// parallel_for with a tbb::affinity_partitioner that outlives the call,
+/// so repeated loops over the same data send each subrange back to the
+/// thread that ran it last time. Key void keeps one partitioner per call
+/// site (per loop body type); any other Key type shares one among the
+/// loops that name it. Partitioners are per calling thread.
+///
+template <typename Key = void, std::size_t GrainSize = 1>
+struct tbb_for_affinity
+    : make_policy_pattern_launch_platform_t<Policy::tbb,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
 ///
 /// Index set segment iteration policies
 ///
@@ -90,6 +105,7 @@ struct tbb_reduce : make_policy_pattern_launch_platform_t<Policy::tbb,
 }  // namespace tbb
 }  // namespace policy
 
+using policy::tbb::tbb_for_affinity;
 using policy::tbb::tbb_for_dynamic;
 using policy::tbb::tbb_for_exec;
 using policy::tbb::tbb_for_static;
@@ -37,6 +37,8 @@
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/macros.hpp"
 
+#include "RAJA/internal/SimdScan.hpp"
+
 #include "RAJA/policy/sequential/policy.hpp"
 
 namespace RAJA
@@ -82,9 +84,18 @@ struct scan_adapter_inclusive : scan_adapter<T, InIter, OutIter, Fn> {
   void operator()(const tbb::blocked_range<Index_type>& r, Tag)
   {
     T temp = this->agg;
-    for (Index_type i = r.begin(); i < r.end(); ++i) {
-      temp = this->fn(temp, this->in[i]);
-      if (Tag::is_final_scan()) this->out[i] = temp;
+    const Index_type b = r.begin();
+    const Index_type n = r.end() - b;
+    const bool vectorized =
+        Tag::is_final_scan()
+            ? internal::simd_scan::try_inclusive(
+                  this->in + b, n, this->out + b, this->fn, temp)
+            : internal::simd_scan::try_reduce(this->in + b, n, this->fn, temp);
+    if (!vectorized) {
+      for (Index_type i = r.begin(); i < r.end(); ++i) {
+        temp = this->fn(temp, this->in[i]);
+        if (Tag::is_final_scan()) this->out[i] = temp;
+      }
     }
     this->agg = temp;
   }
@@ -99,6 +110,15 @@ struct scan_adapter_exclusive : scan_adapter<T, InIter, OutIter, Fn> {
   void operator()(const tbb::blocked_range<Index_type>& r, Tag)
   {
     if (r.begin() == 0) this->agg = this->init;
+    const Index_type b = r.begin();
+    const Index_type n = r.end() - b;
+    const bool vectorized =
+        Tag::is_final_scan()
+            ? internal::simd_scan::try_exclusive(
+                  this->in + b, n, this->out + b, this->fn, this->agg)
+            : internal::simd_scan::try_reduce(
+                  this->in + b, n, this->fn, this->agg);
+    if (vectorized) return;
     for (Index_type i = r.begin(); i < r.end(); ++i) {
       auto t = this->in[i];
       if (Tag::is_final_scan()) this->out[i] = this->agg;
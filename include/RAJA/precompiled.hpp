@@ -0,0 +1,166 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Lightweight RAJA header for the precompiled forall, reduce and
+ *          scan entry points.
+ *
+ *          This header declares a small set of traversal, reduction and
+ *          scan routines whose definitions are explicitly instantiated in
+ *          the RAJA library for common execution policies, segment types
+ *          and value types. It includes only the policy tags and segment
+ *          types it needs, not the backend implementations pulled in by
+ *          RAJA.hpp, so translation units that only need these patterns
+ *          compile considerably faster.
+ *
+ *          Loop bodies are passed through a RAJA::FunctionRef, so each call
+ *          costs one indirect function call per iteration. Bodies are
+ *          invoked on the host and are not privatized per thread; they must
+ *          not capture RAJA reducer objects. Use reduce_sum/min/max instead.
+ *
+ *          Requires RAJA configured with ENABLE_PRECOMPILED.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_precompiled_HPP
+#define RAJA_precompiled_HPP
+
+#include "RAJA/config.hpp"
+
+#if !defined(RAJA_ENABLE_PRECOMPILED)
+#error RAJA/precompiled.hpp requires RAJA configured with ENABLE_PRECOMPILED
+#endif
+
+#include "RAJA/util/FunctionRef.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/policy/loop/policy.hpp"
+#include "RAJA/policy/sequential/policy.hpp"
+#include "RAJA/policy/simd/policy.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include "RAJA/policy/openmp/policy.hpp"
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+#include "RAJA/policy/tbb/policy.hpp"
+#endif
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Precompiled entry points.
+ *
+ *         Instantiated execution policies:
+ *            forall:          seq_exec, loop_exec, simd_exec,
+ *                             omp_parallel_for_exec, tbb_for_exec
+ *            reduce_*, scan:  seq_exec, loop_exec,
+ *                             omp_parallel_for_exec, tbb_for_exec
+ *
+ *         Instantiated segment types (forall and reduce_*):
+ *            RangeSegment, TypedRangeSegment<int>,
+ *            ListSegment, TypedListSegment<int>
+ *
+ *         Instantiated value types (reduce_* and scans):
+ *            int, Index_type, float, double
+ *
+ *         Instantiated scan operators:
+ *            operators::plus, operators::minimum, operators::maximum
+ *
+ *         The OpenMP and TBB policies are available when RAJA was built
+ *         with the corresponding back-end. Any other combination fails at
+ *         link time; use the templates in RAJA.hpp for those.
+ *
+ ******************************************************************************
+ */
+namespace precompiled
+{
+
+/*!
+ * \brief Execute body(i) for each index i in segment.
+ *
+ * Usage example:
+ *
+ * \verbatim
+ *
+ *   RAJA::precompiled::forall<RAJA::omp_parallel_for_exec>(
+ *       RAJA::RangeSegment(0, N), [=](RAJA::Index_type i) { a[i] = b[i]; });
+ *
+ * \endverbatim
+ */
+template <typename ExecPolicy, typename SegmentType>
+void forall(SegmentType const& segment,
+            FunctionRef<void(typename SegmentType::value_type)> body);
+
+/*!
+ * \brief Return the sum of body(i) over all indices i in segment.
+ */
+template <typename ExecPolicy, typename T, typename SegmentType>
+T reduce_sum(SegmentType const& segment,
+             FunctionRef<T(typename SegmentType::value_type)> body);
+
+/*!
+ * \brief Return the minimum of body(i) over all indices i in segment, or
+ *        the largest value of T if segment is empty.
+ */
+template <typename ExecPolicy, typename T, typename SegmentType>
+T reduce_min(SegmentType const& segment,
+             FunctionRef<T(typename SegmentType::value_type)> body);
+
+/*!
+ * \brief Return the maximum of body(i) over all indices i in segment, or
+ *        the lowest value of T if segment is empty.
+ */
+template <typename ExecPolicy, typename T, typename SegmentType>
+T reduce_max(SegmentType const& segment,
+             FunctionRef<T(typename SegmentType::value_type)> body);
+
+/*!
+ * \brief Inclusive in-place scan of [begin, end) with binop.
+ */
+template <typename ExecPolicy,
+          typename T,
+          typename BinaryOp = operators::plus<T>>
+void inclusive_scan_inplace(T* begin, T* end, BinaryOp binop = BinaryOp{});
+
+/*!
+ * \brief Exclusive in-place scan of [begin, end) with binop, starting
+ *        from value.
+ */
+template <typename ExecPolicy,
+          typename T,
+          typename BinaryOp = operators::plus<T>>
+void exclusive_scan_inplace(T* begin,
+                            T* end,
+                            BinaryOp binop = BinaryOp{},
+                            T value = BinaryOp::identity());
+
+}  // namespace precompiled
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
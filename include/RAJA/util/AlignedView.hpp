@@ -0,0 +1,271 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining Views whose data carries alignment and
+ *          no-alias guarantees.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_AlignedView_HPP
+#define RAJA_AlignedView_HPP
+
+#include "RAJA/config.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+#include "RAJA/util/Layout.hpp"
+#include "RAJA/util/OffsetLayout.hpp"
+#include "RAJA/util/View.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! Tell the compiler that ptr is a multiple of Alignment bytes.
+template <size_t Alignment, typename T>
+RAJA_HOST_DEVICE RAJA_INLINE T *assume_aligned(T *ptr)
+{
+#if defined(RAJA_ENABLE_CUDA) || defined(__APPLE__)
+  return ptr;
+#elif defined(RAJA_COMPILER_INTEL)
+  __assume_aligned(ptr, Alignment);
+  return ptr;
+#elif defined(RAJA_COMPILER_GNU) || defined(RAJA_COMPILER_CLANG)
+  return static_cast<T *>(__builtin_assume_aligned(ptr, Alignment));
+#else
+  return ptr;
+#endif
+}
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Pointer type promising that the data is aligned to Alignment
+ *         bytes and is not accessed through any other pointer while in
+ *         use.
+ *
+ *         Every access goes through an alignment-hinted pointer, so
+ *         vectorizers can use aligned loads and stores. The stored pointer
+ *         is RAJA_RESTRICT-qualified; compilers differ in how far they use
+ *         restrict on a member, so runtime alias checks may remain.
+ *         Violating either promise is undefined behavior; debug builds
+ *         (NDEBUG not defined) check alignment on construction, and
+ *         RAJA::check_no_alias checks Views for overlap.
+ *
+ ******************************************************************************
+ */
+template <typename T, size_t Alignment = static_cast<size_t>(DATA_ALIGN)>
+struct AlignedPtr {
+  static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0,
+                "Alignment must be a power of two no smaller than alignof(T)");
+
+  using value_type = T;
+  static constexpr size_t alignment = Alignment;
+
+  T *RAJA_RESTRICT data;
+
+  RAJA_HOST_DEVICE RAJA_INLINE AlignedPtr(T *ptr = nullptr) : data(ptr)
+  {
+#if !defined(RAJA_DEVICE_CODE)
+    assert(reinterpret_cast<std::uintptr_t>(ptr) % Alignment == 0
+           && "AlignedPtr: pointer is not aligned");
+#endif
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE T *get() const
+  {
+    return detail::assume_aligned<Alignment>(data);
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE T &operator[](Index_type i) const
+  {
+    return detail::assume_aligned<Alignment>(data)[i];
+  }
+};
+
+template <typename T, size_t Alignment>
+constexpr size_t AlignedPtr<T, Alignment>::alignment;
+
+/*!
+ * \brief View over data aligned to Alignment bytes that no other View or
+ *        pointer aliases, e.g. AlignedView<double, Layout<1>>.
+ */
+template <typename T,
+          typename LayoutType,
+          size_t Alignment = static_cast<size_t>(DATA_ALIGN)>
+using AlignedView = View<T, LayoutType, AlignedPtr<T, Alignment>>;
+
+/*!
+ * \brief View whose data is not aliased but carries no extra alignment.
+ */
+template <typename T, typename LayoutType>
+using RestrictView = View<T, LayoutType, AlignedPtr<T, alignof(T)>>;
+
+/*!
+ * \brief Allocate n elements of T aligned to Alignment bytes.
+ *        Release with RAJA::free_aligned.
+ */
+template <typename T, size_t Alignment = static_cast<size_t>(DATA_ALIGN)>
+RAJA_INLINE T *aligned_allocate(Index_type n)
+{
+  // aligned_alloc requires a size that is a multiple of the alignment
+  const size_t bytes = static_cast<size_t>(n) * sizeof(T);
+  return allocate_aligned_type<T>(
+      Alignment, (bytes + Alignment - 1) / Alignment * Alignment);
+}
+
+/*!
+ * \brief Row-major layout whose last dimension is padded so that every row
+ *        starts on an Alignment-byte boundary.
+ *
+ *        The returned layout declares its last dimension stride-one. It
+ *        spans aligned_span(layout) elements, which is the amount to pass
+ *        to aligned_allocate.
+ */
+template <typename T,
+          size_t Alignment = static_cast<size_t>(DATA_ALIGN),
+          size_t N>
+RAJA_INLINE Layout<N, Index_type, N - 1> make_aligned_layout(
+    std::array<Index_type, N> const &sizes)
+{
+  static_assert(Alignment % sizeof(T) == 0,
+                "Alignment must be a multiple of sizeof(T)");
+  constexpr Index_type per_row = Alignment / sizeof(T);
+
+  std::array<Index_type, N> strides;
+  Index_type stride = 1;
+  for (size_t d = N; d-- > 0;) {
+    strides[d] = stride;
+    stride *= (d == N - 1) ? (sizes[d] + per_row - 1) / per_row * per_row
+                           : sizes[d];
+  }
+  return Layout<N, Index_type, N - 1>(sizes, strides);
+}
+
+namespace detail
+{
+
+//! One past the largest linear index reachable through layout.
+template <camp::idx_t... RangeInts, typename IdxLin, ptrdiff_t StrideOneDim>
+RAJA_INLINE Index_type layout_span(
+    LayoutBase_impl<camp::idx_seq<RangeInts...>, IdxLin, StrideOneDim> const
+        &layout)
+{
+  Index_type span = 1;
+  for (size_t d = 0; d < sizeof...(RangeInts); ++d) {
+    if (layout.sizes[d] > 0) {
+      span += static_cast<Index_type>((layout.sizes[d] - 1)
+                                      * layout.strides[d]);
+    }
+  }
+  return span;
+}
+
+template <camp::idx_t... RangeInts, typename IdxLin>
+RAJA_INLINE Index_type layout_span(
+    internal::OffsetLayout_impl<camp::idx_seq<RangeInts...>, IdxLin> const
+        &layout)
+{
+  return layout_span(layout.base_);
+}
+
+template <typename PointerType>
+RAJA_INLINE char const *view_address(PointerType const &ptr)
+{
+  return reinterpret_cast<char const *>(&ptr[0]);
+}
+
+template <typename ViewA, typename ViewB>
+RAJA_INLINE bool views_overlap(ViewA const &a, ViewB const &b)
+{
+  using value_a = typename std::remove_cv<typename ViewA::value_type>::type;
+  using value_b = typename std::remove_cv<typename ViewB::value_type>::type;
+  char const *a_begin = view_address(a.data);
+  char const *a_end = a_begin + layout_span(a.layout) * sizeof(value_a);
+  char const *b_begin = view_address(b.data);
+  char const *b_end = b_begin + layout_span(b.layout) * sizeof(value_b);
+  return a_begin < b_end && b_begin < a_end;
+}
+
+template <typename ViewA>
+RAJA_INLINE bool view_overlaps_any(ViewA const &)
+{
+  return false;
+}
+
+template <typename ViewA, typename ViewB, typename... Rest>
+RAJA_INLINE bool view_overlaps_any(ViewA const &a,
+                                   ViewB const &b,
+                                   Rest const &... rest)
+{
+  return views_overlap(a, b) || view_overlaps_any(a, rest...);
+}
+
+RAJA_INLINE bool any_views_overlap() { return false; }
+
+template <typename First, typename... Rest>
+RAJA_INLINE bool any_views_overlap(First const &first, Rest const &... rest)
+{
+  return view_overlaps_any(first, rest...) || any_views_overlap(rest...);
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Number of elements to allocate for a View with this layout.
+ */
+template <typename LayoutType>
+RAJA_INLINE Index_type aligned_span(LayoutType const &layout)
+{
+  return detail::layout_span(layout);
+}
+
+/*!
+ * \brief Return true if no two of the given Views share any element.
+ *
+ *        Intended for debug checks before loops over AlignedView or
+ *        RestrictView operands, e.g.
+ *        assert(RAJA::check_no_alias(a, b, c));
+ *        Views are assumed to address contiguous memory between their
+ *        first and last elements.
+ */
+template <typename... Views>
+RAJA_INLINE bool check_no_alias(Views const &... views)
+{
+  return !detail::any_views_overlap(views...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,457 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining Views whose storage type differs from
+ *          the type used for arithmetic.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_ConvertView_HPP
+#define RAJA_ConvertView_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/View.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+RAJA_HOST_DEVICE RAJA_INLINE std::uint32_t float_bits(float f)
+{
+  std::uint32_t u;
+  memcpy(&u, &f, sizeof(u));
+  return u;
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE float bits_float(std::uint32_t u)
+{
+  float f;
+  memcpy(&f, &u, sizeof(f));
+  return f;
+}
+
+//! IEEE binary32 to binary16, round to nearest even.
+RAJA_HOST_DEVICE RAJA_INLINE std::uint16_t float_to_half(float f)
+{
+  const std::uint32_t x = float_bits(f);
+  const std::uint32_t sign = (x >> 16) & 0x8000u;
+  std::uint32_t mant = x & 0x007fffffu;
+  const int exp = static_cast<int>((x >> 23) & 0xffu) - 127 + 15;
+
+  if (exp == 0xff - 127 + 15) {  // inf or nan
+    return static_cast<std::uint16_t>(sign | 0x7c00u
+                                      | (mant ? 0x0200u | (mant >> 13) : 0u));
+  }
+  if (exp >= 0x1f) {  // overflow
+    return static_cast<std::uint16_t>(sign | 0x7c00u);
+  }
+  if (exp <= 0) {  // subnormal or zero
+    if (exp < -10) return static_cast<std::uint16_t>(sign);
+    mant |= 0x00800000u;
+    const std::uint32_t shift = static_cast<std::uint32_t>(14 - exp);
+    std::uint32_t h = mant >> shift;
+    const std::uint32_t rem = mant & ((1u << shift) - 1u);
+    const std::uint32_t halfway = 1u << (shift - 1u);
+    if (rem > halfway || (rem == halfway && (h & 1u))) ++h;
+    return static_cast<std::uint16_t>(sign | h);
+  }
+
+  // a carry out of the mantissa correctly rounds up into the exponent
+  std::uint32_t h = (static_cast<std::uint32_t>(exp) << 10) | (mant >> 13);
+  const std::uint32_t rem = mant & 0x1fffu;
+  if (rem > 0x1000u || (rem == 0x1000u && (h & 1u))) ++h;
+  return static_cast<std::uint16_t>(sign | h);
+}
+
+//! IEEE binary16 to binary32 (exact). Written branch-free to vectorize.
+RAJA_HOST_DEVICE RAJA_INLINE float half_to_float(std::uint16_t h)
+{
+  const std::uint32_t sign = static_cast<std::uint32_t>(h & 0x8000u) << 16;
+  const std::uint32_t exp = (h >> 10) & 0x1fu;
+  const std::uint32_t mant = h & 0x3ffu;
+
+  const std::uint32_t normal = sign | ((exp + 112u) << 23) | (mant << 13);
+  const std::uint32_t special = sign | 0x7f800000u | (mant << 13);
+  const std::uint32_t subnormal =
+      sign | float_bits(static_cast<float>(mant) * 5.9604644775390625e-8f);
+
+  // select with masks; nested conditionals defeat if-conversion
+  const std::uint32_t is_subnormal =
+      0u - static_cast<std::uint32_t>(exp == 0u);
+  const std::uint32_t is_special =
+      0u - static_cast<std::uint32_t>(exp == 0x1fu);
+  return bits_float((subnormal & is_subnormal) | (special & is_special)
+                    | (normal & ~(is_subnormal | is_special)));
+}
+
+//! IEEE binary32 to bfloat16, round to nearest even.
+RAJA_HOST_DEVICE RAJA_INLINE std::uint16_t float_to_bfloat16(float f)
+{
+  const std::uint32_t x = float_bits(f);
+  if ((x & 0x7fffffffu) > 0x7f800000u) {  // keep nan quiet
+    return static_cast<std::uint16_t>((x >> 16) | 0x0040u);
+  }
+  return static_cast<std::uint16_t>((x + 0x7fffu + ((x >> 16) & 1u)) >> 16);
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE float bfloat16_to_float(std::uint16_t b)
+{
+  return bits_float(static_cast<std::uint32_t>(b) << 16);
+}
+
+}  // namespace detail
+
+/*!
+ * \brief 16-bit IEEE half precision storage type. Arithmetic is done after
+ *        converting to float.
+ */
+struct float16 {
+  std::uint16_t bits;
+
+  float16() = default;
+
+  RAJA_HOST_DEVICE RAJA_INLINE float16(float f)
+      : bits(detail::float_to_half(f))
+  {
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE operator float() const
+  {
+    return detail::half_to_float(bits);
+  }
+};
+
+/*!
+ * \brief 16-bit brain floating point storage type (8 exponent bits).
+ *        Arithmetic is done after converting to float.
+ */
+struct bfloat16 {
+  std::uint16_t bits;
+
+  bfloat16() = default;
+
+  RAJA_HOST_DEVICE RAJA_INLINE bfloat16(float f)
+      : bits(detail::float_to_bfloat16(f))
+  {
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE operator float() const
+  {
+    return detail::bfloat16_to_float(bits);
+  }
+};
+
+/*!
+ * \brief Proxy reference into converting storage.
+ *
+ *        Reads decode the stored element to PointerType::value_type and
+ *        assignments encode it back, so loop bodies written against a
+ *        plain View compile unchanged.
+ */
+template <typename PointerType>
+class ConvertRef
+{
+public:
+  using value_type = typename PointerType::value_type;
+
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr ConvertRef(PointerType const &ptr,
+                                                    Index_type i)
+      : m_ptr(ptr), m_i(i)
+  {
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE operator value_type() const
+  {
+    return m_ptr.load(m_i);
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE ConvertRef const &operator=(
+      value_type v) const
+  {
+    m_ptr.store(m_i, v);
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE ConvertRef const &operator=(
+      ConvertRef const &rhs) const
+  {
+    m_ptr.store(m_i, rhs.m_ptr.load(rhs.m_i));
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE ConvertRef const &operator+=(
+      value_type v) const
+  {
+    return *this = m_ptr.load(m_i) + v;
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE ConvertRef const &operator-=(
+      value_type v) const
+  {
+    return *this = m_ptr.load(m_i) - v;
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE ConvertRef const &operator*=(
+      value_type v) const
+  {
+    return *this = m_ptr.load(m_i) * v;
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE ConvertRef const &operator/=(
+      value_type v) const
+  {
+    return *this = m_ptr.load(m_i) / v;
+  }
+
+private:
+  PointerType m_ptr;
+  Index_type m_i;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Pointer type storing StorageType and computing in ComputeType.
+ *
+ *         Conversions are static_casts, so any pair of arithmetic types
+ *         works, as do float16 and bfloat16 for ComputeType float or
+ *         double.
+ *
+ ******************************************************************************
+ */
+template <typename ComputeType, typename StorageType>
+struct ConvertPtr {
+  using value_type = ComputeType;
+  using storage_type = StorageType;
+
+  StorageType *data;
+
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr ConvertPtr(StorageType *ptr = nullptr)
+      : data(ptr)
+  {
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE ComputeType load(Index_type i) const
+  {
+    return static_cast<ComputeType>(data[i]);
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE void store(Index_type i, ComputeType v) const
+  {
+    data[i] = static_cast<StorageType>(v);
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE ConvertRef<ConvertPtr> operator[](
+      Index_type i) const
+  {
+    return ConvertRef<ConvertPtr>(*this, i);
+  }
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Pointer type storing fixed-point integers with one ComputeType
+ *         scale per block of BlockSize consecutive elements.
+ *
+ *         Element i holds data[i] * scale[i / BlockSize]. Stores round to
+ *         the nearest representable value under the current block scale
+ *         and saturate, so scales must be set before writing, normally by
+ *         RAJA::compress.
+ *
+ ******************************************************************************
+ */
+template <typename ComputeType, typename IntType, Index_type BlockSize>
+struct BlockScaledPtr {
+  using value_type = ComputeType;
+  using storage_type = IntType;
+  static constexpr Index_type block_size = BlockSize;
+
+  IntType *data;
+  ComputeType *scale;
+
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr BlockScaledPtr(
+      IntType *data_ptr = nullptr,
+      ComputeType *scale_ptr = nullptr)
+      : data(data_ptr), scale(scale_ptr)
+  {
+  }
+
+  //! number of scales needed for n elements
+  static constexpr Index_type num_blocks(Index_type n)
+  {
+    return (n + BlockSize - 1) / BlockSize;
+  }
+
+  //! largest stored magnitude; symmetric so that negation is exact
+  RAJA_HOST_DEVICE static constexpr ComputeType max_int()
+  {
+    return static_cast<ComputeType>(operators::limits<IntType>::max());
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE ComputeType load(Index_type i) const
+  {
+    return static_cast<ComputeType>(data[i]) * scale[i / BlockSize];
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE void store(Index_type i, ComputeType v) const
+  {
+    const ComputeType s = scale[i / BlockSize];
+    ComputeType q = s == ComputeType(0) ? ComputeType(0) : v / s;
+    q = q > max_int() ? max_int() : (q < -max_int() ? -max_int() : q);
+    data[i] = static_cast<IntType>(q + (q < ComputeType(0) ? ComputeType(-0.5)
+                                                           : ComputeType(0.5)));
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE ConvertRef<BlockScaledPtr> operator[](
+      Index_type i) const
+  {
+    return ConvertRef<BlockScaledPtr>(*this, i);
+  }
+};
+
+template <typename ComputeType, typename IntType, Index_type BlockSize>
+constexpr Index_type
+    BlockScaledPtr<ComputeType, IntType, BlockSize>::block_size;
+
+/*!
+ * \brief View storing StorageType and returning ComputeType proxies,
+ *        e.g. ConvertView<double, float, Layout<3>>.
+ */
+template <typename ComputeType, typename StorageType, typename LayoutType>
+using ConvertView =
+    View<ComputeType, LayoutType, ConvertPtr<ComputeType, StorageType>>;
+
+/*!
+ * \brief View over block-scaled fixed-point storage,
+ *        e.g. BlockScaledView<double, int16_t, 64, Layout<2>>.
+ */
+template <typename ComputeType,
+          typename IntType,
+          Index_type BlockSize,
+          typename LayoutType>
+using BlockScaledView =
+    View<ComputeType,
+         LayoutType,
+         BlockScaledPtr<ComputeType, IntType, BlockSize>>;
+
+/*!
+ * \brief Encode n values from src into the storage behind dst.
+ *
+ *        The loop reads and writes the raw arrays directly, so it
+ *        vectorizes under simd or loop policies where the conversion does.
+ */
+template <typename ExecPolicy, typename ComputeType, typename StorageType>
+void compress(ConvertPtr<ComputeType, StorageType> dst,
+              const ComputeType *src,
+              Index_type n)
+{
+  StorageType *out = dst.data;
+  forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, n),
+                     [=] RAJA_HOST_DEVICE(Index_type i) {
+                       out[i] = static_cast<StorageType>(src[i]);
+                     });
+}
+
+/*!
+ * \brief Decode n stored values from src into dst.
+ */
+template <typename ExecPolicy, typename ComputeType, typename StorageType>
+void decompress(ConvertPtr<ComputeType, StorageType> src,
+                ComputeType *dst,
+                Index_type n)
+{
+  const StorageType *in = src.data;
+  forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, n),
+                     [=] RAJA_HOST_DEVICE(Index_type i) {
+                       dst[i] = static_cast<ComputeType>(in[i]);
+                     });
+}
+
+/*!
+ * \brief Choose the scale of every block from its largest magnitude and
+ *        encode n values from src. dst.scale must hold
+ *        BlockScaledPtr::num_blocks(n) entries.
+ *
+ *        ExecPolicy iterates over blocks; each block is processed by a
+ *        sequential inner loop of BlockSize elements.
+ */
+template <typename ExecPolicy,
+          typename ComputeType,
+          typename IntType,
+          Index_type BlockSize>
+void compress(BlockScaledPtr<ComputeType, IntType, BlockSize> dst,
+              const ComputeType *src,
+              Index_type n)
+{
+  using ptr_type = BlockScaledPtr<ComputeType, IntType, BlockSize>;
+  forall<ExecPolicy>(
+      TypedRangeSegment<Index_type>(0, ptr_type::num_blocks(n)),
+      [=] RAJA_HOST_DEVICE(Index_type b) {
+        const Index_type begin = b * BlockSize;
+        const Index_type end = begin + BlockSize < n ? begin + BlockSize : n;
+
+        ComputeType max_abs(0);
+        for (Index_type i = begin; i < end; ++i) {
+          const ComputeType a = src[i] < ComputeType(0) ? -src[i] : src[i];
+          max_abs = a > max_abs ? a : max_abs;
+        }
+        dst.scale[b] = max_abs / ptr_type::max_int();
+
+        for (Index_type i = begin; i < end; ++i) {
+          dst.store(i, src[i]);
+        }
+      });
+}
+
+/*!
+ * \brief Decode n block-scaled values from src into dst.
+ */
+template <typename ExecPolicy,
+          typename ComputeType,
+          typename IntType,
+          Index_type BlockSize>
+void decompress(BlockScaledPtr<ComputeType, IntType, BlockSize> src,
+                ComputeType *dst,
+                Index_type n)
+{
+  forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, n),
+                     [=] RAJA_HOST_DEVICE(Index_type i) {
+                       dst[i] = src.load(i);
+                     });
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,86 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining a non-owning reference to a callable.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_FunctionRef_HPP
+#define RAJA_FunctionRef_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+#include <utility>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+template <typename Signature>
+class FunctionRef;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Type-erased, non-owning reference to a host callable.
+ *
+ *         A FunctionRef stores a pointer to the callable and a pointer to a
+ *         function that invokes it, so code taking a FunctionRef can be
+ *         compiled once for every callable with the same signature. The
+ *         referenced callable must outlive the FunctionRef.
+ *
+ ******************************************************************************
+ */
+template <typename Ret, typename... Args>
+class FunctionRef<Ret(Args...)>
+{
+public:
+  template <typename Callable,
+            typename = typename std::enable_if<
+                !std::is_same<typename std::decay<Callable>::type,
+                              FunctionRef>::value>::type>
+  FunctionRef(Callable&& callable)
+      : m_obj(const_cast<void*>(static_cast<const void*>(&callable))),
+        m_call(&call<typename std::remove_reference<Callable>::type>)
+  {
+  }
+
+  RAJA_INLINE Ret operator()(Args... args) const
+  {
+    return m_call(m_obj, std::forward<Args>(args)...);
+  }
+
+private:
+  template <typename Callable>
+  static Ret call(void* obj, Args... args)
+  {
+    return (*static_cast<Callable*>(obj))(std::forward<Args>(args)...);
+  }
+
+  void* m_obj;
+  Ret (*m_call)(void*, Args...);
+};
+
+}  // namespace RAJA
+
+#endif
@@ -28,8 +28,12 @@
 
 #include "RAJA/config.hpp"
 
-// for RAJA::reduce::detail::ValueLoc
-#include "RAJA/pattern/detail/reduce.hpp"
+#include <cstddef>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/SoAFields.hpp"
+#include "RAJA/util/macros.hpp"
 
 namespace RAJA
 {
@@ -42,8 +46,9 @@ namespace detail
  *
  * This is useful for creating a vectorizable data layout and getting
  * coalesced memory accesses or avoiding shared memory bank conflicts in cuda.
+ * Types registered with soa_fields get one array per field.
  */
-template <typename T, size_t size>
+template <typename T, size_t size, bool = soa_registered<T>::value>
 class SoAArray
 {
   using value_type = T;
@@ -56,30 +61,58 @@ private:
   value_type mem[size];
 };
 
-/*!
- * @brief Specialization for RAJA::reduce::detail::ValueLoc.
- */
-template <typename T, bool doing_min, size_t size>
-class SoAArray< ::RAJA::reduce::detail::ValueLoc<T, doing_min>, size>
+//! Fixed-size array holding field I; soa_field_arrays derives from one per
+//! field.
+template <camp::idx_t I, typename Member, size_t size>
+struct soa_fixed_array {
+  Member mem[size];
+};
+
+template <camp::idx_t I, typename Member, size_t size>
+RAJA_HOST_DEVICE RAJA_INLINE Member *soa_fixed_array_mem(
+    soa_fixed_array<I, Member, size> &a)
 {
-  using value_type = ::RAJA::reduce::detail::ValueLoc<T, doing_min>;
-  using first_type = T;
-  using second_type = Index_type;
+  return a.mem;
+}
+
+template <camp::idx_t I, typename Member, size_t size>
+RAJA_HOST_DEVICE RAJA_INLINE Member const *soa_fixed_array_mem(
+    soa_fixed_array<I, Member, size> const &a)
+{
+  return a.mem;
+}
+
+template <typename T, size_t size, typename Seq = soa_indices<T>>
+class soa_field_arrays;
+
+template <typename T, size_t size, camp::idx_t... I>
+class soa_field_arrays<T, size, camp::idx_seq<I...>>
+    : soa_fixed_array<I, soa_member_t<T, I>, size>...
+{
+  using value_type = T;
 
 public:
   RAJA_HOST_DEVICE value_type get(size_t i) const
   {
-    return value_type(mem[i], mem_idx[i]);
+    value_type val;
+    camp::sink((soa_field_t<T, I>::get(val) =
+                    soa_fixed_array_mem<I>(*this)[i])...);
+    return val;
   }
   RAJA_HOST_DEVICE void set(size_t i, value_type val)
   {
-    mem[i] = val;
-    mem_idx[i] = val.getLoc();
+    camp::sink((soa_fixed_array_mem<I>(*this)[i] =
+                    soa_field_t<T, I>::get(val))...);
   }
+};
 
-private:
-  first_type mem[size];
-  second_type mem_idx[size];
+/*!
+ * @brief Specialization for types registered with soa_fields, such as
+ *        RAJA::reduce::detail::ValueLoc.
+ */
+template <typename T, size_t size>
+class SoAArray<T, size, true> : public soa_field_arrays<T, size>
+{
 };
 
 }  // namespace detail
@@ -0,0 +1,166 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the compile-time field registry used
+ *          to store structs as one array per field (Struct of Arrays).
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_SoAFields_HPP
+#define RAJA_SoAFields_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * \brief Compile-time description of one data member of a struct.
+ *
+ *        Normally spelled with RAJA_SOA_FIELD(Struct, member).
+ */
+template <typename MemberPointer, MemberPointer Pointer>
+struct SoAField;
+
+template <typename Struct, typename Member, Member Struct::*Pointer>
+struct SoAField<Member Struct::*, Pointer> {
+  using struct_type = Struct;
+  using member_type = Member;
+
+  RAJA_HOST_DEVICE static constexpr Member Struct::*pointer()
+  {
+    return Pointer;
+  }
+
+  RAJA_HOST_DEVICE static RAJA_INLINE Member &get(Struct &s)
+  {
+    return s.*Pointer;
+  }
+
+  RAJA_HOST_DEVICE static RAJA_INLINE Member const &get(Struct const &s)
+  {
+    return s.*Pointer;
+  }
+};
+
+#define RAJA_SOA_FIELD(STRUCT, MEMBER) \
+  ::RAJA::SoAField<decltype(&STRUCT::MEMBER), &STRUCT::MEMBER>
+
+/*!
+ * \brief Base class for soa_fields specializations.
+ */
+template <typename... Fields>
+struct soa_field_list {
+  using fields = camp::list<Fields...>;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Field registry for a struct stored field by field.
+ *
+ *         Specialize for each struct, listing the members to be stored:
+ *
+ * \verbatim
+ *
+ *   struct Particle { double x, y, z; int id; };
+ *
+ *   namespace RAJA {
+ *   template <>
+ *   struct soa_fields<Particle>
+ *       : soa_field_list<RAJA_SOA_FIELD(Particle, x),
+ *                        RAJA_SOA_FIELD(Particle, y),
+ *                        RAJA_SOA_FIELD(Particle, z),
+ *                        RAJA_SOA_FIELD(Particle, id)> {
+ *   };
+ *   }
+ *
+ * \endverbatim
+ *
+ *         Members that are not listed are neither stored nor converted.
+ *         SoAView, SoAPtr and SoAArray store a registered struct field by
+ *         field; other types are stored whole.
+ *
+ ******************************************************************************
+ */
+template <typename Struct>
+struct soa_fields {
+};
+
+//! true if soa_fields is specialized for Struct.
+template <typename Struct, typename Enable = void>
+struct soa_registered : std::false_type {
+};
+
+template <typename Struct>
+struct soa_registered<
+    Struct,
+    typename std::conditional<true,
+                              void,
+                              typename soa_fields<Struct>::fields>::type>
+    : std::true_type {
+};
+
+//! Number of registered fields of Struct.
+template <typename Struct>
+struct soa_num_fields
+    : camp::num<camp::size<typename soa_fields<Struct>::fields>::value> {
+};
+
+//! SoAField describing field I of Struct.
+template <typename Struct, camp::idx_t I>
+using soa_field_t = camp::at_v<typename soa_fields<Struct>::fields, I>;
+
+//! Type of field I of Struct.
+template <typename Struct, camp::idx_t I>
+using soa_member_t = typename soa_field_t<Struct, I>::member_type;
+
+namespace detail
+{
+
+template <typename Struct>
+using soa_indices = camp::make_idx_seq_t<soa_num_fields<Struct>::value>;
+
+//! Index of the last field of Struct with type Member, or -1.
+template <typename Struct,
+          typename Member,
+          camp::idx_t I = soa_num_fields<Struct>::value - 1>
+struct soa_last_field_of
+    : camp::num<std::is_same<soa_member_t<Struct, I>, Member>::value
+                    ? I
+                    : soa_last_field_of<Struct, Member, I - 1>::value> {
+};
+
+template <typename Struct, typename Member>
+struct soa_last_field_of<Struct, Member, -1> : camp::num<-1> {
+};
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -3,7 +3,8 @@
  *
  * \file
  *
- * \brief   Header file for common RAJA internal definitions.
+ * \brief   Header file defining pointers to structs stored as one array per
+ *          field (Struct of Arrays).
  *
  ******************************************************************************
  */
@@ -28,8 +29,14 @@
 
 #include "RAJA/config.hpp"
 
-// for RAJA::reduce::detail::ValueLoc
-#include "RAJA/pattern/detail/reduce.hpp"
+#include <cstddef>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/SoAFields.hpp"
+#include "RAJA/util/basic_mempool.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
 
 namespace RAJA
 {
@@ -37,16 +44,218 @@ namespace RAJA
 namespace detail
 {
 
+//! Array holding field I; SoAPointer derives from one per field.
+template <camp::idx_t I, typename Member>
+struct soa_array {
+  Member *ptr;
+};
+
+template <camp::idx_t I, typename Member>
+RAJA_HOST_DEVICE RAJA_INLINE Member *soa_array_ptr(
+    soa_array<I, Member> const &a)
+{
+  return a.ptr;
+}
+
+}  // namespace detail
+
+template <typename Struct, typename Seq = detail::soa_indices<Struct>>
+struct SoAPointer;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Proxy for one element of a SoAPointer.
+ *
+ *         get<I>() and operator->* return references into the per-field
+ *         arrays; conversion to Struct gathers every field and assignment
+ *         from Struct scatters them:
+ *
+ * \verbatim
+ *
+ *   view(i)->*&Particle::x += dt * view(i)->*&Particle::vx;
+ *   Particle p = view(i);
+ *   view(j) = p;
+ *
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename Struct>
+class SoARef
+{
+public:
+  using pointer_type = SoAPointer<Struct>;
+
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr SoARef(pointer_type const &ptr,
+                                                Index_type i)
+      : m_ptr(ptr), m_i(i)
+  {
+  }
+
+  //! reference to field I
+  template <camp::idx_t I>
+  RAJA_HOST_DEVICE RAJA_INLINE soa_member_t<Struct, I> &get() const
+  {
+    return m_ptr.template field<I>()[m_i];
+  }
+
+  /*!
+   * \brief Reference to the field registered for member pointer mp.
+   *
+   *        When Struct has a single registered field of type Member the
+   *        field is selected at compile time; otherwise mp is compared
+   *        against the candidates, which folds away for constant mp.
+   *        mp must be one of the registered fields.
+   */
+  template <typename Member>
+  RAJA_HOST_DEVICE RAJA_INLINE Member &operator->*(Member Struct::*mp) const
+  {
+    static_assert(detail::soa_last_field_of<Struct, Member>::value >= 0,
+                  "no field of this type is registered in soa_fields");
+    return lookup(mp, camp::num<0>{});
+  }
+
+  //! copy the registered fields into s, leaving other members unchanged
+  RAJA_HOST_DEVICE RAJA_INLINE void load(Struct &s) const
+  {
+    gather(s, detail::soa_indices<Struct>{});
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE operator Struct() const
+  {
+    Struct s;
+    load(s);
+    return s;
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE SoARef const &operator=(Struct const &s) const
+  {
+    scatter(s, detail::soa_indices<Struct>{});
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE SoARef const &operator=(SoARef const &o) const
+  {
+    return *this = static_cast<Struct>(o);
+  }
+
+private:
+  template <camp::idx_t... I>
+  RAJA_HOST_DEVICE RAJA_INLINE void gather(Struct &s,
+                                           camp::idx_seq<I...>) const
+  {
+    camp::sink((soa_field_t<Struct, I>::get(s) = get<I>())...);
+  }
+
+  template <camp::idx_t... I>
+  RAJA_HOST_DEVICE RAJA_INLINE void scatter(Struct const &s,
+                                            camp::idx_seq<I...>) const
+  {
+    camp::sink((get<I>() = soa_field_t<Struct, I>::get(s))...);
+  }
+
+  // field I has another type: skip it
+  template <typename Member, camp::idx_t I>
+  RAJA_HOST_DEVICE RAJA_INLINE Member &lookup(Member Struct::*mp,
+                                              camp::num<I>,
+                                              camp::num<0>) const
+  {
+    return lookup(mp, camp::num<I + 1>{});
+  }
+
+  // field I has type Member and is the last candidate
+  template <typename Member, camp::idx_t I>
+  RAJA_HOST_DEVICE RAJA_INLINE Member &lookup(Member Struct::*,
+                                              camp::num<I>,
+                                              camp::num<1>) const
+  {
+    return get<I>();
+  }
+
+  // field I has type Member and later fields do too
+  template <typename Member, camp::idx_t I>
+  RAJA_HOST_DEVICE RAJA_INLINE Member &lookup(Member Struct::*mp,
+                                              camp::num<I>,
+                                              camp::num<2>) const
+  {
+    return mp == soa_field_t<Struct, I>::pointer()
+               ? get<I>()
+               : lookup(mp, camp::num<I + 1>{});
+  }
+
+  template <typename Member, camp::idx_t I>
+  RAJA_HOST_DEVICE RAJA_INLINE Member &lookup(Member Struct::*mp,
+                                              camp::num<I> i) const
+  {
+    using kind = camp::num<
+        !std::is_same<soa_member_t<Struct, I>, Member>::value
+            ? 0
+            : (detail::soa_last_field_of<Struct, Member>::value == I ? 1
+                                                                     : 2)>;
+    return lookup(mp, i, kind{});
+  }
+
+  pointer_type m_ptr;
+  Index_type m_i;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Pointer type holding one array per registered field of Struct.
+ *
+ *         Indexing returns a SoARef proxy, so View<Struct, Layout,
+ *         SoAPointer<Struct>> (SoAView) addresses user structs while each
+ *         field stays contiguous in memory.
+ *
+ ******************************************************************************
+ */
+template <typename Struct, camp::idx_t... I>
+struct SoAPointer<Struct, camp::idx_seq<I...>>
+    : detail::soa_array<I, soa_member_t<Struct, I>>... {
+  using value_type = Struct;
+
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr SoAPointer()
+      : detail::soa_array<I, soa_member_t<Struct, I>>{nullptr}...
+  {
+  }
+
+  //! one pointer per registered field, in registration order
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr SoAPointer(
+      soa_member_t<Struct, I> *... ptrs)
+      : detail::soa_array<I, soa_member_t<Struct, I>>{ptrs}...
+  {
+  }
+
+  //! pointer to the array holding field J
+  template <camp::idx_t J>
+  RAJA_HOST_DEVICE RAJA_INLINE soa_member_t<Struct, J> *field() const
+  {
+    return detail::soa_array_ptr<J>(*this);
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE SoARef<Struct> operator[](Index_type i) const
+  {
+    return SoARef<Struct>(*this, i);
+  }
+};
+
+namespace detail
+{
+
 /*!
  * @brief Pointer class specialized for Struct of Array data layout allocated
  *        via RAJA basic_mempools.
  *
  * This is useful for creating a vectorizable data layout and getting
  * coalesced memory accesses or avoiding shared memory bank conflicts in cuda.
+ * Types registered with soa_fields get one allocation per field.
  */
 template <typename T,
           typename mempool = RAJA::basic_mempool::MemPool<
-              RAJA::basic_mempool::generic_allocator> >
+              RAJA::basic_mempool::generic_allocator>,
+          bool = soa_registered<T>::value>
 class SoAPtr
 {
   using value_type = T;
@@ -80,55 +289,55 @@ private:
   value_type* mem = nullptr;
 };
 
+template <typename mempool, typename T, camp::idx_t... I>
+SoAPointer<T> soa_pool_allocate(size_t size, camp::idx_seq<I...>)
+{
+  return SoAPointer<T>(
+      mempool::getInstance().template malloc<soa_member_t<T, I>>(size)...);
+}
+
+template <typename mempool, typename T, camp::idx_t... I>
+void soa_pool_free(SoAPointer<T> const& ptr, camp::idx_seq<I...>)
+{
+  camp::sink((mempool::getInstance().free(ptr.template field<I>()), 0)...);
+}
+
 /*!
- * @brief Specialization for RAJA::reduce::detail::ValueLoc.
+ * @brief Specialization for types registered with soa_fields, such as
+ *        RAJA::reduce::detail::ValueLoc.
  */
-template <typename T, bool doing_min, typename mempool>
-class SoAPtr<RAJA::reduce::detail::ValueLoc<T, doing_min>, mempool>
+template <typename T, typename mempool>
+class SoAPtr<T, mempool, true>
 {
-  using value_type = RAJA::reduce::detail::ValueLoc<T, doing_min>;
-  using first_type = T;
-  using second_type = Index_type;
+  using value_type = T;
 
 public:
   SoAPtr() = default;
-  explicit SoAPtr(size_t size)
-      : mem(mempool::getInstance().template malloc<first_type>(size)),
-        mem_idx(mempool::getInstance().template malloc<second_type>(size))
-  {
-  }
+  explicit SoAPtr(size_t size) { allocate(size); }
 
   SoAPtr& allocate(size_t size)
   {
-    mem = mempool::getInstance().template malloc<first_type>(size);
-    mem_idx = mempool::getInstance().template malloc<second_type>(size);
+    mem = soa_pool_allocate<mempool, T>(size, soa_indices<T>{});
     return *this;
   }
 
   SoAPtr& deallocate()
   {
-    mempool::getInstance().free(mem);
-    mem = nullptr;
-    mempool::getInstance().free(mem_idx);
-    mem_idx = nullptr;
+    soa_pool_free<mempool>(mem, soa_indices<T>{});
+    mem = SoAPointer<T>();
     return *this;
   }
 
-  RAJA_HOST_DEVICE bool allocated() const { return mem != nullptr; }
-
-  RAJA_HOST_DEVICE value_type get(size_t i) const
-  {
-    return value_type(mem[i], mem_idx[i]);
-  }
-  RAJA_HOST_DEVICE void set(size_t i, value_type val)
+  RAJA_HOST_DEVICE bool allocated() const
   {
-    mem[i] = val;
-    mem_idx[i] = val.getLoc();
+    return mem.template field<0>() != nullptr;
   }
 
+  RAJA_HOST_DEVICE value_type get(size_t i) const { return mem[i]; }
+  RAJA_HOST_DEVICE void set(size_t i, value_type val) { mem[i] = val; }
+
 private:
-  first_type* mem = nullptr;
-  second_type* mem_idx = nullptr;
+  SoAPointer<T> mem;
 };
 
 }  // namespace detail
@@ -0,0 +1,131 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining Views that store user structs as one
+ *          contiguous array per field (Struct of Arrays).
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_SoAView_HPP
+#define RAJA_SoAView_HPP
+
+#include "RAJA/config.hpp"
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+#include "RAJA/util/SoAFields.hpp"
+#include "RAJA/util/SoAPtr.hpp"
+#include "RAJA/util/View.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * \brief View of Struct elements stored field by field,
+ *        e.g. SoAView<Particle, Layout<1>>.
+ */
+template <typename Struct, typename LayoutType>
+using SoAView = View<Struct, LayoutType, SoAPointer<Struct>>;
+
+/*!
+ * \brief Plain View over field I of a SoAView, with the same layout.
+ *
+ *        Loops over these views access unit-stride arrays directly and
+ *        vectorize like any other View.
+ */
+template <camp::idx_t I, typename Struct, typename LayoutType>
+RAJA_INLINE View<soa_member_t<Struct, I>, LayoutType> soa_field_view(
+    SoAView<Struct, LayoutType> const &view)
+{
+  return View<soa_member_t<Struct, I>, LayoutType>(
+      view.data.template field<I>(), LayoutType(view.layout));
+}
+
+namespace detail
+{
+
+template <typename Struct, camp::idx_t... I>
+RAJA_INLINE SoAPointer<Struct> soa_allocate(Index_type n,
+                                            camp::idx_seq<I...>)
+{
+  return SoAPointer<Struct>(new soa_member_t<Struct, I>[n]...);
+}
+
+template <typename Struct, camp::idx_t... I>
+RAJA_INLINE void soa_deallocate(SoAPointer<Struct> &ptr, camp::idx_seq<I...>)
+{
+  camp::sink((delete[] ptr.template field<I>(), 0)...);
+  ptr = SoAPointer<Struct>();
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Allocate n elements for each registered field of Struct.
+ */
+template <typename Struct>
+RAJA_INLINE SoAPointer<Struct> soa_allocate(Index_type n)
+{
+  return detail::soa_allocate<Struct>(n, detail::soa_indices<Struct>{});
+}
+
+/*!
+ * \brief Free arrays allocated with soa_allocate and reset ptr.
+ */
+template <typename Struct>
+RAJA_INLINE void soa_deallocate(SoAPointer<Struct> &ptr)
+{
+  detail::soa_deallocate(ptr, detail::soa_indices<Struct>{});
+}
+
+/*!
+ * \brief Copy n structs from src into the field arrays of dst.
+ */
+template <typename ExecPolicy, typename Struct>
+void aos_to_soa(const Struct *src, SoAPointer<Struct> dst, Index_type n)
+{
+  forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, n),
+                     [=] RAJA_HOST_DEVICE(Index_type i) { dst[i] = src[i]; });
+}
+
+/*!
+ * \brief Copy n elements from the field arrays of src into structs in dst.
+ *
+ *        Members of dst that are not registered fields are left unchanged.
+ */
+template <typename ExecPolicy, typename Struct>
+void soa_to_aos(SoAPointer<Struct> src, Struct *dst, Index_type n)
+{
+  forall<ExecPolicy>(TypedRangeSegment<Index_type>(0, n),
+                     [=] RAJA_HOST_DEVICE(Index_type i) {
+                       src[i].load(dst[i]);
+                     });
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
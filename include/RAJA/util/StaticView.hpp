@@ -0,0 +1,105 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining Views with compile-time extents.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_StaticView_HPP
+#define RAJA_StaticView_HPP
+
+#include "RAJA/config.hpp"
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/util/StaticLayout.hpp"
+#include "RAJA/util/View.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  View over heap or global data with compile-time extents and
+ *         strides, e.g. StaticView<double, PERM_IJ, 3, 3> for one 3x3
+ *         block of a batched matrix array:
+ *
+ * \verbatim
+ *
+ *   using Block = RAJA::StaticView<double, RAJA::PERM_IJ, 3, 3>;
+ *   Block a(a_data + 9 * e);
+ *   a(i, j) = ...;   // offset is 3 * i + j with the strides as immediates
+ *
+ * \endverbatim
+ *
+ *         Extents are available as static_extent<Block, D>::value and the
+ *         total size as Block::layout_type::size(), both constexpr, so
+ *         loops over them (e.g. statement::ForUnroll) unroll completely.
+ *
+ ******************************************************************************
+ */
+template <typename T, typename Perm, camp::idx_t... Sizes>
+using StaticView = View<T, StaticLayout<Perm, Sizes...>>;
+
+/*!
+ * \brief Compile-time extent of dimension Dim of a static layout, or of a
+ *        View over one.
+ */
+template <typename T, camp::idx_t Dim>
+struct static_extent;
+
+template <camp::idx_t... RangeInts,
+          Index_type... Sizes,
+          Index_type... Strides,
+          camp::idx_t Dim>
+struct static_extent<detail::StaticLayoutBase_impl<camp::idx_seq<RangeInts...>,
+                                                   camp::idx_seq<Sizes...>,
+                                                   camp::idx_seq<Strides...>>,
+                     Dim>
+    : camp::num<camp::seq_at<Dim, camp::idx_seq<Sizes...>>::value> {
+};
+
+template <typename ValueType,
+          typename LayoutType,
+          typename PointerType,
+          camp::idx_t Dim>
+struct static_extent<View<ValueType, LayoutType, PointerType>, Dim>
+    : static_extent<LayoutType, Dim> {
+};
+
+/*!
+ * \brief Segment [0, extent) over dimension Dim of a static View, for use
+ *        in forall or as a kernel segment.
+ */
+template <camp::idx_t Dim, typename ViewType>
+RAJA_INLINE TypedRangeSegment<Index_type> static_segment(ViewType const &)
+{
+  return TypedRangeSegment<Index_type>(0, static_extent<ViewType, Dim>::value);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -27,12 +27,14 @@
 #define RAJA_VIEW_HPP
 
 #include <type_traits>
+#include <utility>
 
 #include "RAJA/config.hpp"
 
 #include "RAJA/pattern/atomic.hpp"
 
 #include "RAJA/util/Layout.hpp"
+#include "RAJA/util/concepts.hpp"
 
 #if defined(RAJA_ENABLE_CHAI)
 #include "chai/ManagedArray.hpp"
@@ -41,6 +43,56 @@
 namespace RAJA
 {
 
+namespace detail
+{
+
+//! true if the last dimension of LayoutType is declared stride-one
+template <typename LayoutType, typename Enable = void>
+struct has_unit_last_stride : std::false_type {
+};
+
+template <typename LayoutType>
+struct has_unit_last_stride<
+    LayoutType,
+    typename std::enable_if<(LayoutType::stride1_dim >= 0)>::type>
+    : std::integral_constant<bool,
+                             static_cast<size_t>(LayoutType::stride1_dim)
+                                 == LayoutType::n_dims - 1> {
+};
+
+}  // namespace detail
+
+/*!
+ * \brief Accessor for one row of a View: every index but the last is bound,
+ *        so each access costs one multiply-add (none with a stride-one
+ *        last dimension) instead of a dot product over all indices.
+ *
+ *        Obtained from View::row; valid as long as the View's data is.
+ *        The row offset is kept apart from the data pointer and added at
+ *        each access: with an offset layout it may be negative, and
+ *        forming data + first would point before the array.
+ */
+template <typename PointerType, bool UnitStride>
+struct RowCursor {
+  using reference_type = decltype(std::declval<PointerType const &>()[0]);
+
+  PointerType data;
+  Index_type first;
+  Index_type stride;
+
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr RowCursor(PointerType data_ptr,
+                                                   Index_type first_idx,
+                                                   Index_type row_stride)
+      : data(data_ptr), first(first_idx), stride(row_stride)
+  {
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE reference_type operator()(Index_type i) const
+  {
+    return data[first + (UnitStride ? i : i * stride)];
+  }
+};
+
 template <typename ValueType,
           typename LayoutType,
           typename PointerType = ValueType *>
@@ -52,6 +104,8 @@ struct View {
   using nc_pointer_type = typename std::add_pointer<typename std::remove_const<
       typename std::remove_pointer<pointer_type>::type>::type>::type;
   using NonConstView = View<nc_value_type, layout_type, nc_pointer_type>;
+  //! value_type& for raw pointers; pointer types may return a proxy instead
+  using reference_type = decltype(std::declval<pointer_type const &>()[0]);
 
   layout_type const layout;
   pointer_type data;
@@ -88,11 +142,34 @@ struct View {
   // making this specifically typed would require unpacking the layout,
   // this is easier to maintain
   template <typename... Args>
-  RAJA_HOST_DEVICE RAJA_INLINE value_type &operator()(Args... args) const
+  RAJA_HOST_DEVICE RAJA_INLINE reference_type operator()(Args... args) const
   {
     auto idx = stripIndexType(layout(args...));
-    auto &value = data[idx];
-    return value;
+    return data[idx];
+  }
+
+  using row_type =
+      RowCursor<pointer_type, detail::has_unit_last_stride<layout_type>::value>;
+
+  /*!
+   * \brief Bind all but the last index and return a RowCursor over the
+   *        last dimension, for use in innermost loops:
+   *
+   * \verbatim
+   *
+   *   auto a_ij = a.row(i, j);
+   *   auto b_ij = b.row(i, j);
+   *   for (int k = 0; k < n; ++k) a_ij(k) += b_ij(k);
+   *
+   * \endverbatim
+   */
+  template <typename... Args>
+  RAJA_HOST_DEVICE RAJA_INLINE row_type row(Args... outer) const
+  {
+    const Index_type first = stripIndexType(layout(outer..., Index_type(0)));
+    const Index_type stride =
+        stripIndexType(layout(outer..., Index_type(1))) - first;
+    return row_type(data, first, stride);
   }
 };
 
@@ -120,10 +197,17 @@ struct TypedViewBase {
 
   RAJA_INLINE void set_data(PointerType data_ptr) { base_.set_data(data_ptr); }
 
-  RAJA_HOST_DEVICE RAJA_INLINE ValueType &operator()(IndexTypes... args) const
+  RAJA_HOST_DEVICE RAJA_INLINE typename Base::reference_type operator()(
+      IndexTypes... args) const
   {
     return base_.operator()(stripIndexType(args)...);
   }
+
+  template <typename... Args>
+  RAJA_HOST_DEVICE RAJA_INLINE typename Base::row_type row(Args... outer) const
+  {
+    return base_.row(stripIndexType(outer)...);
+  }
 };
 
 template <typename ValueType, typename LayoutType, typename... IndexTypes>
@@ -203,6 +287,13 @@ RAJA_INLINE AtomicViewWrapper<ViewType, AtomicPolicy> make_atomic_view(
   return RAJA::AtomicViewWrapper<ViewType, AtomicPolicy>(view);
 }
 
+namespace type_traits
+{
+
+template <typename T>
+struct is_view : SpecializationOf<RAJA::View, typename std::decay<T>::type> {
+};
+}  // namespace type_traits
 
 }  // namespace RAJA
 
@@ -0,0 +1,71 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Explicit instantiations of the precompiled forall entry points.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/precompiled.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+namespace RAJA
+{
+namespace precompiled
+{
+
+template <typename ExecPolicy, typename SegmentType>
+void forall(SegmentType const& segment,
+            FunctionRef<void(typename SegmentType::value_type)> body)
+{
+  using value_type = typename SegmentType::value_type;
+  RAJA::forall<ExecPolicy>(segment, [=](value_type i) { body(i); });
+}
+
+#define RAJA_PRECOMPILED_FORALL(POLICY, SEGMENT)                     \
+  template void forall<POLICY, SEGMENT>(SEGMENT const&,              \
+                                        FunctionRef<void(            \
+                                            SEGMENT::value_type)>);
+
+#define RAJA_PRECOMPILED_FORALL_SEGMENTS(POLICY)                     \
+  RAJA_PRECOMPILED_FORALL(POLICY, RAJA::RangeSegment)                \
+  RAJA_PRECOMPILED_FORALL(POLICY, RAJA::TypedRangeSegment<int>)      \
+  RAJA_PRECOMPILED_FORALL(POLICY, RAJA::ListSegment)                 \
+  RAJA_PRECOMPILED_FORALL(POLICY, RAJA::TypedListSegment<int>)
+
+RAJA_PRECOMPILED_FORALL_SEGMENTS(RAJA::seq_exec)
+RAJA_PRECOMPILED_FORALL_SEGMENTS(RAJA::loop_exec)
+RAJA_PRECOMPILED_FORALL_SEGMENTS(RAJA::simd_exec)
+
+#if defined(RAJA_ENABLE_OPENMP)
+RAJA_PRECOMPILED_FORALL_SEGMENTS(RAJA::omp_parallel_for_exec)
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+RAJA_PRECOMPILED_FORALL_SEGMENTS(RAJA::tbb_for_exec)
+#endif
+
+#undef RAJA_PRECOMPILED_FORALL_SEGMENTS
+#undef RAJA_PRECOMPILED_FORALL
+
+}  // namespace precompiled
+
+}  // namespace RAJA
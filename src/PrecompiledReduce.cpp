@@ -0,0 +1,113 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Explicit instantiations of the precompiled reduction entry points.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/precompiled.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA/policy/reduce_policy.hpp"
+
+namespace RAJA
+{
+namespace precompiled
+{
+
+template <typename ExecPolicy, typename T, typename SegmentType>
+T reduce_sum(SegmentType const& segment,
+             FunctionRef<T(typename SegmentType::value_type)> body)
+{
+  using value_type = typename SegmentType::value_type;
+  using reduce_policy =
+      typename RAJA::detail::default_reduce_policy<ExecPolicy>::type;
+
+  RAJA::ReduceSum<reduce_policy, T> sum(T(0));
+  RAJA::forall<ExecPolicy>(segment, [=](value_type i) { sum += body(i); });
+  return sum.get();
+}
+
+template <typename ExecPolicy, typename T, typename SegmentType>
+T reduce_min(SegmentType const& segment,
+             FunctionRef<T(typename SegmentType::value_type)> body)
+{
+  using value_type = typename SegmentType::value_type;
+  using reduce_policy =
+      typename RAJA::detail::default_reduce_policy<ExecPolicy>::type;
+
+  RAJA::ReduceMin<reduce_policy, T> min(operators::limits<T>::max());
+  RAJA::forall<ExecPolicy>(segment, [=](value_type i) { min.min(body(i)); });
+  return min.get();
+}
+
+template <typename ExecPolicy, typename T, typename SegmentType>
+T reduce_max(SegmentType const& segment,
+             FunctionRef<T(typename SegmentType::value_type)> body)
+{
+  using value_type = typename SegmentType::value_type;
+  using reduce_policy =
+      typename RAJA::detail::default_reduce_policy<ExecPolicy>::type;
+
+  RAJA::ReduceMax<reduce_policy, T> max(operators::limits<T>::min());
+  RAJA::forall<ExecPolicy>(segment, [=](value_type i) { max.max(body(i)); });
+  return max.get();
+}
+
+#define RAJA_PRECOMPILED_REDUCE(POLICY, TYPE, SEGMENT)                   \
+  template TYPE reduce_sum<POLICY, TYPE, SEGMENT>(                       \
+      SEGMENT const&, FunctionRef<TYPE(SEGMENT::value_type)>);           \
+  template TYPE reduce_min<POLICY, TYPE, SEGMENT>(                       \
+      SEGMENT const&, FunctionRef<TYPE(SEGMENT::value_type)>);           \
+  template TYPE reduce_max<POLICY, TYPE, SEGMENT>(                       \
+      SEGMENT const&, FunctionRef<TYPE(SEGMENT::value_type)>);
+
+#define RAJA_PRECOMPILED_REDUCE_SEGMENTS(POLICY, TYPE)                   \
+  RAJA_PRECOMPILED_REDUCE(POLICY, TYPE, RAJA::RangeSegment)              \
+  RAJA_PRECOMPILED_REDUCE(POLICY, TYPE, RAJA::TypedRangeSegment<int>)    \
+  RAJA_PRECOMPILED_REDUCE(POLICY, TYPE, RAJA::ListSegment)               \
+  RAJA_PRECOMPILED_REDUCE(POLICY, TYPE, RAJA::TypedListSegment<int>)
+
+#define RAJA_PRECOMPILED_REDUCE_TYPES(POLICY)                            \
+  RAJA_PRECOMPILED_REDUCE_SEGMENTS(POLICY, int)                          \
+  RAJA_PRECOMPILED_REDUCE_SEGMENTS(POLICY, RAJA::Index_type)             \
+  RAJA_PRECOMPILED_REDUCE_SEGMENTS(POLICY, float)                        \
+  RAJA_PRECOMPILED_REDUCE_SEGMENTS(POLICY, double)
+
+RAJA_PRECOMPILED_REDUCE_TYPES(RAJA::seq_exec)
+RAJA_PRECOMPILED_REDUCE_TYPES(RAJA::loop_exec)
+
+#if defined(RAJA_ENABLE_OPENMP)
+RAJA_PRECOMPILED_REDUCE_TYPES(RAJA::omp_parallel_for_exec)
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+RAJA_PRECOMPILED_REDUCE_TYPES(RAJA::tbb_for_exec)
+#endif
+
+#undef RAJA_PRECOMPILED_REDUCE_TYPES
+#undef RAJA_PRECOMPILED_REDUCE_SEGMENTS
+#undef RAJA_PRECOMPILED_REDUCE
+
+}  // namespace precompiled
+
+}  // namespace RAJA
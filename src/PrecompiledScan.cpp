@@ -0,0 +1,82 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Explicit instantiations of the precompiled scan entry points.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/precompiled.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+namespace RAJA
+{
+namespace precompiled
+{
+
+template <typename ExecPolicy, typename T, typename BinaryOp>
+void inclusive_scan_inplace(T* begin, T* end, BinaryOp binop)
+{
+  RAJA::inclusive_scan_inplace<ExecPolicy>(begin, end, binop);
+}
+
+template <typename ExecPolicy, typename T, typename BinaryOp>
+void exclusive_scan_inplace(T* begin, T* end, BinaryOp binop, T value)
+{
+  RAJA::exclusive_scan_inplace<ExecPolicy>(begin, end, binop, value);
+}
+
+#define RAJA_PRECOMPILED_SCAN(POLICY, TYPE, OP)                           \
+  template void inclusive_scan_inplace<POLICY, TYPE, OP>(TYPE*, TYPE*, OP); \
+  template void exclusive_scan_inplace<POLICY, TYPE, OP>(TYPE*,           \
+                                                         TYPE*,           \
+                                                         OP,              \
+                                                         TYPE);
+
+#define RAJA_PRECOMPILED_SCAN_OPS(POLICY, TYPE)                           \
+  RAJA_PRECOMPILED_SCAN(POLICY, TYPE, RAJA::operators::plus<TYPE>)        \
+  RAJA_PRECOMPILED_SCAN(POLICY, TYPE, RAJA::operators::minimum<TYPE>)     \
+  RAJA_PRECOMPILED_SCAN(POLICY, TYPE, RAJA::operators::maximum<TYPE>)
+
+#define RAJA_PRECOMPILED_SCAN_TYPES(POLICY)                               \
+  RAJA_PRECOMPILED_SCAN_OPS(POLICY, int)                                  \
+  RAJA_PRECOMPILED_SCAN_OPS(POLICY, RAJA::Index_type)                     \
+  RAJA_PRECOMPILED_SCAN_OPS(POLICY, float)                                \
+  RAJA_PRECOMPILED_SCAN_OPS(POLICY, double)
+
+RAJA_PRECOMPILED_SCAN_TYPES(RAJA::seq_exec)
+RAJA_PRECOMPILED_SCAN_TYPES(RAJA::loop_exec)
+
+#if defined(RAJA_ENABLE_OPENMP)
+RAJA_PRECOMPILED_SCAN_TYPES(RAJA::omp_parallel_for_exec)
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+RAJA_PRECOMPILED_SCAN_TYPES(RAJA::tbb_for_exec)
+#endif
+
+#undef RAJA_PRECOMPILED_SCAN_TYPES
+#undef RAJA_PRECOMPILED_SCAN_OPS
+#undef RAJA_PRECOMPILED_SCAN
+
+}  // namespace precompiled
+
+}  // namespace RAJA
@@ -0,0 +1,178 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA bucket_partition.
+///
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+using RAJA::Index_type;
+
+namespace
+{
+
+//! Stable counting sort reference.
+void reference(std::vector<int> const& keys,
+               Index_type nbuckets,
+               std::vector<Index_type>& perm,
+               std::vector<Index_type>& offsets)
+{
+  perm.resize(keys.size());
+  std::iota(perm.begin(), perm.end(), Index_type(0));
+  std::stable_sort(perm.begin(), perm.end(), [&](Index_type a, Index_type b) {
+    return keys[a] < keys[b];
+  });
+  offsets.assign(nbuckets + 1, 0);
+  for (int k : keys) {
+    ++offsets[k + 1];
+  }
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+}
+
+}  // namespace
+
+template <typename ExecPolicy>
+class BucketPartitionTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_CASE_P(BucketPartitionTest);
+
+TYPED_TEST_P(BucketPartitionTest, RandomKeys)
+{
+  using Pol = TypeParam;
+  for (Index_type nbuckets : {1, 7, 1000}) {
+    std::mt19937 gen(static_cast<unsigned>(nbuckets));
+    std::uniform_int_distribution<int> dist(0, nbuckets - 1);
+    std::vector<int> keys(100000);
+    for (int& k : keys) {
+      k = dist(gen);
+    }
+    std::vector<Index_type> ref_perm;
+    std::vector<Index_type> ref_offsets;
+    reference(keys, nbuckets, ref_perm, ref_offsets);
+
+    std::vector<Index_type> perm(keys.size(), -1);
+    std::vector<Index_type> offsets(nbuckets + 1, -1);
+    RAJA::bucket_partition<Pol>(keys, nbuckets, perm.data(), offsets.data());
+    ASSERT_EQ(offsets, ref_offsets);
+    ASSERT_EQ(perm, ref_perm);
+  }
+}
+
+TYPED_TEST_P(BucketPartitionTest, SkewedKeys)
+{
+  using Pol = TypeParam;
+  // most keys in one bucket, many empty buckets, 32-bit output indices
+  const Index_type nbuckets = 64;
+  std::vector<int> keys(70000);
+  for (size_t i = 0; i < keys.size(); ++i) {
+    keys[i] = i % 10 == 0 ? static_cast<int>((i * 7) % 16) * 4 : 9;
+  }
+  std::vector<Index_type> ref_perm;
+  std::vector<Index_type> ref_offsets;
+  reference(keys, nbuckets, ref_perm, ref_offsets);
+
+  std::vector<int> perm(keys.size(), -1);
+  std::vector<long> offsets(nbuckets + 1, -1);
+  RAJA::bucket_partition<Pol>(keys, nbuckets, perm.begin(), offsets.begin());
+  ASSERT_TRUE(std::equal(offsets.begin(), offsets.end(), ref_offsets.begin()));
+  ASSERT_TRUE(std::equal(perm.begin(), perm.end(), ref_perm.begin()));
+}
+
+TYPED_TEST_P(BucketPartitionTest, IndexSet)
+{
+  using Pol = TypeParam;
+  const Index_type nbuckets = 5;
+  std::vector<int> keys(20000);
+  for (size_t i = 0; i < keys.size(); ++i) {
+    keys[i] = static_cast<int>((i * i) % 4);  // bucket 4 stays empty
+  }
+  std::vector<Index_type> perm(keys.size());
+  std::vector<Index_type> offsets(nbuckets + 1);
+  RAJA::TypedIndexSet<RAJA::ListSegment> iset;
+  RAJA::bucket_partition<Pol>(
+      keys, nbuckets, perm.data(), offsets.data(), iset);
+
+  ASSERT_EQ(iset.getNumSegments(), static_cast<size_t>(nbuckets));
+  ASSERT_EQ(iset.getLength(), keys.size());
+  for (Index_type b = 0; b < nbuckets; ++b) {
+    auto const& seg = iset.getSegment<RAJA::ListSegment>(b);
+    ASSERT_EQ(seg.size(), offsets[b + 1] - offsets[b]);
+    ASSERT_EQ(seg.getIndexOwnership(), RAJA::Unowned);
+  }
+  ASSERT_EQ(iset.getSegment<RAJA::ListSegment>(4).size(), 0);
+
+  // visiting the index set segment by segment sees the keys in order
+  std::vector<int> visited;
+  RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      iset, [&](Index_type i) { visited.push_back(keys[i]); });
+  ASSERT_EQ(visited.size(), keys.size());
+  ASSERT_TRUE(std::is_sorted(visited.begin(), visited.end()));
+}
+
+TYPED_TEST_P(BucketPartitionTest, EdgeCases)
+{
+  using Pol = TypeParam;
+  std::vector<int> keys;
+  std::vector<Index_type> perm(1, -1);
+  std::vector<Index_type> offsets(4, -1);
+
+  // no keys: all buckets empty
+  RAJA::bucket_partition<Pol>(keys, 3, perm.data(), offsets.data());
+  ASSERT_EQ(offsets, (std::vector<Index_type>{0, 0, 0, 0}));
+  ASSERT_EQ(perm[0], -1);
+
+  // no buckets: nothing written
+  keys = {0};
+  offsets.assign(4, -1);
+  RAJA::bucket_partition<Pol>(keys, 0, perm.data(), offsets.data());
+  ASSERT_EQ(offsets[0], -1);
+
+  keys = {2, 0, 2, 1};
+  perm.assign(4, -1);
+  RAJA::bucket_partition<Pol>(keys, 3, perm.data(), offsets.data());
+  ASSERT_EQ(perm, (std::vector<Index_type>{1, 3, 0, 2}));
+  ASSERT_EQ(offsets, (std::vector<Index_type>{0, 1, 2, 4}));
+}
+
+REGISTER_TYPED_TEST_CASE_P(BucketPartitionTest,
+                           RandomKeys,
+                           SkewedKeys,
+                           IndexSet,
+                           EdgeCases);
+
+using BucketPolicies = ::testing::Types<RAJA::seq_exec,
+                                        RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                        ,
+                                        RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                        ,
+                                        RAJA::tbb_for_exec
+#endif
+                                        >;
+
+INSTANTIATE_TYPED_TEST_CASE_P(BucketPartition,
+                              BucketPartitionTest,
+                              BucketPolicies);
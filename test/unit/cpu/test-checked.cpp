@@ -0,0 +1,156 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA checked (race-detecting) execution.
+///
+
+#include <cstdlib>
+#include <sstream>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "RAJA/policy/checked.hpp"
+
+#include "RAJA_gtest.hpp"
+
+template <typename T>
+class CheckedTest : public ::testing::Test
+{
+};
+
+using ExecTypes = ::testing::Types<RAJA::seq_exec,
+                                   RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                   ,
+                                   RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                   ,
+                                   RAJA::tbb_for_exec
+#endif
+                                   >;
+
+TYPED_TEST_CASE(CheckedTest, ExecTypes);
+
+using view_type = RAJA::View<double, RAJA::Layout<1>>;
+
+static_assert(RAJA::type_traits::is_sequential_policy<
+                  RAJA::checked_exec<RAJA::seq_exec>>::value,
+              "checked_exec must keep the traits of the wrapped policy");
+#if defined(RAJA_ENABLE_OPENMP)
+static_assert(RAJA::type_traits::is_openmp_policy<
+                  RAJA::checked_exec<RAJA::omp_parallel_for_exec>>::value,
+              "checked_exec must keep the traits of the wrapped policy");
+#endif
+
+TYPED_TEST(CheckedTest, IndependentWritesPass)
+{
+  using policy = RAJA::checked_exec<TypeParam>;
+  const int N = 1000;
+  std::vector<double> a(N, 1.0), b(N, 2.0);
+
+  RAJA::RaceChecker checker(true);
+  auto A = RAJA::make_checked_view(view_type(a.data(), N), checker, "a");
+  auto B = RAJA::make_checked_view(view_type(b.data(), N), checker, "b");
+
+  RAJA::forall<policy>(RAJA::RangeSegment(0, N), [=](RAJA::Index_type i) {
+    A(i) += 3.0 * B(i);
+  });
+
+  ASSERT_TRUE(checker.ok());
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(a[i], 7.0);
+  }
+
+  // a second loop may touch the same elements from other iterations
+  RAJA::forall<policy>(RAJA::RangeSegment(0, N), [=](RAJA::Index_type i) {
+    A(N - 1 - i) = 0.0;
+  });
+
+  ASSERT_TRUE(checker.ok());
+}
+
+TYPED_TEST(CheckedTest, WriteWriteConflict)
+{
+  using policy = RAJA::checked_exec<TypeParam>;
+  const int N = 1000;
+  std::vector<double> a(N, 0.0);
+
+  RAJA::RaceChecker checker;
+  auto A = RAJA::make_checked_view(view_type(a.data(), N), checker, "a");
+
+  RAJA::forall<policy>(RAJA::RangeSegment(0, N), [=](RAJA::Index_type i) {
+    A(i / 2) = 1.0;
+  });
+
+  ASSERT_EQ(checker.num_conflicts(), static_cast<std::size_t>(N / 2));
+
+  auto conflicts = checker.conflicts();
+  ASSERT_FALSE(conflicts.empty());
+  auto const& c = conflicts.front();
+  ASSERT_EQ(c.kind, RAJA::RaceConflict::Kind::write_write);
+  ASSERT_EQ(c.view, "a");
+  ASSERT_EQ(c.first_iteration / 2, c.offset);
+  ASSERT_EQ(c.second_iteration / 2, c.offset);
+  ASSERT_NE(c.first_iteration, c.second_iteration);
+
+  std::ostringstream os;
+  checker.report(os);
+  ASSERT_NE(os.str().find("write/write conflict on a"), std::string::npos);
+  ASSERT_NE(os.str().find("further conflicts not shown"), std::string::npos);
+}
+
+TYPED_TEST(CheckedTest, ReadWriteConflict)
+{
+  using policy = RAJA::checked_exec<TypeParam>;
+  const int N = 100;
+  std::vector<double> a(N, 1.0);
+
+  RAJA::RaceChecker unchecked_reads;
+  auto A = RAJA::make_checked_view(view_type(a.data(), N), unchecked_reads);
+  RAJA::forall<policy>(RAJA::RangeSegment(1, N), [=](RAJA::Index_type i) {
+    A(i) = A(i - 1) + 1.0;
+  });
+  ASSERT_TRUE(unchecked_reads.ok());
+
+  RAJA::RaceChecker checker(true);
+  auto B = RAJA::make_checked_view(view_type(a.data(), N), checker);
+  RAJA::forall<policy>(RAJA::RangeSegment(1, N), [=](RAJA::Index_type i) {
+    B(i) = B(i - 1) + 1.0;
+  });
+
+  // a parallel read and write of one element may both see each other
+  ASSERT_GE(checker.num_conflicts(), static_cast<std::size_t>(N - 2));
+  for (auto const& c : checker.conflicts()) {
+    ASSERT_EQ(c.kind, RAJA::RaceConflict::Kind::read_write);
+    ASSERT_EQ(std::abs(c.first_iteration - c.second_iteration), 1);
+  }
+}
+
+TEST(CheckedTest, UntrackedOutsideCheckedLoop)
+{
+  const int N = 10;
+  std::vector<double> a(N, 0.0);
+
+  RAJA::RaceChecker checker(true);
+  auto A = RAJA::make_checked_view(view_type(a.data(), N), checker);
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, N),
+                               [=](RAJA::Index_type i) { A(0) += i; });
+
+  ASSERT_TRUE(checker.ok());
+  ASSERT_EQ(a[0], 45.0);
+}
@@ -0,0 +1,148 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA forall_batched.
+///
+
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+using RAJA::Index_type;
+
+namespace
+{
+
+std::vector<Index_type> make_offsets(std::vector<Index_type> const& sizes,
+                                     Index_type base)
+{
+  std::vector<Index_type> offsets(sizes.size() + 1, base);
+  std::partial_sum(sizes.begin(), sizes.end(), offsets.begin() + 1);
+  for (size_t b = 1; b < offsets.size(); ++b) {
+    offsets[b] += base;
+  }
+  return offsets;
+}
+
+//! Run forall_batched and check that every (batch, index) pair of the
+//! batches was visited exactly once.
+template <typename ExecPolicy>
+void check_batches(std::vector<Index_type> const& offsets)
+{
+  const Index_type num_batches = offsets.size() - 1;
+  const Index_type base = offsets.front();
+  std::vector<Index_type> batch(offsets.back() - base, -1);
+  std::vector<int> visits(offsets.back() - base, 0);
+  Index_type* batch_of = batch.data();
+  int* count = visits.data();
+
+  RAJA::forall_batched<ExecPolicy>(num_batches,
+                                   offsets.data(),
+                                   [=](Index_type b, Index_type j) {
+                                     batch_of[j - base] = b;
+                                     ++count[j - base];
+                                   });
+
+  for (Index_type b = 0; b < num_batches; ++b) {
+    for (Index_type j = offsets[b]; j < offsets[b + 1]; ++j) {
+      ASSERT_EQ(visits[j - base], 1);
+      ASSERT_EQ(batch[j - base], b);
+    }
+  }
+}
+
+}  // namespace
+
+template <typename ExecPolicy>
+class ForallBatchedTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_CASE_P(ForallBatchedTest);
+
+TYPED_TEST_P(ForallBatchedTest, SmallBatches)
+{
+  std::mt19937 gen(1);
+  std::uniform_int_distribution<Index_type> dist(10, 200);
+  std::vector<Index_type> sizes(20000);
+  for (Index_type& s : sizes) {
+    s = dist(gen);
+  }
+  check_batches<TypeParam>(make_offsets(sizes, 0));
+  check_batches<TypeParam>(make_offsets(sizes, 37));
+}
+
+TYPED_TEST_P(ForallBatchedTest, SkewedBatches)
+{
+  // one batch holds most of the work, and many batches are empty
+  std::vector<Index_type> sizes(5000, 0);
+  for (size_t b = 0; b < sizes.size(); b += 3) {
+    sizes[b] = 1;
+  }
+  sizes[1234] = 100000;
+  check_batches<TypeParam>(make_offsets(sizes, 0));
+
+  std::vector<Index_type> empty(1000, 0);
+  check_batches<TypeParam>(make_offsets(empty, 5));
+}
+
+TYPED_TEST_P(ForallBatchedTest, OrderWithinBatch)
+{
+  std::vector<Index_type> offsets{0, 3, 3, 1000, 1004};
+  std::vector<Index_type> last(4, -1);
+  std::vector<int> in_order(4, 1);
+  Index_type* prev = last.data();
+  int* ok = in_order.data();
+  // forall_batched visits the indices of a batch in increasing order
+  // within each thread, and a thread's share of a batch is contiguous
+  RAJA::forall_batched<RAJA::seq_exec>(
+      4, offsets.data(), [=](Index_type b, Index_type j) {
+        if (j <= prev[b]) ok[b] = 0;
+        prev[b] = j;
+      });
+  ASSERT_EQ(in_order, (std::vector<int>{1, 1, 1, 1}));
+  ASSERT_EQ(last, (std::vector<Index_type>{2, -1, 999, 1003}));
+
+  Index_type sum = 0;
+  Index_type* s = &sum;
+  RAJA::forall_batched<TypeParam>(
+      0, offsets.data(), [=](Index_type, Index_type) { ++*s; });
+  ASSERT_EQ(sum, 0);
+}
+
+REGISTER_TYPED_TEST_CASE_P(ForallBatchedTest,
+                           SmallBatches,
+                           SkewedBatches,
+                           OrderWithinBatch);
+
+using BatchedPolicies = ::testing::Types<RAJA::seq_exec,
+                                         RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                         ,
+                                         RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                         ,
+                                         RAJA::tbb_for_exec
+#endif
+                                         >;
+
+INSTANTIATE_TYPED_TEST_CASE_P(ForallBatched,
+                              ForallBatchedTest,
+                              BatchedPolicies);
@@ -16,6 +16,7 @@
 #include <cstdlib>
 
 #include <string>
+#include <vector>
 
 #include "RAJA/RAJA.hpp"
 #include "RAJA/policy/tbb/policy.hpp"
@@ -123,6 +124,60 @@ using OpenMPTypes =
                      ExecPolicy<omp_parallel_for_segit, loop_exec> >;
 
 INSTANTIATE_TYPED_TEST_CASE_P(OpenMP, ForallTest, OpenMPTypes);
+
+using OpenMPScheduleTypes = ::testing::Types<
+    ExecPolicy<seq_segit, omp_parallel_for_dynamic<4> >,
+    ExecPolicy<seq_segit, omp_parallel_for_guided<> >,
+    ExecPolicy<seq_segit, omp_parallel_for_runtime>,
+    ExecPolicy<seq_segit,
+               omp_parallel_for_schedule_exec<
+                   policy::omp::Nonmonotonic<policy::omp::Dynamic<3> > > >,
+    ExecPolicy<seq_segit,
+               omp_parallel_for_schedule_exec<
+                   policy::omp::Monotonic<policy::omp::Guided<2> > > >,
+    ExecPolicy<omp_parallel_for_dynamic_segit<>, seq_exec>,
+    ExecPolicy<omp_parallel_for_guided_segit<2>, loop_exec>,
+    ExecPolicy<omp_parallel_for_runtime_segit, seq_exec> >;
+
+INSTANTIATE_TYPED_TEST_CASE_P(OpenMPSchedule,
+                              ForallTest,
+                              OpenMPScheduleTypes);
+
+//
+// A static schedule with chunk size 1 deals iteration i to thread
+// i % num_threads, which shows that the schedule was applied.
+//
+template <typename ExecPolicy>
+void check_round_robin(Index_type n)
+{
+  std::vector<int> thread(n, -1);
+  std::vector<int> team(n, 0);
+  int* t = thread.data();
+  int* nt = team.data();
+  forall<ExecPolicy>(RangeSegment(0, n), [=](Index_type i) {
+    t[i] = omp_get_thread_num();
+    nt[i] = omp_get_num_threads();
+  });
+  for (Index_type i = 0; i < n; ++i) {
+    ASSERT_EQ(thread[i], i % team[i]);
+  }
+}
+
+TEST(ForallOpenMPSchedule, StaticChunk)
+{
+  check_round_robin<omp_parallel_for_schedule_exec<policy::omp::Static<1> > >(
+      1000);
+}
+
+TEST(ForallOpenMPSchedule, RuntimeChunk)
+{
+  omp_sched_t kind;
+  int chunk;
+  omp_get_schedule(&kind, &chunk);
+  omp_set_schedule(omp_sched_static, 1);
+  check_round_robin<omp_parallel_for_runtime>(1000);
+  omp_set_schedule(kind, chunk);
+}
 #endif
 
 #if defined(RAJA_ENABLE_TBB)
@@ -131,7 +186,34 @@ using TBBTypes = ::testing::Types<ExecPolicy<seq_segit, tbb_for_exec>,
                                   ExecPolicy<tbb_for_exec, loop_exec>,
                                   ExecPolicy<seq_segit, tbb_for_dynamic>,
                                   ExecPolicy<tbb_for_dynamic, seq_exec>,
-                                  ExecPolicy<tbb_for_dynamic, loop_exec> >;
+                                  ExecPolicy<tbb_for_dynamic, loop_exec>,
+                                  ExecPolicy<seq_segit, tbb_for_affinity<> >,
+                                  ExecPolicy<tbb_for_affinity<>, seq_exec> >;
 
 INSTANTIATE_TYPED_TEST_CASE_P(TBB, ForallTest, TBBTypes);
+
+struct SweepKey {
+};
+
+TEST(ForallTBBAffinity, RepeatedSweeps)
+{
+  const Index_type n = 100000;
+  std::vector<double> a(n, 0.0);
+  double* ap = a.data();
+  for (int step = 0; step < 5; ++step) {
+    forall<tbb_for_affinity<> >(RangeSegment(0, n),
+                                [=](Index_type i) { ap[i] += 1.0; });
+    forall<tbb_for_affinity<SweepKey, 64> >(
+        RangeSegment(0, n), [=](Index_type i) { ap[i] += 2.0 * i; });
+  }
+  for (Index_type i = 0; i < n; ++i) {
+    ASSERT_EQ(a[i], 5.0 + 10.0 * i);
+  }
+
+  // one partitioner per key, kept across calls
+  using policy::tbb::affinity_partitioner;
+  EXPECT_EQ(&affinity_partitioner<SweepKey>(),
+            &affinity_partitioner<SweepKey>());
+  EXPECT_NE(&affinity_partitioner<SweepKey>(), &affinity_partitioner<int>());
+}
 #endif
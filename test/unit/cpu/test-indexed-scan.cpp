@@ -0,0 +1,375 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA scans over index sets and Views.
+///
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+using RAJA::Index_type;
+
+namespace
+{
+
+using ISet = RAJA::TypedIndexSet<RAJA::RangeSegment,
+                                 RAJA::ListSegment,
+                                 RAJA::RangeStrideSegment>;
+
+//! Ranges, a shuffled list and a strided range, leaving some indices out.
+ISet make_iset(std::vector<Index_type>& order)
+{
+  ISet iset;
+  iset.push_back(RAJA::RangeSegment(3, 150));
+  std::vector<Index_type> list(300);
+  std::iota(list.begin(), list.end(), 200);
+  std::shuffle(list.begin(), list.end(), std::mt19937{7});
+  list.resize(250);
+  iset.push_back(RAJA::ListSegment(list.data(), list.size()));
+  iset.push_back(RAJA::RangeStrideSegment(501, 900, 3));
+  iset.push_back(RAJA::RangeSegment(150, 151));
+  iset.push_back(RAJA::RangeSegment(900, 1000));
+
+  order.clear();
+  for (Index_type i = 3; i < 150; ++i) order.push_back(i);
+  order.insert(order.end(), list.begin(), list.end());
+  for (Index_type i = 501; i < 900; i += 3) order.push_back(i);
+  order.push_back(150);
+  for (Index_type i = 900; i < 1000; ++i) order.push_back(i);
+  return iset;
+}
+
+template <typename T>
+std::vector<T> make_values(size_t n)
+{
+  std::vector<T> v(n);
+  std::mt19937 gen(3);
+  for (auto& x : v) {
+    x = static_cast<T>(static_cast<int>(gen() % 41) - 20);
+  }
+  return v;
+}
+
+//! Expected result of an inclusive or exclusive scan in the given order.
+template <typename T, typename BinOp>
+std::vector<T> expected(std::vector<T> const& in,
+                        std::vector<Index_type> const& order,
+                        bool inclusive,
+                        T init,
+                        std::vector<T> out)
+{
+  T acc = init;
+  for (Index_type i : order) {
+    if (inclusive) {
+      acc = BinOp()(acc, in[i]);
+      out[i] = acc;
+    } else {
+      out[i] = acc;
+      acc = BinOp()(acc, in[i]);
+    }
+  }
+  return out;
+}
+
+//! Reference scan of a 3-D array along axis, indexed through view(i, j, k).
+template <typename View, typename T>
+std::vector<T> axis_reference(View const& view,
+                              std::array<Index_type, 3> n,
+                              int axis,
+                              bool inclusive,
+                              T init,
+                              size_t size)
+{
+  std::vector<T> out(size);
+  RAJA::View<T, RAJA::Layout<3>> ref(out.data(), view.layout);
+  std::array<Index_type, 3> idx;
+  const int a = (axis + 1) % 3;
+  const int b = (axis + 2) % 3;
+  for (idx[a] = 0; idx[a] < n[a]; ++idx[a]) {
+    for (idx[b] = 0; idx[b] < n[b]; ++idx[b]) {
+      T acc = init;
+      for (idx[axis] = 0; idx[axis] < n[axis]; ++idx[axis]) {
+        const T x = view(idx[0], idx[1], idx[2]);
+        if (!inclusive) ref(idx[0], idx[1], idx[2]) = acc;
+        acc += x;
+        if (inclusive) ref(idx[0], idx[1], idx[2]) = acc;
+      }
+    }
+  }
+  return out;
+}
+
+}  // namespace
+
+template <typename SegExecPolicy>
+class IndexedScanTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_CASE_P(IndexedScanTest);
+
+TYPED_TEST_P(IndexedScanTest, IndexSetInplace)
+{
+  using Pol = RAJA::ExecPolicy<RAJA::seq_segit, TypeParam>;
+  std::vector<Index_type> order;
+  ISet iset = make_iset(order);
+  const auto values = make_values<int>(1000);
+
+  auto data = values;
+  RAJA::inclusive_scan_inplace(Pol{}, iset, data.data());
+  ASSERT_EQ(data,
+            (expected<int, RAJA::operators::plus<int>>(
+                values, order, true, 0, values)));
+
+  data = values;
+  RAJA::exclusive_scan_inplace(
+      Pol{}, iset, data.data(), RAJA::operators::plus<int>{}, 5);
+  ASSERT_EQ(data,
+            (expected<int, RAJA::operators::plus<int>>(
+                values, order, false, 5, values)));
+
+  data = values;
+  RAJA::inclusive_scan_inplace(
+      Pol{}, iset, data.data(), RAJA::operators::maximum<int>{});
+  ASSERT_EQ(data,
+            (expected<int, RAJA::operators::maximum<int>>(
+                values,
+                order,
+                true,
+                RAJA::operators::maximum<int>::identity(),
+                values)));
+}
+
+TYPED_TEST_P(IndexedScanTest, IndexSetOutOfPlace)
+{
+  using Pol = RAJA::ExecPolicy<RAJA::seq_segit, TypeParam>;
+  std::vector<Index_type> order;
+  ISet iset = make_iset(order);
+  const auto values = make_values<double>(1000);
+  const std::vector<double> untouched(1000, -99.0);
+
+  auto out = untouched;
+  RAJA::inclusive_scan(Pol{}, iset, values.data(), out.data());
+  ASSERT_EQ(out,
+            (expected<double, RAJA::operators::plus<double>>(
+                values, order, true, 0.0, untouched)));
+
+  out = untouched;
+  RAJA::exclusive_scan(Pol{},
+                       iset,
+                       values.data(),
+                       out.data(),
+                       RAJA::operators::minimum<double>{},
+                       3.0);
+  ASSERT_EQ(out,
+            (expected<double, RAJA::operators::minimum<double>>(
+                values, order, false, 3.0, untouched)));
+}
+
+TYPED_TEST_P(IndexedScanTest, ViewAxes)
+{
+  using Pol = TypeParam;
+  const std::array<Index_type, 3> n{{5, 7, 300}};
+  const size_t size = n[0] * n[1] * n[2];
+  const auto values = make_values<long>(size);
+
+  // default (row-major) and permuted layouts, so each axis is the unit
+  // stride one for some layout
+  std::array<RAJA::Layout<3>, 3> layouts{
+      {RAJA::make_permuted_layout(n, {{0, 1, 2}}),
+       RAJA::make_permuted_layout(n, {{2, 0, 1}}),
+       RAJA::make_permuted_layout(n, {{1, 2, 0}})}};
+
+  for (auto const& layout : layouts) {
+    RAJA::View<const long, RAJA::Layout<3>> in(values.data(), layout);
+    for (int axis = 0; axis < 3; ++axis) {
+      std::vector<long> data(values);
+      RAJA::View<long, RAJA::Layout<3>> view(data.data(), layout);
+
+      RAJA::inclusive_scan_inplace(Pol{}, view, axis);
+      ASSERT_EQ(data, axis_reference(in, n, axis, true, 0L, size))
+          << "axis " << axis;
+
+      data = values;
+      RAJA::exclusive_scan_inplace(
+          Pol{}, view, axis, RAJA::operators::plus<long>{}, 2L);
+      ASSERT_EQ(data, axis_reference(in, n, axis, false, 2L, size))
+          << "axis " << axis;
+
+      std::vector<long> out(size, -1);
+      RAJA::View<long, RAJA::Layout<3>> out_view(out.data(), layout);
+      RAJA::inclusive_scan(Pol{}, in, out_view, axis);
+      ASSERT_EQ(out, axis_reference(in, n, axis, true, 0L, size))
+          << "axis " << axis;
+
+      RAJA::exclusive_scan(Pol{}, in, out_view, axis);
+      ASSERT_EQ(out, axis_reference(in, n, axis, false, 0L, size))
+          << "axis " << axis;
+    }
+  }
+}
+
+TYPED_TEST_P(IndexedScanTest, ViewLayoutsDiffer)
+{
+  using Pol = TypeParam;
+  const std::array<Index_type, 3> n{{4, 33, 9}};
+  const size_t size = n[0] * n[1] * n[2];
+  const auto values = make_values<double>(size);
+  auto in_layout = RAJA::make_permuted_layout(n, {{2, 1, 0}});
+  auto out_layout = RAJA::make_permuted_layout(n, {{0, 1, 2}});
+  RAJA::View<const double, RAJA::Layout<3>> in(values.data(), in_layout);
+
+  for (int axis = 0; axis < 3; ++axis) {
+    std::vector<double> out(size);
+    RAJA::View<double, RAJA::Layout<3>> out_view(out.data(), out_layout);
+    RAJA::inclusive_scan(Pol{}, in, out_view, axis);
+
+    std::vector<double> ref(size);
+    RAJA::View<double, RAJA::Layout<3>> ref_view(ref.data(), out_layout);
+    std::array<Index_type, 3> idx;
+    const int a = (axis + 1) % 3;
+    const int b = (axis + 2) % 3;
+    for (idx[a] = 0; idx[a] < n[a]; ++idx[a]) {
+      for (idx[b] = 0; idx[b] < n[b]; ++idx[b]) {
+        double acc = 0.0;
+        for (idx[axis] = 0; idx[axis] < n[axis]; ++idx[axis]) {
+          acc += in(idx[0], idx[1], idx[2]);
+          ref_view(idx[0], idx[1], idx[2]) = acc;
+        }
+      }
+    }
+    ASSERT_EQ(out, ref) << "axis " << axis;
+  }
+}
+
+TYPED_TEST_P(IndexedScanTest, ViewExplicitBinop)
+{
+  using Pol = TypeParam;
+  const Index_type rows = 6;
+  const Index_type cols = 500;
+  const auto values = make_values<double>(rows * cols);
+  RAJA::View<const double, RAJA::Layout<2>> in(values.data(), rows, cols);
+
+  // reference scans of each row with maximum and of each row with plus
+  // starting from 1.0
+  std::vector<double> max_ref(values.size());
+  std::vector<double> plus_ref(values.size());
+  for (Index_type i = 0; i < rows; ++i) {
+    double hi = RAJA::operators::maximum<double>::identity();
+    double sum = 1.0;
+    for (Index_type j = 0; j < cols; ++j) {
+      hi = RAJA::operators::maximum<double>{}(hi, in(i, j));
+      max_ref[i * cols + j] = hi;
+      plus_ref[i * cols + j] = sum;
+      sum += in(i, j);
+    }
+  }
+
+  // the axis is passed as a plain int literal alongside the binop, with
+  // input and output Views of the same type as well as a const input
+  std::vector<double> in_copy(values);
+  RAJA::View<double, RAJA::Layout<2>> in_view(in_copy.data(), rows, cols);
+  std::vector<double> out(values.size());
+  RAJA::View<double, RAJA::Layout<2>> out_view(out.data(), rows, cols);
+  RAJA::inclusive_scan(
+      Pol{}, in_view, out_view, 1, RAJA::operators::maximum<double>{});
+  ASSERT_EQ(out, max_ref);
+
+  RAJA::exclusive_scan(
+      Pol{}, in_view, out_view, 1, RAJA::operators::plus<double>{}, 1.0);
+  ASSERT_EQ(out, plus_ref);
+
+  RAJA::inclusive_scan(
+      Pol{}, in, out_view, 1, RAJA::operators::maximum<double>{});
+  ASSERT_EQ(out, max_ref);
+
+  RAJA::exclusive_scan(
+      Pol{}, in, out_view, 1, RAJA::operators::plus<double>{}, 1.0);
+  ASSERT_EQ(out, plus_ref);
+
+  out = values;
+  RAJA::inclusive_scan_inplace(
+      Pol{}, out_view, 1, RAJA::operators::maximum<double>{});
+  ASSERT_EQ(out, max_ref);
+
+  out = values;
+  RAJA::exclusive_scan_inplace(
+      Pol{}, out_view, 1, RAJA::operators::plus<double>{}, 1.0);
+  ASSERT_EQ(out, plus_ref);
+}
+
+TYPED_TEST_P(IndexedScanTest, ViewEdgeCases)
+{
+  using Pol = TypeParam;
+
+  // one-dimensional View: the parallel scan of the policy
+  std::vector<int> line(5000, 1);
+  RAJA::View<int, RAJA::Layout<1>> view1(line.data(), 5000);
+  RAJA::inclusive_scan_inplace(Pol{}, view1, 0);
+  for (int i = 0; i < 5000; ++i) {
+    ASSERT_EQ(line[i], i + 1);
+  }
+
+  // offset layout, scanned over its whole index range
+  std::vector<int> grid(6 * 4, 1);
+  RAJA::View<int, RAJA::OffsetLayout<2>> view2(
+      grid.data(), RAJA::make_offset_layout<2>({{-1, -2}}, {{4, 1}}));
+  RAJA::exclusive_scan_inplace(Pol{}, view2, 0);
+  for (int i = -1; i <= 4; ++i) {
+    for (int j = -2; j <= 1; ++j) {
+      ASSERT_EQ(view2(i, j), i + 1);
+    }
+  }
+
+  // extent-1 and empty dimensions
+  std::vector<int> column(10, 2);
+  RAJA::View<int, RAJA::Layout<2>> view3(column.data(), 10, 1);
+  RAJA::inclusive_scan_inplace(Pol{}, view3, 0);
+  ASSERT_EQ(column.back(), 20);
+  RAJA::View<int, RAJA::Layout<2>> view4(column.data(), 0, 10);
+  RAJA::inclusive_scan_inplace(Pol{}, view4, 1);
+  ASSERT_EQ(column.back(), 20);
+}
+
+REGISTER_TYPED_TEST_CASE_P(IndexedScanTest,
+                           IndexSetInplace,
+                           IndexSetOutOfPlace,
+                           ViewAxes,
+                           ViewLayoutsDiffer,
+                           ViewExplicitBinop,
+                           ViewEdgeCases);
+
+using IndexedScanPolicies = ::testing::Types<RAJA::seq_exec,
+                                             RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                             ,
+                                             RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                             ,
+                                             RAJA::tbb_for_exec
+#endif
+                                             >;
+
+INSTANTIATE_TYPED_TEST_CASE_P(IndexedScan,
+                              IndexedScanTest,
+                              IndexedScanPolicies);
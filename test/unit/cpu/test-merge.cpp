@@ -0,0 +1,221 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA merge and set operations.
+///
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+using RAJA::Index_type;
+
+namespace
+{
+
+//! Sorted indices in [0, range) with repeats and, every so often, a long
+//! run of one value.
+std::vector<Index_type> sorted_indices(Index_type n,
+                                       Index_type range,
+                                       unsigned seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<Index_type> dist(0, range - 1);
+  std::vector<Index_type> v(n);
+  for (Index_type i = 0; i < n; ++i) {
+    v[i] = i % 20011 < 9000 ? dist(gen) : 77;
+  }
+  std::sort(v.begin(), v.end());
+  return v;
+}
+
+}  // namespace
+
+template <typename ExecPolicy>
+class MergeTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_CASE_P(MergeTest);
+
+TYPED_TEST_P(MergeTest, Merge)
+{
+  using Pol = TypeParam;
+  auto a = sorted_indices(60000, 100000, 1);
+  auto b = sorted_indices(45000, 100000, 2);
+  std::vector<Index_type> ref;
+  std::merge(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(ref));
+
+  std::vector<Index_type> out(a.size() + b.size(), -1);
+  ASSERT_EQ(RAJA::merge<Pol>(
+                a.begin(), a.end(), b.begin(), b.end(), out.begin()),
+            static_cast<Index_type>(ref.size()));
+  ASSERT_EQ(out, ref);
+
+  RAJA::ListSegment seg = RAJA::merge<Pol>(a, b);
+  ASSERT_EQ(seg.size(), static_cast<Index_type>(ref.size()));
+  ASSERT_TRUE(seg.indicesEqual(ref.data(), ref.size()));
+}
+
+TYPED_TEST_P(MergeTest, MergeStable)
+{
+  using Pol = TypeParam;
+  // equal keys keep a before b and their order within each input
+  const Index_type n = 30000;
+  std::vector<int> a(n);
+  std::vector<int> b(n);
+  for (Index_type i = 0; i < n; ++i) {
+    a[i] = static_cast<int>((i / 100) * 1000 + i % 100);
+    b[i] = static_cast<int>((i / 50) * 1000 + 500 + i % 50);
+  }
+  auto by_thousands = [](int x, int y) { return x / 1000 < y / 1000; };
+  std::vector<int> ref(2 * n);
+  std::merge(a.begin(), a.end(), b.begin(), b.end(), ref.begin(),
+             by_thousands);
+  std::vector<int> out(2 * n);
+  RAJA::merge<Pol>(a.data(), a.data() + n, b.data(), b.data() + n,
+                   out.data(), by_thousands);
+  ASSERT_EQ(out, ref);
+}
+
+TYPED_TEST_P(MergeTest, SetOperations)
+{
+  using Pol = TypeParam;
+  auto a = sorted_indices(80000, 150000, 3);
+  auto b = sorted_indices(50000, 150000, 4);
+  std::vector<Index_type> out(a.size() + b.size());
+
+  std::vector<Index_type> ref;
+  std::set_union(
+      a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(ref));
+  Index_type num = RAJA::set_union<Pol>(
+      a.data(), a.data() + a.size(), b.data(), b.data() + b.size(),
+      out.data());
+  ASSERT_EQ(std::vector<Index_type>(out.begin(), out.begin() + num), ref);
+  RAJA::ListSegment seg_union = RAJA::set_union<Pol>(a, b);
+  ASSERT_TRUE(seg_union.indicesEqual(ref.data(), ref.size()));
+
+  ref.clear();
+  std::set_intersection(
+      a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(ref));
+  num = RAJA::set_intersection<Pol>(
+      a.data(), a.data() + a.size(), b.data(), b.data() + b.size(),
+      out.data());
+  ASSERT_EQ(std::vector<Index_type>(out.begin(), out.begin() + num), ref);
+  RAJA::ListSegment seg_inter = RAJA::set_intersection<Pol>(a, b);
+  ASSERT_TRUE(seg_inter.indicesEqual(ref.data(), ref.size()));
+
+  ref.clear();
+  std::set_difference(
+      a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(ref));
+  num = RAJA::set_difference<Pol>(
+      a.data(), a.data() + a.size(), b.data(), b.data() + b.size(),
+      out.data());
+  ASSERT_EQ(std::vector<Index_type>(out.begin(), out.begin() + num), ref);
+  RAJA::ListSegment seg_diff = RAJA::set_difference<Pol>(a, b);
+  ASSERT_TRUE(seg_diff.indicesEqual(ref.data(), ref.size()));
+}
+
+TYPED_TEST_P(MergeTest, SegmentInputs)
+{
+  using Pol = TypeParam;
+  // halo list: owned plus ghost indices, minus the interior
+  auto owned = sorted_indices(40000, 1000000, 5);
+  owned.erase(std::unique(owned.begin(), owned.end()), owned.end());
+  std::vector<Index_type> ghost;
+  for (Index_type i = 1000000; i < 1030000; i += 3) {
+    ghost.push_back(i);
+  }
+  std::vector<Index_type> interior(owned.begin(),
+                                   owned.begin() + owned.size() / 2);
+
+  RAJA::ListSegment owned_seg(owned);
+  RAJA::ListSegment ghost_seg(ghost);
+  RAJA::ListSegment all = RAJA::set_union<Pol>(owned_seg, ghost_seg);
+  RAJA::ListSegment halo = RAJA::set_difference<Pol>(all, interior);
+
+  std::vector<Index_type> ref(owned.begin() + owned.size() / 2, owned.end());
+  ref.insert(ref.end(), ghost.begin(), ghost.end());
+  ASSERT_EQ(all.size(), static_cast<Index_type>(owned.size() + ghost.size()));
+  ASSERT_TRUE(halo.indicesEqual(ref.data(), ref.size()));
+}
+
+TYPED_TEST_P(MergeTest, EdgeCases)
+{
+  using Pol = TypeParam;
+  std::vector<int> empty;
+  std::vector<int> a(20000, 5);
+  std::vector<int> b(30000, 5);
+  std::vector<int> out(a.size() + b.size(), -1);
+
+  // one empty input
+  ASSERT_EQ(RAJA::merge<Pol>(a.begin(), a.end(), empty.begin(), empty.end(),
+                             out.begin()),
+            20000);
+  ASSERT_TRUE(std::equal(a.begin(), a.end(), out.begin()));
+  ASSERT_EQ(RAJA::set_difference<Pol>(a.begin(), a.end(), empty.begin(),
+                                      empty.end(), out.begin()),
+            20000);
+  ASSERT_EQ(RAJA::set_intersection<Pol>(empty.begin(), empty.end(),
+                                        b.begin(), b.end(), out.begin()),
+            0);
+  ASSERT_EQ(RAJA::set_union<Pol>(empty, empty).size(), 0);
+
+  // a single value repeated in both inputs: multiset semantics
+  ASSERT_EQ(RAJA::set_union<Pol>(a.begin(), a.end(), b.begin(), b.end(),
+                                 out.begin()),
+            30000);
+  ASSERT_EQ(RAJA::set_intersection<Pol>(a.begin(), a.end(), b.begin(),
+                                        b.end(), out.begin()),
+            20000);
+  ASSERT_EQ(RAJA::set_difference<Pol>(b.begin(), b.end(), a.begin(),
+                                      a.end(), out.begin()),
+            10000);
+
+  // descending order with a custom comparison
+  std::vector<int> c = {9, 7, 5, 3};
+  std::vector<int> d = {8, 7, 1};
+  out.assign(7, -1);
+  RAJA::merge<Pol>(c.begin(), c.end(), d.begin(), d.end(), out.begin(),
+                   std::greater<int>());
+  ASSERT_EQ(out, (std::vector<int>{9, 8, 7, 7, 5, 3, 1}));
+}
+
+REGISTER_TYPED_TEST_CASE_P(MergeTest,
+                           Merge,
+                           MergeStable,
+                           SetOperations,
+                           SegmentInputs,
+                           EdgeCases);
+
+using MergePolicies = ::testing::Types<RAJA::seq_exec,
+                                       RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                       ,
+                                       RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                       ,
+                                       RAJA::tbb_for_exec
+#endif
+                                       >;
+
+INSTANTIATE_TYPED_TEST_CASE_P(Merge, MergeTest, MergePolicies);
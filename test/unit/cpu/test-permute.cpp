@@ -0,0 +1,193 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA gather, scatter and
+/// apply_permutation.
+///
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+using RAJA::Index_type;
+
+namespace
+{
+
+std::vector<Index_type> random_permutation(Index_type n, unsigned seed)
+{
+  std::vector<Index_type> perm(n);
+  std::iota(perm.begin(), perm.end(), Index_type(0));
+  std::shuffle(perm.begin(), perm.end(), std::mt19937(seed));
+  return perm;
+}
+
+}  // namespace
+
+template <typename ExecPolicy>
+class PermuteTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_CASE_P(PermuteTest);
+
+TYPED_TEST_P(PermuteTest, Gather)
+{
+  using Pol = TypeParam;
+  const Index_type n = 196731;
+  auto perm = random_permutation(n, 1);
+  std::vector<double> a(n);
+  std::vector<int> b(n);
+  std::vector<long> c(n);
+  for (Index_type i = 0; i < n; ++i) {
+    a[i] = 0.5 * i;
+    b[i] = static_cast<int>(3 * i);
+    c[i] = -i;
+  }
+  std::vector<double> a_out(n);
+  std::vector<int> b_out(n);
+  std::vector<long> c_out(n);
+
+  RAJA::gather<Pol>(perm.begin(),
+                    perm.end(),
+                    RAJA::make_tuple(a.data(), b.data(), c.data()),
+                    RAJA::make_tuple(a_out.data(), b_out.data(), c_out.data()));
+  for (Index_type i = 0; i < n; ++i) {
+    ASSERT_EQ(a_out[i], a[perm[i]]);
+    ASSERT_EQ(b_out[i], b[perm[i]]);
+    ASSERT_EQ(c_out[i], c[perm[i]]);
+  }
+
+  // many-to-one gathers are allowed
+  std::vector<int> idx(n);
+  for (Index_type i = 0; i < n; ++i) {
+    idx[i] = static_cast<int>(i % 10);
+  }
+  RAJA::gather<Pol>(idx.data(),
+                    idx.data() + n,
+                    RAJA::make_tuple(b.data()),
+                    RAJA::make_tuple(b_out.data()));
+  for (Index_type i = 0; i < n; ++i) {
+    ASSERT_EQ(b_out[i], b[i % 10]);
+  }
+}
+
+TYPED_TEST_P(PermuteTest, Scatter)
+{
+  using Pol = TypeParam;
+  const Index_type n = 327680;
+  auto perm = random_permutation(n, 2);
+  std::vector<double> a(n);
+  std::vector<Index_type> b(n);
+  for (Index_type i = 0; i < n; ++i) {
+    a[i] = 1.0 / (i + 1);
+    b[i] = i * i;
+  }
+  std::vector<double> a_out(n);
+  std::vector<Index_type> b_out(n);
+
+  RAJA::scatter<Pol>(perm.data(),
+                     perm.data() + n,
+                     RAJA::make_tuple(a.data(), b.data()),
+                     RAJA::make_tuple(a_out.data(), b_out.data()));
+  for (Index_type i = 0; i < n; ++i) {
+    ASSERT_EQ(a_out[perm[i]], a[i]);
+    ASSERT_EQ(b_out[perm[i]], b[i]);
+  }
+
+  // scatter through perm undoes a gather through perm
+  std::vector<double> a_back(n);
+  RAJA::scatter<Pol>(perm.data(),
+                     perm.data() + n,
+                     RAJA::make_tuple(a.data()),
+                     RAJA::make_tuple(a_out.data()));
+  RAJA::gather<Pol>(perm.data(),
+                    perm.data() + n,
+                    RAJA::make_tuple(a_out.data()),
+                    RAJA::make_tuple(a_back.data()));
+  ASSERT_EQ(a_back, a);
+}
+
+TYPED_TEST_P(PermuteTest, ApplyPermutation)
+{
+  using Pol = TypeParam;
+  const Index_type n = 131079;
+  auto perm = random_permutation(n, 3);
+  std::vector<float> a(n);
+  std::vector<int> b(n);
+  for (Index_type i = 0; i < n; ++i) {
+    a[i] = static_cast<float>(i) + 0.25f;
+    b[i] = static_cast<int>(n - i);
+  }
+  const std::vector<float> a_old = a;
+  const std::vector<int> b_old = b;
+
+  RAJA::apply_permutation<Pol>(
+      perm.begin(), perm.end(), RAJA::make_tuple(a.data(), b.data()));
+  for (Index_type i = 0; i < n; ++i) {
+    ASSERT_EQ(a[i], a_old[perm[i]]);
+    ASSERT_EQ(b[i], b_old[perm[i]]);
+  }
+}
+
+TYPED_TEST_P(PermuteTest, EdgeCases)
+{
+  using Pol = TypeParam;
+  std::vector<Index_type> perm;
+  std::vector<int> a = {1, 2, 3};
+  std::vector<int> out = {-1, -1, -1};
+
+  // empty permutation: nothing written
+  RAJA::gather<Pol>(perm.begin(),
+                    perm.end(),
+                    RAJA::make_tuple(a.data()),
+                    RAJA::make_tuple(out.data()));
+  RAJA::apply_permutation<Pol>(
+      perm.begin(), perm.end(), RAJA::make_tuple(out.data()));
+  ASSERT_EQ(out, (std::vector<int>{-1, -1, -1}));
+
+  // fewer entries than threads
+  perm = {2, 0, 1};
+  RAJA::gather<Pol>(perm.begin(),
+                    perm.end(),
+                    RAJA::make_tuple(a.data()),
+                    RAJA::make_tuple(out.data()));
+  ASSERT_EQ(out, (std::vector<int>{3, 1, 2}));
+  RAJA::apply_permutation<Pol>(
+      perm.begin(), perm.end(), RAJA::make_tuple(a.data()));
+  ASSERT_EQ(a, out);
+}
+
+REGISTER_TYPED_TEST_CASE_P(
+    PermuteTest, Gather, Scatter, ApplyPermutation, EdgeCases);
+
+using PermutePolicies = ::testing::Types<RAJA::seq_exec,
+                                         RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                         ,
+                                         RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                         ,
+                                         RAJA::tbb_for_exec
+#endif
+                                         >;
+
+INSTANTIATE_TYPED_TEST_CASE_P(Permute, PermuteTest, PermutePolicies);
@@ -0,0 +1,125 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the precompiled forall, reduce and
+/// scan entry points.
+///
+/// Only RAJA/precompiled.hpp is included so that these tests also check
+/// that the trimmed header is self-contained.
+///
+
+#include <numeric>
+#include <vector>
+
+#include "RAJA/precompiled.hpp"
+
+#include "RAJA_gtest.hpp"
+
+template <typename T>
+class PrecompiledTest : public ::testing::Test
+{
+};
+
+using ExecTypes = ::testing::Types<RAJA::seq_exec,
+                                   RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                   ,
+                                   RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                   ,
+                                   RAJA::tbb_for_exec
+#endif
+                                   >;
+
+TYPED_TEST_CASE(PrecompiledTest, ExecTypes);
+
+TYPED_TEST(PrecompiledTest, ForallRange)
+{
+  const RAJA::Index_type N = 1000;
+  std::vector<RAJA::Index_type> data(N, 0);
+  RAJA::Index_type* d = data.data();
+
+  RAJA::precompiled::forall<TypeParam>(RAJA::RangeSegment(0, N),
+                                       [=](RAJA::Index_type i) { d[i] = i; });
+
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_EQ(data[i], i);
+  }
+}
+
+TYPED_TEST(PrecompiledTest, ForallList)
+{
+  const int N = 1000;
+  std::vector<int> idx;
+  for (int i = 0; i < N; i += 3) {
+    idx.push_back(i);
+  }
+  RAJA::TypedListSegment<int> list(idx.data(), idx.size());
+
+  std::vector<int> data(N, 0);
+  int* d = data.data();
+  RAJA::precompiled::forall<TypeParam>(list, [=](int i) { d[i] = 1; });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(data[i], i % 3 == 0 ? 1 : 0);
+  }
+}
+
+TYPED_TEST(PrecompiledTest, Reduce)
+{
+  const int N = 1000;
+  std::vector<double> data(N);
+  for (int i = 0; i < N; ++i) {
+    data[i] = (i * 37) % 101 - 50;
+  }
+  const double* d = data.data();
+  RAJA::TypedRangeSegment<int> range(0, N);
+
+  double sum = RAJA::precompiled::reduce_sum<TypeParam, double>(
+      range, [=](int i) { return d[i]; });
+  double min = RAJA::precompiled::reduce_min<TypeParam, double>(
+      range, [=](int i) { return d[i]; });
+  double max = RAJA::precompiled::reduce_max<TypeParam, double>(
+      range, [=](int i) { return d[i]; });
+
+  ASSERT_EQ(sum, std::accumulate(data.begin(), data.end(), 0.0));
+  ASSERT_EQ(min, -50.0);
+  ASSERT_EQ(max, 50.0);
+
+  int count = RAJA::precompiled::reduce_sum<TypeParam, int>(
+      RAJA::TypedRangeSegment<int>(0, 0), [=](int) { return 1; });
+  ASSERT_EQ(count, 0);
+}
+
+TYPED_TEST(PrecompiledTest, Scan)
+{
+  const int N = 1000;
+  std::vector<int> data(N, 1);
+
+  RAJA::precompiled::inclusive_scan_inplace<TypeParam>(data.data(),
+                                                       data.data() + N);
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(data[i], i + 1);
+  }
+
+  RAJA::precompiled::exclusive_scan_inplace<TypeParam>(
+      data.data(), data.data() + N, RAJA::operators::maximum<int>{}, -1);
+  ASSERT_EQ(data[0], -1);
+  for (int i = 1; i < N; ++i) {
+    ASSERT_EQ(data[i], i);
+  }
+}
@@ -0,0 +1,282 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA unique, run_length_encode and
+/// reduce_by_key.
+///
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+using RAJA::Index_type;
+
+namespace
+{
+
+//! Sorted keys with short runs, single-element runs and a few long runs
+//! that span several partitions.
+std::vector<int> sorted_keys(Index_type n, unsigned seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> len(1, 8);
+  std::vector<int> keys;
+  keys.reserve(n);
+  int key = -50;
+  while (static_cast<Index_type>(keys.size()) < n) {
+    Index_type run = key % 41 == 0 ? 30000 : len(gen);
+    for (Index_type i = 0; i < run && static_cast<Index_type>(keys.size()) < n;
+         ++i) {
+      keys.push_back(key);
+    }
+    key += 1 + len(gen) % 2;
+  }
+  return keys;
+}
+
+template <typename T, typename BinOp>
+void reference(std::vector<int> const& keys,
+               std::vector<T> const& values,
+               BinOp op,
+               std::vector<int>& keys_out,
+               std::vector<T>& values_out)
+{
+  keys_out.clear();
+  values_out.clear();
+  for (size_t i = 0; i < keys.size(); ++i) {
+    if (i == 0 || keys[i - 1] != keys[i]) {
+      keys_out.push_back(keys[i]);
+      values_out.push_back(values[i]);
+    } else {
+      values_out.back() = op(values_out.back(), values[i]);
+    }
+  }
+}
+
+}  // namespace
+
+template <typename ExecPolicy>
+class RunLengthTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_CASE_P(RunLengthTest);
+
+TYPED_TEST_P(RunLengthTest, Unique)
+{
+  using Pol = TypeParam;
+  auto keys = sorted_keys(200000, 1);
+  std::vector<int> ref_keys;
+  std::vector<int> ref_counts;
+  reference(keys,
+            std::vector<int>(keys.size(), 1),
+            RAJA::operators::plus<int>(),
+            ref_keys,
+            ref_counts);
+
+  std::vector<int> out(keys.size(), -1);
+  const Index_type num =
+      RAJA::unique<Pol>(keys.data(), keys.data() + keys.size(), out.data());
+  ASSERT_EQ(num, static_cast<Index_type>(ref_keys.size()));
+  out.resize(num);
+  ASSERT_EQ(out, ref_keys);
+
+  // custom predicate: keys equal when they agree after dividing by 4
+  std::vector<int> ref_div;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    if (i == 0 || keys[i - 1] / 4 != keys[i] / 4) ref_div.push_back(keys[i]);
+  }
+  out.assign(keys.size(), -1);
+  const Index_type num_div = RAJA::unique<Pol>(
+      keys.begin(), keys.end(), out.begin(), [](int a, int b) {
+        return a / 4 == b / 4;
+      });
+  out.resize(num_div);
+  ASSERT_EQ(out, ref_div);
+}
+
+TYPED_TEST_P(RunLengthTest, RunLengthEncode)
+{
+  using Pol = TypeParam;
+  auto keys = sorted_keys(150000, 2);
+  std::vector<int> ref_keys;
+  std::vector<Index_type> ref_counts;
+  reference(keys,
+            std::vector<Index_type>(keys.size(), 1),
+            RAJA::operators::plus<Index_type>(),
+            ref_keys,
+            ref_counts);
+
+  std::vector<int> keys_out(keys.size());
+  std::vector<Index_type> counts(keys.size());
+  const Index_type num = RAJA::run_length_encode<Pol>(
+      keys.data(), keys.data() + keys.size(), keys_out.data(), counts.data());
+  ASSERT_EQ(num, static_cast<Index_type>(ref_keys.size()));
+  keys_out.resize(num);
+  counts.resize(num);
+  ASSERT_EQ(keys_out, ref_keys);
+  ASSERT_EQ(counts, ref_counts);
+}
+
+TYPED_TEST_P(RunLengthTest, ReduceByKey)
+{
+  using Pol = TypeParam;
+  auto keys = sorted_keys(180000, 3);
+  std::vector<double> values(keys.size());
+  std::mt19937 gen(4);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  for (double& v : values) {
+    v = dist(gen);
+  }
+
+  std::vector<int> ref_keys;
+  std::vector<double> ref_values;
+  std::vector<int> keys_out(keys.size());
+  std::vector<double> values_out(keys.size());
+
+  reference(
+      keys, values, RAJA::operators::maximum<double>(), ref_keys, ref_values);
+  Index_type num =
+      RAJA::reduce_by_key<Pol>(keys.data(),
+                               keys.data() + keys.size(),
+                               values.data(),
+                               keys_out.data(),
+                               values_out.data(),
+                               RAJA::operators::maximum<double>());
+  ASSERT_EQ(num, static_cast<Index_type>(ref_keys.size()));
+  for (Index_type r = 0; r < num; ++r) {
+    ASSERT_EQ(keys_out[r], ref_keys[r]);
+    ASSERT_EQ(values_out[r], ref_values[r]);
+  }
+
+  // summed integer values are exact regardless of partitioning
+  std::vector<long> ivalues(keys.size());
+  for (size_t i = 0; i < ivalues.size(); ++i) {
+    ivalues[i] = static_cast<long>(i % 13) - 6;
+  }
+  std::vector<long> ref_sums;
+  std::vector<long> sums(keys.size());
+  reference(keys, ivalues, RAJA::operators::plus<long>(), ref_keys, ref_sums);
+  num = RAJA::reduce_by_key<Pol>(keys.data(),
+                                 keys.data() + keys.size(),
+                                 ivalues.data(),
+                                 keys_out.data(),
+                                 sums.data());
+  ASSERT_EQ(num, static_cast<Index_type>(ref_keys.size()));
+  sums.resize(num);
+  ASSERT_EQ(sums, ref_sums);
+}
+
+TYPED_TEST_P(RunLengthTest, NonCommutative)
+{
+  using Pol = TypeParam;
+  // concatenation is associative but not commutative, so runs split
+  // across partitions must be folded in order
+  const Index_type n = 40000;
+  std::vector<int> keys(n);
+  std::vector<std::string> values(n);
+  for (Index_type i = 0; i < n; ++i) {
+    keys[i] = static_cast<int>(i / 15000);
+    values[i] = std::string(1, static_cast<char>('a' + i % 26));
+  }
+  std::vector<int> keys_out(n);
+  std::vector<std::string> values_out(n);
+  const Index_type num = RAJA::reduce_by_key<Pol>(
+      keys.data(),
+      keys.data() + n,
+      values.data(),
+      keys_out.data(),
+      values_out.data(),
+      [](std::string const& a, std::string const& b) { return a + b; });
+  ASSERT_EQ(num, 3);
+  for (Index_type r = 0; r < num; ++r) {
+    std::string ref;
+    for (Index_type i = r * 15000; i < n && i < (r + 1) * 15000; ++i) {
+      ref += values[i];
+    }
+    ASSERT_EQ(keys_out[r], r);
+    ASSERT_EQ(values_out[r], ref);
+  }
+}
+
+TYPED_TEST_P(RunLengthTest, EdgeCases)
+{
+  using Pol = TypeParam;
+  std::vector<int> keys;
+  std::vector<int> out(4, -1);
+  std::vector<int> counts(4, -1);
+
+  // empty input: outputs untouched
+  ASSERT_EQ(RAJA::unique<Pol>(keys.data(), keys.data(), out.data()), 0);
+  ASSERT_EQ(RAJA::run_length_encode<Pol>(
+                keys.data(), keys.data(), out.data(), counts.data()),
+            0);
+  ASSERT_EQ(out, std::vector<int>(4, -1));
+
+  // single element
+  keys = {7};
+  ASSERT_EQ(RAJA::run_length_encode<Pol>(
+                keys.data(), keys.data() + 1, out.data(), counts.data()),
+            1);
+  ASSERT_EQ(out[0], 7);
+  ASSERT_EQ(counts[0], 1);
+
+  // one run covering every partition
+  keys.assign(100000, 3);
+  out.assign(keys.size(), -1);
+  counts.assign(keys.size(), -1);
+  ASSERT_EQ(RAJA::run_length_encode<Pol>(keys.data(),
+                                         keys.data() + keys.size(),
+                                         out.data(),
+                                         counts.data()),
+            1);
+  ASSERT_EQ(out[0], 3);
+  ASSERT_EQ(counts[0], 100000);
+  ASSERT_EQ(out[1], -1);
+
+  // all distinct
+  for (size_t i = 0; i < keys.size(); ++i) {
+    keys[i] = static_cast<int>(i);
+  }
+  ASSERT_EQ(RAJA::unique<Pol>(keys.data(), keys.data() + keys.size(),
+                              out.data()),
+            100000);
+  ASSERT_EQ(out, keys);
+}
+
+REGISTER_TYPED_TEST_CASE_P(RunLengthTest,
+                           Unique,
+                           RunLengthEncode,
+                           ReduceByKey,
+                           NonCommutative,
+                           EdgeCases);
+
+using RunLengthPolicies = ::testing::Types<RAJA::seq_exec,
+                                           RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                           ,
+                                           RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                           ,
+                                           RAJA::tbb_for_exec
+#endif
+                                           >;
+
+INSTANTIATE_TYPED_TEST_CASE_P(RunLength, RunLengthTest, RunLengthPolicies);
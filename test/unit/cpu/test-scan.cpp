@@ -34,7 +34,8 @@ const int N = 32000;
 
 // Unit Test Space Exploration
 
-using ExecTypes = std::tuple<RAJA::seq_exec
+using ExecTypes = std::tuple<RAJA::seq_exec,
+                             RAJA::loop_exec
 #if defined(RAJA_ENABLE_OPENMP)
                              ,
                              RAJA::omp_parallel_for_exec
@@ -50,7 +51,9 @@ using ReduceTypes = std::tuple<RAJA::operators::plus<int>,
                                RAJA::operators::minimum<float>,
                                RAJA::operators::minimum<double>,
                                RAJA::operators::maximum<int>,
-                               RAJA::operators::maximum<float>>;
+                               RAJA::operators::maximum<float>,
+                               RAJA::operators::plus<RAJA::Index_type>,
+                               RAJA::operators::minimum<unsigned>>;
 
 using CrossTypes =
     ForTesting<typename types::product<ExecTypes, ReduceTypes>::type>;
@@ -84,10 +87,12 @@ typename Info<Tuple>::data_type* Scan<Tuple>::data = nullptr;
 TYPED_TEST_CASE_P(Scan);
 
 template <typename Function, typename T>
-::testing::AssertionResult check_inclusive(const T* actual, const T* original)
+::testing::AssertionResult check_inclusive(const T* actual,
+                                           const T* original,
+                                           int n = N)
 {
   T init = Function::identity();
-  for (int i = 0; i < N; ++i) {
+  for (int i = 0; i < n; ++i) {
     init = Function()(init, *original);
     if (*actual != init)
       return ::testing::AssertionFailure()
@@ -101,9 +106,10 @@ template <typename Function, typename T>
 template <typename Function, typename T>
 ::testing::AssertionResult check_exclusive(const T* actual,
                                            const T* original,
-                                           T init = Function::identity())
+                                           T init = Function::identity(),
+                                           int n = N)
 {
-  for (int i = 0; i < N; ++i) {
+  for (int i = 0; i < n; ++i) {
     if (*actual != init)
       return ::testing::AssertionFailure()
              << *actual << " != " << init << " (at index " << i << ")";
@@ -215,12 +221,44 @@ TYPED_TEST_P(Scan, exclusive_inplace_offset)
   delete[] data;
 }
 
+TYPED_TEST_P(Scan, odd_sizes)
+{
+  using T = typename Info<TypeParam>::data_type;
+  using Function = typename Info<TypeParam>::function;
+  using Exec = typename Info<TypeParam>::exec;
+
+  // lengths around the vector widths and the unrolled block sizes
+  const int sizes[] = {1, 2, 3, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 47, 63, 65,
+                       127, 1001};
+
+  T* out = new T[N];
+  T* data = new T[N];
+
+  for (int n : sizes) {
+    RAJA::inclusive_scan(
+        Exec(), Scan<TypeParam>::data, Scan<TypeParam>::data + n, out,
+        Function{});
+    ASSERT_TRUE(check_inclusive<Function>(out, Scan<TypeParam>::data, n))
+        << "n = " << n;
+
+    std::copy_n(Scan<TypeParam>::data, n, data);
+    RAJA::exclusive_scan_inplace(Exec(), data, data + n, Function{}, T(2));
+    ASSERT_TRUE(
+        check_exclusive<Function>(data, Scan<TypeParam>::data, T(2), n))
+        << "n = " << n;
+  }
+
+  delete[] data;
+  delete[] out;
+}
+
 REGISTER_TYPED_TEST_CASE_P(Scan,
                            inclusive,
                            inclusive_inplace,
                            exclusive,
                            exclusive_inplace,
                            exclusive_offset,
-                           exclusive_inplace_offset);
+                           exclusive_inplace_offset,
+                           odd_sizes);
 
 INSTANTIATE_TYPED_TEST_CASE_P(ScanTests, Scan, CrossTypes);
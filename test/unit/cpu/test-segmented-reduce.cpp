@@ -0,0 +1,210 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA segmented reductions and CSR SpMV.
+///
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+using RAJA::Index_type;
+
+namespace
+{
+
+//! Segment lengths with empty segments and a few very long ones.
+std::vector<Index_type> skewed_offsets(Index_type num_segments,
+                                       unsigned seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> len(0, 6);
+  std::vector<Index_type> offsets(num_segments + 1, 0);
+  for (Index_type i = 0; i < num_segments; ++i) {
+    Index_type n = len(gen) == 0 ? 0 : len(gen);
+    if (i % 97 == 5) n = 5000;
+    offsets[i + 1] = offsets[i] + n;
+  }
+  return offsets;
+}
+
+template <typename T, typename BinOp>
+std::vector<T> reference(std::vector<Index_type> const& offsets,
+                         std::vector<T> const& values,
+                         BinOp op)
+{
+  std::vector<T> out(offsets.size() - 1);
+  for (size_t i = 0; i + 1 < offsets.size(); ++i) {
+    T acc = BinOp::identity();
+    for (Index_type j = offsets[i]; j < offsets[i + 1]; ++j) {
+      acc = op(acc, values[j]);
+    }
+    out[i] = acc;
+  }
+  return out;
+}
+
+}  // namespace
+
+template <typename ExecPolicy>
+class SegmentedReduceTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_CASE_P(SegmentedReduceTest);
+
+TYPED_TEST_P(SegmentedReduceTest, SkewedSum)
+{
+  using Pol = TypeParam;
+  const Index_type num_segments = 1000;
+  auto offsets = skewed_offsets(num_segments, 1);
+  std::vector<int> values(offsets.back());
+  for (size_t j = 0; j < values.size(); ++j) {
+    values[j] = static_cast<int>(j % 17) - 8;
+  }
+  const int* v = values.data();
+  std::vector<int> out(num_segments, -1);
+
+  RAJA::segmented_reduce<Pol>(num_segments,
+                              offsets.data(),
+                              out.data(),
+                              [=](Index_type j) { return v[j]; });
+
+  ASSERT_EQ(out, reference(offsets, values, RAJA::operators::plus<int>()));
+}
+
+TYPED_TEST_P(SegmentedReduceTest, MinMax)
+{
+  using Pol = TypeParam;
+  const Index_type num_segments = 777;
+  auto offsets = skewed_offsets(num_segments, 2);
+  std::vector<double> values(offsets.back());
+  std::mt19937 gen(3);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  for (double& x : values) {
+    x = dist(gen);
+  }
+  const double* v = values.data();
+  std::vector<double> out(num_segments);
+
+  RAJA::segmented_reduce<Pol>(num_segments,
+                              offsets.data(),
+                              out.data(),
+                              [=](Index_type j) { return v[j]; },
+                              RAJA::operators::minimum<double>());
+  ASSERT_EQ(out,
+            reference(offsets, values, RAJA::operators::minimum<double>()));
+
+  RAJA::segmented_reduce<Pol>(num_segments,
+                              offsets.data(),
+                              out.data(),
+                              [=](Index_type j) { return v[j]; },
+                              RAJA::operators::maximum<double>());
+  ASSERT_EQ(out,
+            reference(offsets, values, RAJA::operators::maximum<double>()));
+}
+
+TYPED_TEST_P(SegmentedReduceTest, EdgeCases)
+{
+  using Pol = TypeParam;
+  auto one = [](Index_type) { return 1; };
+
+  // one long segment split across every partition, with a nonzero base
+  std::vector<Index_type> offsets = {10, 100010};
+  std::vector<int> out(1, 0);
+  RAJA::segmented_reduce<Pol>(1, offsets.data(), out.data(), one);
+  ASSERT_EQ(out[0], 100000);
+
+  // only empty segments
+  offsets.assign(50, 3);
+  out.assign(49, -1);
+  RAJA::segmented_reduce<Pol>(49, offsets.data(), out.data(), one);
+  ASSERT_EQ(out, std::vector<int>(49, 0));
+
+  // fewer items and segments than threads
+  offsets = {0, 1, 1, 3};
+  out.assign(3, -1);
+  RAJA::segmented_reduce<Pol>(3, offsets.data(), out.data(), one);
+  ASSERT_EQ(out, (std::vector<int>{1, 0, 2}));
+
+  // no segments: out is untouched
+  RAJA::segmented_reduce<Pol>(0, offsets.data(), out.data(), one);
+  ASSERT_EQ(out, (std::vector<int>{1, 0, 2}));
+}
+
+TYPED_TEST_P(SegmentedReduceTest, CsrSpmv)
+{
+  using Pol = TypeParam;
+  const Index_type num_rows = 2000;
+  const Index_type num_cols = 300;
+  auto offsets = skewed_offsets(num_rows, 4);
+  const Index_type nnz = offsets.back();
+
+  std::mt19937 gen(5);
+  std::uniform_int_distribution<Index_type> col(0, num_cols - 1);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<Index_type> columns(nnz);
+  std::vector<double> values(nnz);
+  std::vector<double> x(num_cols);
+  for (Index_type j = 0; j < nnz; ++j) {
+    columns[j] = col(gen);
+    values[j] = dist(gen);
+  }
+  for (double& xi : x) {
+    xi = dist(gen);
+  }
+  std::vector<double> y(num_rows, 0.0);
+
+  RAJA::csr_spmv<Pol>(num_rows,
+                      offsets.data(),
+                      columns.data(),
+                      values.data(),
+                      x.data(),
+                      y.data());
+
+  for (Index_type i = 0; i < num_rows; ++i) {
+    double ref = 0.0;
+    for (Index_type j = offsets[i]; j < offsets[i + 1]; ++j) {
+      ref += values[j] * x[columns[j]];
+    }
+    ASSERT_NEAR(y[i], ref, 1e-10);
+  }
+}
+
+REGISTER_TYPED_TEST_CASE_P(SegmentedReduceTest,
+                           SkewedSum,
+                           MinMax,
+                           EdgeCases,
+                           CsrSpmv);
+
+using SegmentedPolicies = ::testing::Types<RAJA::seq_exec,
+                                           RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                           ,
+                                           RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                           ,
+                                           RAJA::tbb_for_exec
+#endif
+                                           >;
+
+INSTANTIATE_TYPED_TEST_CASE_P(SegmentedReduce,
+                              SegmentedReduceTest,
+                              SegmentedPolicies);
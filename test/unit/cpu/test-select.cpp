@@ -0,0 +1,235 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA nth_element and top_k.
+///
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+using RAJA::Index_type;
+
+namespace
+{
+
+std::vector<double> random_values(Index_type n, int distinct, unsigned seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(0, distinct - 1);
+  std::vector<double> values(n);
+  for (double& v : values) {
+    v = dist(gen) * 0.5;
+  }
+  return values;
+}
+
+//! Check the nth_element postcondition and that values is a permutation
+//! of orig.
+template <typename Compare>
+void check_nth(std::vector<double> values,
+               std::vector<double> orig,
+               Index_type nth,
+               Compare comp)
+{
+  std::vector<double> sorted = orig;
+  std::sort(sorted.begin(), sorted.end(), comp);
+  ASSERT_EQ(values[nth], sorted[nth]);
+  for (Index_type i = 0; i < nth; ++i) {
+    ASSERT_FALSE(comp(values[nth], values[i]));
+  }
+  for (Index_type i = nth + 1; i < static_cast<Index_type>(values.size());
+       ++i) {
+    ASSERT_FALSE(comp(values[i], values[nth]));
+  }
+  std::sort(values.begin(), values.end(), comp);
+  ASSERT_EQ(values, sorted);
+}
+
+//! Indices of the k best values, best first, ties by increasing index.
+template <typename Compare>
+std::vector<Index_type> reference_top_k(std::vector<double> const& values,
+                                        Index_type k,
+                                        Compare comp)
+{
+  std::vector<Index_type> idx(values.size());
+  std::iota(idx.begin(), idx.end(), Index_type(0));
+  std::stable_sort(idx.begin(), idx.end(), [&](Index_type a, Index_type b) {
+    return comp(values[a], values[b]);
+  });
+  idx.resize(std::min<Index_type>(k, values.size()));
+  return idx;
+}
+
+}  // namespace
+
+template <typename ExecPolicy>
+class SelectTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_CASE_P(SelectTest);
+
+TYPED_TEST_P(SelectTest, NthElement)
+{
+  using Pol = TypeParam;
+  const Index_type n = 200000;
+  for (int distinct : {3, 1000, 1 << 30}) {
+    const std::vector<double> orig = random_values(n, distinct, distinct);
+    for (Index_type nth : {Index_type(0), n / 3, n / 2, n - 1}) {
+      std::vector<double> values = orig;
+      RAJA::nth_element<Pol>(
+          values.begin(), values.begin() + nth, values.end());
+      check_nth(values, orig, nth, std::less<double>());
+    }
+  }
+}
+
+TYPED_TEST_P(SelectTest, NthElementOrderedInputs)
+{
+  using Pol = TypeParam;
+  const Index_type n = 150001;
+  std::vector<double> increasing(n);
+  std::iota(increasing.begin(), increasing.end(), 0.0);
+  std::vector<double> decreasing(increasing.rbegin(), increasing.rend());
+  std::vector<double> constant(n, 2.5);
+  for (std::vector<double> const* orig :
+       {&increasing, &decreasing, &constant}) {
+    std::vector<double> values = *orig;
+    RAJA::nth_element<Pol>(
+        values.data(), values.data() + n / 4, values.data() + n);
+    check_nth(values, *orig, n / 4, std::less<double>());
+  }
+}
+
+TYPED_TEST_P(SelectTest, NthElementComparator)
+{
+  using Pol = TypeParam;
+  const Index_type n = 100000;
+  const std::vector<double> orig = random_values(n, 5000, 7u);
+  std::vector<double> values = orig;
+  RAJA::nth_element<Pol>(values.begin(),
+                         values.begin() + 10,
+                         values.end(),
+                         RAJA::operators::greater<double>{});
+  check_nth(values, orig, 10, std::greater<double>());
+}
+
+TYPED_TEST_P(SelectTest, TopKSmall)
+{
+  using Pol = TypeParam;
+  const Index_type n = 300000;
+  for (int distinct : {50, 1 << 30}) {
+    const std::vector<double> values = random_values(n, distinct, 11u);
+    for (Index_type k : {1, 10, 2048}) {
+      std::vector<double> top(k, -1.0);
+      std::vector<Index_type> idx(k, -1);
+      ASSERT_EQ(RAJA::top_k<Pol>(values, k, top.data(), idx.data()), k);
+      const std::vector<Index_type> ref =
+          reference_top_k(values, k, std::greater<double>());
+      ASSERT_EQ(idx, ref);
+      for (Index_type i = 0; i < k; ++i) {
+        ASSERT_EQ(top[i], values[ref[i]]);
+      }
+    }
+  }
+}
+
+TYPED_TEST_P(SelectTest, TopKLarge)
+{
+  using Pol = TypeParam;
+  const Index_type n = 300000;
+  for (int distinct : {50, 1 << 30}) {
+    const std::vector<double> values = random_values(n, distinct, 13u);
+    for (Index_type k : {Index_type(2049), Index_type(40000), n - 1}) {
+      std::vector<double> top(k, -1.0);
+      std::vector<int> idx(k, -1);
+      ASSERT_EQ(RAJA::top_k<Pol>(values, k, top.data(), idx.data()), k);
+      const std::vector<Index_type> ref =
+          reference_top_k(values, k, std::greater<double>());
+      for (Index_type i = 0; i < k; ++i) {
+        ASSERT_EQ(idx[i], ref[i]);
+        ASSERT_EQ(top[i], values[ref[i]]);
+      }
+    }
+  }
+}
+
+TYPED_TEST_P(SelectTest, TopKComparator)
+{
+  using Pol = TypeParam;
+  const std::vector<double> values = random_values(100000, 20000, 17u);
+  for (Index_type k : {100, 5000}) {
+    std::vector<double> top(k);
+    std::vector<Index_type> idx(k);
+    RAJA::top_k<Pol>(values,
+                     k,
+                     top.begin(),
+                     idx.begin(),
+                     RAJA::operators::less<double>{});
+    ASSERT_EQ(idx, reference_top_k(values, k, std::less<double>()));
+  }
+}
+
+TYPED_TEST_P(SelectTest, EdgeCases)
+{
+  using Pol = TypeParam;
+  std::vector<double> empty;
+  std::vector<double> top(5, -1.0);
+  std::vector<Index_type> idx(5, -1);
+  ASSERT_EQ(RAJA::top_k<Pol>(empty, 3, top.data(), idx.data()), 0);
+  RAJA::nth_element<Pol>(empty.begin(), empty.begin(), empty.end());
+
+  std::vector<double> values{3.0, 1.0, 4.0, 1.0, 5.0};
+  ASSERT_EQ(RAJA::top_k<Pol>(values, 0, top.data(), idx.data()), 0);
+  ASSERT_EQ(top[0], -1.0);
+  ASSERT_EQ(RAJA::top_k<Pol>(values, 10, top.data(), idx.data()), 5);
+  ASSERT_EQ(idx, (std::vector<Index_type>{4, 2, 0, 1, 3}));
+  ASSERT_EQ(top, (std::vector<double>{5.0, 4.0, 3.0, 1.0, 1.0}));
+
+  RAJA::nth_element<Pol>(values.begin(), values.begin() + 2, values.end());
+  ASSERT_EQ(values[2], 3.0);
+  RAJA::nth_element<Pol>(values.begin(), values.end(), values.end());
+  ASSERT_EQ(values[2], 3.0);
+}
+
+REGISTER_TYPED_TEST_CASE_P(SelectTest,
+                           NthElement,
+                           NthElementOrderedInputs,
+                           NthElementComparator,
+                           TopKSmall,
+                           TopKLarge,
+                           TopKComparator,
+                           EdgeCases);
+
+using SelectPolicies = ::testing::Types<RAJA::seq_exec,
+                                        RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                        ,
+                                        RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                        ,
+                                        RAJA::tbb_for_exec
+#endif
+                                        >;
+
+INSTANTIATE_TYPED_TEST_CASE_P(Select, SelectTest, SelectPolicies);
@@ -0,0 +1,327 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the RAJA stencil pattern.
+///
+
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "RAJA/policy/reduce_policy.hpp"
+#include "gtest/gtest.h"
+
+using RAJA::Index_type;
+using namespace RAJA::stencil;
+
+template <typename ExecPolicy>
+class StencilTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_CASE_P(StencilTest);
+
+TYPED_TEST_P(StencilTest, VisitsEveryPointOnce)
+{
+  using Pol = TypeParam;
+  const Index_type nz = 7, ny = 45, nx = 1200;
+  std::vector<int> count(nz * ny * nx, 0);
+  RAJA::View<int, RAJA::Layout<3>> c(count.data(), nz, ny, nx);
+
+  apply<Pol>(make_box<3>({1, 2, 3}, {nz, ny - 1, nx - 5}),
+             [=](Index_type k, Index_type j, Index_type i) {
+               c(k, j, i) += 1;
+             });
+
+  for (Index_type k = 0; k < nz; ++k) {
+    for (Index_type j = 0; j < ny; ++j) {
+      for (Index_type i = 0; i < nx; ++i) {
+        const bool inside =
+            k >= 1 && j >= 2 && j < ny - 1 && i >= 3 && i < nx - 5;
+        ASSERT_EQ(c(k, j, i), inside ? 1 : 0);
+      }
+    }
+  }
+
+  // empty boxes do nothing
+  int* first = count.data();
+  apply<Pol>(make_box<2>({0, 5}, {10, 5}),
+             [=](Index_type, Index_type) { *first = -1; });
+  ASSERT_EQ(count[0], 0);
+}
+
+TYPED_TEST_P(StencilTest, InteriorBoundarySplit)
+{
+  using Pol = TypeParam;
+  for (Index_type n : {3, 4, 5, 40}) {
+    const Index_type r = 2;
+    std::vector<int> mark(n * (n + 1), 0);
+    RAJA::View<int, RAJA::Layout<2>> m(mark.data(), n, n + 1);
+
+    apply<Pol>(make_box<2>({0, 0}, {n, n + 1}),
+               r,
+               [=](Index_type j, Index_type i) { m(j, i) += 1; },
+               [=](Index_type j, Index_type i) { m(j, i) += 10; });
+
+    for (Index_type j = 0; j < n; ++j) {
+      for (Index_type i = 0; i < n + 1; ++i) {
+        const bool interior = j >= r && j < n - r && i >= r && i < n + 1 - r;
+        ASSERT_EQ(m(j, i), interior ? 1 : 10) << n << " " << j << " " << i;
+      }
+    }
+  }
+}
+
+TYPED_TEST_P(StencilTest, PeriodicWave)
+{
+  using Pol = TypeParam;
+  const Index_type n = 64;
+  const double c[5] = {-1.0 / 12, 4.0 / 3, -5.0 / 2, 4.0 / 3, -1.0 / 12};
+  std::vector<double> p(n * n), lap(n * n), ref(n * n);
+  for (Index_type i = 0; i < n * n; ++i) {
+    p[i] = static_cast<double>((i * 37) % 101) / 101.0;
+  }
+  const double* pp = p.data();
+  double* l = lap.data();
+
+  apply<Pol>(make_box<2>({0, 0}, {n, n}),
+             2,
+             [=](Index_type j, Index_type i) {
+               double s = 0.0;
+               for (int r = -2; r <= 2; ++r) {
+                 s += c[r + 2] * (pp[j * n + i + r] + pp[(j + r) * n + i]);
+               }
+               l[j * n + i] = s;
+             },
+             [=](Index_type j, Index_type i) {
+               double s = 0.0;
+               for (int r = -2; r <= 2; ++r) {
+                 s += c[r + 2] * (pp[j * n + (i + r + n) % n]
+                                  + pp[((j + r + n) % n) * n + i]);
+               }
+               l[j * n + i] = s;
+             });
+
+  for (Index_type j = 0; j < n; ++j) {
+    for (Index_type i = 0; i < n; ++i) {
+      double s = 0.0;
+      for (int r = -2; r <= 2; ++r) {
+        s += c[r + 2] * (p[j * n + (i + r + n) % n]
+                         + p[((j + r + n) % n) * n + i]);
+      }
+      ASSERT_DOUBLE_EQ(lap[j * n + i], s);
+    }
+  }
+}
+
+TYPED_TEST_P(StencilTest, WeightsLaplacian2D)
+{
+  using Pol = TypeParam;
+  const Index_type ny = 37, nx = 530;
+  auto layout = RAJA::make_offset_layout<2>({-1, -1}, {ny, nx});
+  std::vector<double> in_data((ny + 2) * (nx + 2)), out_data(ny * nx, 0.0);
+  for (size_t i = 0; i < in_data.size(); ++i) {
+    in_data[i] = static_cast<double>((i * 13) % 29);
+  }
+  RAJA::View<const double, RAJA::OffsetLayout<2>> in(in_data.data(), layout);
+  RAJA::View<double, RAJA::Layout<2>> out(out_data.data(), ny, nx);
+
+  apply<Pol>(star<2>({1.0, -2.0, 1.0}), in, out, make_box<2>({0, 0}, {ny, nx}));
+
+  for (Index_type j = 0; j < ny; ++j) {
+    for (Index_type i = 0; i < nx; ++i) {
+      const double ref = in(j - 1, i) + in(j + 1, i) + in(j, i - 1)
+                         + in(j, i + 1) - 4.0 * in(j, i);
+      ASSERT_DOUBLE_EQ(out(j, i), ref);
+    }
+  }
+
+  // a point count without a specialized row kernel
+  Weights<double, 2> avg;
+  avg.add({{-1, 0}}, 0.25).add({{1, 0}}, 0.25);
+  avg.add({{0, -1}}, 0.25).add({{0, 1}}, 0.25);
+  apply<Pol>(avg, in, out, make_box<2>({0, 0}, {ny, nx}));
+  for (Index_type j = 0; j < ny; ++j) {
+    for (Index_type i = 0; i < nx; ++i) {
+      const double ref = 0.25 * (in(j - 1, i) + in(j + 1, i) + in(j, i - 1)
+                                 + in(j, i + 1));
+      ASSERT_DOUBLE_EQ(out(j, i), ref);
+    }
+  }
+}
+
+TYPED_TEST_P(StencilTest, WeightsPermuted3D)
+{
+  using Pol = TypeParam;
+  const Index_type n = 12;
+  // i is the slowest index in memory, exercising the strided row path
+  auto layout = RAJA::make_permuted_offset_layout<3>({-1, -1, -1},
+                                                     {n, n, n},
+                                                     {{2, 1, 0}});
+  std::vector<float> in_data((n + 2) * (n + 2) * (n + 2));
+  std::vector<float> out_data(n * n * n, 0.0f);
+  for (size_t i = 0; i < in_data.size(); ++i) {
+    in_data[i] = static_cast<float>(i % 7);
+  }
+  RAJA::View<float, RAJA::OffsetLayout<3>> in(in_data.data(), layout);
+  RAJA::View<float, RAJA::Layout<3>> out(out_data.data(), n, n, n);
+
+  Weights<float, 3> w;
+  w.add({{0, 0, 0}}, 2.0f).add({{1, 0, 0}}, -1.0f).add({{0, -1, 1}}, 0.5f);
+  w.add({{0, 0, 0}}, 1.0f);
+  ASSERT_EQ(w.size(), 3);
+  ASSERT_EQ(w.radius(), 1);
+
+  apply<Pol>(w, in, out, make_box<3>({0, 0, 0}, {n, n, n}));
+
+  for (Index_type k = 0; k < n; ++k) {
+    for (Index_type j = 0; j < n; ++j) {
+      for (Index_type i = 0; i < n; ++i) {
+        const float ref =
+            3.0f * in(k, j, i) - in(k + 1, j, i) + 0.5f * in(k, j - 1, i + 1);
+        ASSERT_FLOAT_EQ(out(k, j, i), ref);
+      }
+    }
+  }
+}
+
+TYPED_TEST_P(StencilTest, RedBlackGaussSeidel)
+{
+  using Pol = TypeParam;
+  const Index_type n = 50;
+  std::vector<double> u((n + 2) * (n + 2)), ref;
+  for (size_t i = 0; i < u.size(); ++i) {
+    u[i] = static_cast<double>((i * 7) % 11);
+  }
+  ref = u;
+
+  auto sweep = [n](double* v, Index_type j, Index_type i) {
+    const Index_type id = j * (n + 2) + i;
+    v[id] = 0.25 * (v[id - 1] + v[id + 1] + v[id - n - 2] + v[id + n + 2]);
+  };
+  double* pu = u.data();
+  apply_red_black<Pol>(make_box<2>({1, 1}, {n + 1, n + 1}),
+                       [=](Index_type j, Index_type i) { sweep(pu, j, i); });
+
+  for (int color = 0; color < 2; ++color) {
+    for (Index_type j = 1; j <= n; ++j) {
+      for (Index_type i = 1; i <= n; ++i) {
+        if ((i + j) % 2 == color) sweep(ref.data(), j, i);
+      }
+    }
+  }
+  ASSERT_EQ(u, ref);
+
+  // split variant: the boundary body sees only edge points, either color
+  std::vector<int> seen((n + 2) * (n + 2), 0);
+  int* s = seen.data();
+  apply_red_black<Pol>(make_box<2>({1, 1}, {n + 1, n + 1}),
+                       1,
+                       [=](Index_type j, Index_type i) {
+                         s[j * (n + 2) + i] = 1 + static_cast<int>((i + j) % 2);
+                       },
+                       [=](Index_type j, Index_type i) {
+                         s[j * (n + 2) + i] = 3 + static_cast<int>((i + j) % 2);
+                       });
+  for (Index_type j = 1; j <= n; ++j) {
+    for (Index_type i = 1; i <= n; ++i) {
+      const bool edge = j == 1 || j == n || i == 1 || i == n;
+      ASSERT_EQ(seen[j * (n + 2) + i],
+                (edge ? 3 : 1) + static_cast<int>((i + j) % 2));
+    }
+  }
+}
+
+TEST(Stencil, StarWeights)
+{
+  auto w = star<3>({-1.0 / 12, 4.0 / 3, -5.0 / 2, 4.0 / 3, -1.0 / 12});
+  ASSERT_EQ(w.size(), 13);
+  ASSERT_EQ(w.radius(), 2);
+  ASSERT_DOUBLE_EQ(w.weight(0), -1.0 / 12);
+  ASSERT_DOUBLE_EQ(w.weight(2), -7.5);
+
+  auto w1 = star<1>({1.0, 2.0, 3.0});
+  ASSERT_EQ(w1.size(), 3);
+  const Index_type n = 10;
+  std::vector<double> in(n + 2), out(n);
+  for (Index_type i = 0; i < n + 2; ++i) {
+    in[i] = static_cast<double>(i * i);
+  }
+  RAJA::View<double, RAJA::OffsetLayout<1>> vin(
+      in.data(), RAJA::make_offset_layout<1>({-1}, {n}));
+  RAJA::View<double, RAJA::Layout<1>> vout(out.data(), n);
+  apply<RAJA::seq_exec>(w1, vin, vout, make_box<1>({0}, {n}));
+  for (Index_type i = 0; i < n; ++i) {
+    ASSERT_DOUBLE_EQ(out[i], vin(i - 1) + 2 * vin(i) + 3 * vin(i + 1));
+  }
+
+  ASSERT_ANY_THROW(star<2>({1.0, 2.0}));
+}
+
+TYPED_TEST_P(StencilTest, CapturedReducers)
+{
+  using Pol = TypeParam;
+  using ReducePol = typename RAJA::detail::default_reduce_policy<Pol>::type;
+  const Index_type ny = 300, nx = 1000;
+
+  RAJA::ReduceSum<ReducePol, double> sum(0.0);
+  RAJA::ReduceMax<ReducePol, Index_type> max(0);
+  apply<Pol>(make_box<2>({0, 0}, {ny, nx}),
+             [=](Index_type j, Index_type i) {
+               sum += static_cast<double>(j * nx + i);
+               max.max(j + i);
+             });
+  ASSERT_EQ(sum.get(), 0.5 * (ny * nx) * (ny * nx - 1));
+  ASSERT_EQ(max.get(), ny + nx - 2);
+
+  // interior and boundary bodies updating the same reducer
+  const Index_type r = 2;
+  RAJA::ReduceSum<ReducePol, long> count(0);
+  apply<Pol>(make_box<2>({0, 0}, {ny, nx}),
+             r,
+             [=](Index_type, Index_type) { count += 1; },
+             [=](Index_type, Index_type) { count += 1000; });
+  const long interior = (ny - 2 * r) * (nx - 2 * r);
+  ASSERT_EQ(count.get(), interior + 1000 * (ny * nx - interior));
+
+  // red-black sweeps visit every point once
+  RAJA::ReduceSum<ReducePol, long> visits(0);
+  apply_red_black<Pol>(make_box<2>({0, 0}, {ny, nx}),
+                       [=](Index_type, Index_type) { visits += 1; });
+  ASSERT_EQ(visits.get(), ny * nx);
+}
+
+REGISTER_TYPED_TEST_CASE_P(StencilTest,
+                           VisitsEveryPointOnce,
+                           InteriorBoundarySplit,
+                           PeriodicWave,
+                           WeightsLaplacian2D,
+                           WeightsPermuted3D,
+                           RedBlackGaussSeidel,
+                           CapturedReducers);
+
+using StencilPolicies = ::testing::Types<RAJA::seq_exec,
+                                         RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                         ,
+                                         RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                         ,
+                                         RAJA::tbb_for_exec
+#endif
+                                         >;
+
+INSTANTIATE_TYPED_TEST_CASE_P(Stencil, StencilTest, StencilPolicies);
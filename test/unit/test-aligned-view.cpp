@@ -0,0 +1,116 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for aligned and restrict Views.
+///
+
+#include <cstdint>
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+template <typename T>
+static bool is_aligned(T const *ptr, size_t alignment)
+{
+  return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+TEST(AlignedView, Allocate)
+{
+  double *a = RAJA::aligned_allocate<double>(17);
+  ASSERT_TRUE(is_aligned(a, RAJA::DATA_ALIGN));
+  float *b = RAJA::aligned_allocate<float, 128>(3);
+  ASSERT_TRUE(is_aligned(b, 128));
+  RAJA::free_aligned(a);
+  RAJA::free_aligned(b);
+}
+
+TEST(AlignedView, Daxpy)
+{
+  const RAJA::Index_type n = 1001;
+  double *x = RAJA::aligned_allocate<double>(n);
+  double *y = RAJA::aligned_allocate<double>(n);
+
+  RAJA::AlignedView<double, RAJA::Layout<1>> xv(x, n);
+  RAJA::AlignedView<double, RAJA::Layout<1>> yv(y, n);
+  ASSERT_TRUE(RAJA::check_no_alias(xv, yv));
+
+  RAJA::forall<RAJA::simd_exec>(RAJA::RangeSegment(0, n),
+                                [=](RAJA::Index_type i) {
+                                  xv(i) = i;
+                                  yv(i) = 1.0;
+                                });
+  RAJA::forall<RAJA::loop_exec>(RAJA::RangeSegment(0, n),
+                                [=](RAJA::Index_type i) {
+                                  yv(i) += 2.0 * xv(i);
+                                });
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    ASSERT_EQ(y[i], 1.0 + 2.0 * i);
+  }
+
+  RAJA::free_aligned(x);
+  RAJA::free_aligned(y);
+}
+
+TEST(AlignedView, PaddedLayout)
+{
+  const RAJA::Index_type ni = 5, nj = 7;
+  auto layout = RAJA::make_aligned_layout<double>(
+      std::array<RAJA::Index_type, 2>{{ni, nj}});
+  const RAJA::Index_type row = RAJA::DATA_ALIGN / sizeof(double);
+  ASSERT_EQ(layout.strides[0], (nj + row - 1) / row * row);
+  ASSERT_EQ(layout.strides[1], 1);
+  ASSERT_EQ(RAJA::aligned_span(layout), (ni - 1) * layout.strides[0] + nj);
+
+  double *data = RAJA::aligned_allocate<double>(RAJA::aligned_span(layout));
+  RAJA::AlignedView<double, decltype(layout)> view(data, std::move(layout));
+  for (RAJA::Index_type i = 0; i < ni; ++i) {
+    ASSERT_TRUE(is_aligned(&view(i, 0), RAJA::DATA_ALIGN));
+    auto r = view.row(i);
+    for (RAJA::Index_type j = 0; j < nj; ++j) {
+      r(j) = 10 * i + j;
+    }
+  }
+  ASSERT_EQ(view(4, 6), 46.0);
+  RAJA::free_aligned(data);
+}
+
+TEST(AlignedView, RestrictAndOverlap)
+{
+  double data[20];
+  RAJA::RestrictView<double, RAJA::Layout<1>> a(data, 10);
+  RAJA::RestrictView<double, RAJA::Layout<1>> b(data + 10, 10);
+  RAJA::RestrictView<double, RAJA::Layout<1>> c(data + 5, 10);
+  RAJA::View<double, RAJA::Layout<2>> d(data + 15, 2, 2);
+
+  ASSERT_TRUE(RAJA::check_no_alias(a, b));
+  ASSERT_FALSE(RAJA::check_no_alias(a, c));
+  ASSERT_FALSE(RAJA::check_no_alias(a, b, c));
+  ASSERT_FALSE(RAJA::check_no_alias(b, d));
+  ASSERT_TRUE(RAJA::check_no_alias(a, d));
+}
+
+#if !defined(NDEBUG) && defined(GTEST_HAS_DEATH_TEST) && GTEST_HAS_DEATH_TEST
+TEST(AlignedViewDeathTest, Misaligned)
+{
+  double *a = RAJA::aligned_allocate<double>(16);
+  ASSERT_DEATH(
+      (RAJA::AlignedView<double, RAJA::Layout<1>>(
+          RAJA::AlignedPtr<double>(a + 1), 8)),
+      "");
+  RAJA::free_aligned(a);
+}
+#endif
@@ -0,0 +1,227 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for batched small matrix operations.
+///
+
+#include <cmath>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+using RAJA::Index_type;
+
+namespace
+{
+
+template <typename T, typename Layout>
+struct Batch {
+  Layout layout;
+  std::vector<T> storage;
+  RAJA::View<T, Layout> view;
+
+  explicit Batch(Index_type count)
+      : layout(count),
+        storage(layout.size(), T(0)),
+        view(storage.data(), count)
+  {
+  }
+};
+
+//! Pseudo-random entries in [-1, 1) that differ between matrices.
+double entry(Index_type e, int i, int j)
+{
+  const unsigned h = static_cast<unsigned>(e * 73856093 ^ i * 19349663
+                                           ^ j * 83492791);
+  return static_cast<double>(h % 2001) / 1000.0 - 1.0;
+}
+
+}  // namespace
+
+using Layout33 = RAJA::batched::InterleavedLayout<3, 3, 4>;
+static_assert(Layout33::block_size == 36, "");
+static_assert(Layout33(9).num_blocks() == 3, "");
+static_assert(Layout33(9).size() == 108, "");
+static_assert(Layout33(9)(5, 2, 1) == 36 + 7 * 4 + 1, "");
+static_assert(RAJA::batched::default_lanes<double>::value
+                  == RAJA::DATA_ALIGN / 8,
+              "");
+
+template <typename ExecPolicy>
+class BatchedTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_CASE_P(BatchedTest);
+
+TYPED_TEST_P(BatchedTest, Multiply)
+{
+  using Pol = TypeParam;
+  constexpr int R = 3, K = 4, C = 2;
+  const Index_type count = 37;
+
+  using namespace RAJA::batched;
+  Batch<double, InterleavedLayout<R, K, 8>> a(count);
+  Batch<double, InterleavedLayout<K, C, 8>> b(count);
+  Batch<double, InterleavedLayout<R, C, 8>> c(count);
+  for (Index_type e = 0; e < count; ++e) {
+    for (int k = 0; k < K; ++k) {
+      for (int i = 0; i < R; ++i) {
+        a.view(e, i, k) = entry(e, i, k);
+      }
+      for (int j = 0; j < C; ++j) {
+        b.view(e, k, j) = entry(e + 1, k, j);
+      }
+    }
+  }
+
+  multiply<Pol>(a.view, b.view, c.view);
+
+  for (Index_type e = 0; e < count; ++e) {
+    for (int i = 0; i < R; ++i) {
+      for (int j = 0; j < C; ++j) {
+        double ref = 0.0;
+        for (int k = 0; k < K; ++k) {
+          ref += a.view(e, i, k) * b.view(e, k, j);
+        }
+        ASSERT_DOUBLE_EQ(c.view(e, i, j), ref);
+      }
+    }
+  }
+}
+
+TYPED_TEST_P(BatchedTest, LUSolve)
+{
+  using Pol = TypeParam;
+  constexpr int N = 5, K = 2;
+  const Index_type count = 21;
+
+  using namespace RAJA::batched;
+  Batch<double, InterleavedLayout<N, N, 4>> a(count);
+  Batch<double, InterleavedLayout<N, N, 4>> lu(count);
+  Batch<Index_type, InterleavedLayout<N, 1, 4>> piv(count);
+  Batch<double, InterleavedLayout<N, K, 4>> x(count);
+  for (Index_type e = 0; e < count; ++e) {
+    for (int i = 0; i < N; ++i) {
+      for (int j = 0; j < N; ++j) {
+        // zero diagonal: fails without pivoting
+        a.view(e, i, j) = i == j ? 0.0 : entry(e, i, j) + (j == (i + 1) % N);
+        lu.view(e, i, j) = a.view(e, i, j);
+      }
+      for (int c = 0; c < K; ++c) {
+        x.view(e, i, c) = entry(e, i, N + c);
+      }
+    }
+  }
+  auto rhs = x.storage;
+
+  lu_factor<Pol>(lu.view, piv.view);
+  lu_solve<Pol>(lu.view, piv.view, x.view);
+
+  RAJA::View<double, InterleavedLayout<N, K, 4>> b(rhs.data(), count);
+  for (Index_type e = 0; e < count; ++e) {
+    for (int i = 0; i < N; ++i) {
+      for (int c = 0; c < K; ++c) {
+        double ax = 0.0;
+        for (int j = 0; j < N; ++j) {
+          ax += a.view(e, i, j) * x.view(e, j, c);
+        }
+        ASSERT_NEAR(ax, b(e, i, c), 1e-10);
+      }
+    }
+  }
+}
+
+TYPED_TEST_P(BatchedTest, Inverse)
+{
+  using Pol = TypeParam;
+  constexpr int N = 8;
+  const Index_type count = 19;
+
+  using namespace RAJA::batched;
+  Batch<double, InterleavedLayout<N, N, 8>> a(count);
+  Batch<double, InterleavedLayout<N, N, 8>> ainv(count);
+  Batch<double, InterleavedLayout<N, N, 8>> prod(count);
+  for (Index_type e = 0; e < count; ++e) {
+    for (int i = 0; i < N; ++i) {
+      for (int j = 0; j < N; ++j) {
+        a.view(e, i, j) = entry(e, i, j) + (i == j ? 4.0 : 0.0);
+      }
+    }
+  }
+  auto orig = a.storage;
+
+  inverse<Pol>(a.view, ainv.view);
+  multiply<Pol>(a.view, ainv.view, prod.view);
+
+  ASSERT_EQ(a.storage, orig);
+  for (Index_type e = 0; e < count; ++e) {
+    for (int i = 0; i < N; ++i) {
+      for (int j = 0; j < N; ++j) {
+        ASSERT_NEAR(prod.view(e, i, j), i == j ? 1.0 : 0.0, 1e-12);
+      }
+    }
+  }
+}
+
+TYPED_TEST_P(BatchedTest, InverseFloat)
+{
+  using Pol = TypeParam;
+  constexpr int N = 3;
+  const Index_type count = 40;
+
+  using namespace RAJA::batched;
+  using FloatLayout =
+      InterleavedLayout<N, N, default_lanes<float>::value>;
+  Batch<float, FloatLayout> a(count);
+  Batch<float, FloatLayout> ainv(count);
+  for (Index_type e = 0; e < count; ++e) {
+    for (int i = 0; i < N; ++i) {
+      for (int j = 0; j < N; ++j) {
+        a.view(e, i, j) = static_cast<float>(i == j ? e + 1 : 0);
+      }
+    }
+  }
+
+  inverse<Pol>(a.view, ainv.view);
+
+  for (Index_type e = 0; e < count; ++e) {
+    for (int i = 0; i < N; ++i) {
+      ASSERT_FLOAT_EQ(ainv.view(e, i, i), 1.0f / static_cast<float>(e + 1));
+    }
+  }
+}
+
+REGISTER_TYPED_TEST_CASE_P(BatchedTest,
+                           Multiply,
+                           LUSolve,
+                           Inverse,
+                           InverseFloat);
+
+using BatchedPolicies = ::testing::Types<RAJA::seq_exec,
+                                         RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                         ,
+                                         RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                         ,
+                                         RAJA::tbb_for_exec
+#endif
+                                         >;
+
+INSTANTIATE_TYPED_TEST_CASE_P(Batched, BatchedTest, BatchedPolicies);
@@ -0,0 +1,288 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for tensor contractions over Views.
+///
+
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+using RAJA::Index_type;
+using namespace RAJA::contraction;
+
+namespace
+{
+
+RAJA_INDEX_VALUE_T(IM, int, "IM");
+RAJA_INDEX_VALUE_T(ID, int, "ID");
+
+std::vector<double> sequence(Index_type n, double scale)
+{
+  std::vector<double> v(n);
+  for (Index_type i = 0; i < n; ++i) {
+    v[i] = scale * static_cast<double>(i % 13) - 1.0;
+  }
+  return v;
+}
+
+int find(Plan const& plan, char label)
+{
+  for (int k = 0; k < plan.num_loops; ++k) {
+    if (plan.label[k] == label) return k;
+  }
+  return -1;
+}
+
+}  // namespace
+
+TEST(Contraction, LTimesPlan)
+{
+  const Index_type nm = 4, ng = 3, nd = 5, nz = 1000;
+  using View3 = RAJA::View<double, RAJA::Layout<3, Index_type, 2>>;
+  using View2 = RAJA::View<double, RAJA::Layout<2, Index_type, 1>>;
+  View3 phi(nullptr, nm, ng, nz);
+  View2 L(nullptr, nm, nd);
+  View3 psi(nullptr, nd, ng, nz);
+
+  Plan plan = make_plan(phi,
+                        labels<'m', 'g', 'z'>(),
+                        L,
+                        labels<'m', 'd'>(),
+                        psi,
+                        labels<'d', 'g', 'z'>());
+  ASSERT_EQ(plan.num_loops, 4);
+  ASSERT_EQ(plan.label[3], 'z');
+  ASSERT_EQ(plan.tile_loop, -1);
+  ASSERT_FALSE(plan.contracted[0]);
+  ASSERT_TRUE(plan.contracted[find(plan, 'd')]);
+  ASSERT_LT(find(plan, 'm'), find(plan, 'g'));
+
+  // a small cache budget tiles z in multiples of the SIMD width
+  plan = make_plan(phi,
+                   labels<'m', 'g', 'z'>(),
+                   L,
+                   labels<'m', 'd'>(),
+                   psi,
+                   labels<'d', 'g', 'z'>(),
+                   16 * 1024);
+  ASSERT_EQ(plan.label[3], 'z');
+  ASSERT_EQ(plan.tile_loop, 3);
+  ASSERT_LT(plan.tile, nz);
+  ASSERT_EQ(plan.tile % (RAJA::DATA_ALIGN / 8 ? RAJA::DATA_ALIGN / 8 : 1), 0);
+
+  // with g stride-one, g becomes the innermost loop
+  std::array<RAJA::idx_t, 3> perm{{0, 2, 1}};
+  RAJA::View<double, RAJA::Layout<3, Index_type>> phi_g(
+      nullptr, RAJA::make_permuted_layout({{nm, ng, nz}}, perm));
+  RAJA::View<double, RAJA::Layout<3, Index_type>> psi_g(
+      nullptr, RAJA::make_permuted_layout({{nd, ng, nz}}, perm));
+  plan = make_plan(phi_g,
+                   labels<'m', 'g', 'z'>(),
+                   L,
+                   labels<'m', 'd'>(),
+                   psi_g,
+                   labels<'d', 'g', 'z'>());
+  ASSERT_EQ(plan.label[3], 'g');
+
+  // g is too short to tile, so z is tiled instead
+  plan = make_plan(phi_g,
+                   labels<'m', 'g', 'z'>(),
+                   L,
+                   labels<'m', 'd'>(),
+                   psi_g,
+                   labels<'d', 'g', 'z'>(),
+                   16 * 1024);
+  ASSERT_EQ(plan.label[3], 'g');
+  ASSERT_EQ(plan.label[plan.tile_loop], 'z');
+  ASSERT_LT(plan.tile, nz);
+}
+
+TEST(Contraction, ExtentMismatch)
+{
+  RAJA::View<double, RAJA::Layout<2>> c(nullptr, 3, 4);
+  RAJA::View<double, RAJA::Layout<2>> a(nullptr, 3, 5);
+  RAJA::View<double, RAJA::Layout<2>> b(nullptr, 6, 4);
+  ASSERT_THROW(make_plan(c,
+                         labels<'i', 'j'>(),
+                         a,
+                         labels<'i', 'k'>(),
+                         b,
+                         labels<'k', 'j'>()),
+               std::runtime_error);
+}
+
+template <typename ExecPolicy>
+class ContractionTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_CASE_P(ContractionTest);
+
+TYPED_TEST_P(ContractionTest, LTimes)
+{
+  using Pol = TypeParam;
+  const int nm = 5, ng = 3, nd = 7, nz = 301;
+
+  std::vector<double> L_data = sequence(nm * nd, 0.5);
+  std::vector<double> psi_data = sequence(nd * ng * nz, 0.25);
+  std::vector<double> phi_data(nm * ng * nz, 1.0);
+
+  using LView = RAJA::TypedView<double, RAJA::Layout<2, Index_type, 1>, IM, ID>;
+  LView L(L_data.data(), nm, nd);
+  RAJA::View<double, RAJA::Layout<3, Index_type, 2>> psi(psi_data.data(),
+                                                          nd,
+                                                          ng,
+                                                          nz);
+  RAJA::View<double, RAJA::Layout<3, Index_type, 2>> phi(phi_data.data(),
+                                                          nm,
+                                                          ng,
+                                                          nz);
+
+  // small budget to exercise tiling with a partial last tile
+  contract<Pol>(phi,
+                labels<'m', 'g', 'z'>(),
+                L,
+                labels<'m', 'd'>(),
+                psi,
+                labels<'d', 'g', 'z'>(),
+                32 * 1024);
+
+  for (int m = 0; m < nm; ++m) {
+    for (int g = 0; g < ng; ++g) {
+      for (int z = 0; z < nz; ++z) {
+        double ref = 1.0;
+        for (int d = 0; d < nd; ++d) {
+          ref += L(IM(m), ID(d)) * psi(d, g, z);
+        }
+        ASSERT_DOUBLE_EQ(phi(m, g, z), ref);
+      }
+    }
+  }
+}
+
+TYPED_TEST_P(ContractionTest, PermutedMatMul)
+{
+  using Pol = TypeParam;
+  const Index_type ni = 17, nj = 9, nk = 23;
+
+  std::vector<double> a_data = sequence(ni * nk, 1.0);
+  std::vector<double> b_data = sequence(nk * nj, 2.0);
+  std::vector<double> c_data(ni * nj, 0.0);
+
+  using View2 = RAJA::View<double, RAJA::Layout<2, Index_type>>;
+  std::array<RAJA::idx_t, 2> col_major{{1, 0}};
+  View2 a(a_data.data(), RAJA::make_permuted_layout({{ni, nk}}, col_major));
+  View2 b(b_data.data(), nk, nj);
+  View2 c(c_data.data(), RAJA::make_permuted_layout({{ni, nj}}, col_major));
+
+  contract<Pol>(
+      c, labels<'i', 'j'>(), a, labels<'i', 'k'>(), b, labels<'k', 'j'>());
+
+  for (Index_type i = 0; i < ni; ++i) {
+    for (Index_type j = 0; j < nj; ++j) {
+      double ref = 0.0;
+      for (Index_type k = 0; k < nk; ++k) {
+        ref += a(i, k) * b(k, j);
+      }
+      ASSERT_DOUBLE_EQ(c(i, j), ref);
+    }
+  }
+}
+
+TYPED_TEST_P(ContractionTest, DotProductInner)
+{
+  using Pol = TypeParam;
+  const Index_type ni = 11, nk = 2000;
+
+  std::vector<double> a_data = sequence(ni * nk, 0.5);
+  std::vector<double> b_data = sequence(nk, 1.5);
+  std::vector<double> y_data(ni, 0.0);
+
+  RAJA::View<double, RAJA::Layout<2, Index_type, 1>> a(a_data.data(), ni, nk);
+  RAJA::View<double, RAJA::Layout<1, Index_type, 0>> b(b_data.data(), nk);
+  RAJA::View<double, RAJA::Layout<1, Index_type, 0>> y(y_data.data(), ni);
+
+  Plan plan =
+      make_plan(y, labels<'i'>(), a, labels<'i', 'k'>(), b, labels<'k'>());
+  ASSERT_EQ(plan.label[0], 'i');
+  ASSERT_EQ(plan.label[1], 'k');
+  ASSERT_EQ(plan.tile_loop, -1);
+
+  contract<Pol>(y, labels<'i'>(), a, labels<'i', 'k'>(), b, labels<'k'>());
+
+  for (Index_type i = 0; i < ni; ++i) {
+    double ref = 0.0;
+    for (Index_type k = 0; k < nk; ++k) {
+      ref += a(i, k) * b(k);
+    }
+    ASSERT_NEAR(y(i), ref, 1e-9);
+  }
+}
+
+TYPED_TEST_P(ContractionTest, OuterProductAndTrace)
+{
+  using Pol = TypeParam;
+  const Index_type n = 3000;
+
+  std::vector<double> x_data = sequence(n, 1.0);
+  std::vector<double> m_data = sequence(16, 1.0);
+  std::vector<double> out_data(n, 0.0);
+  std::vector<double> t_data(4, 0.0);
+
+  // out(i) += x(i) * x(i): one label, tiled for parallelism
+  RAJA::View<double, RAJA::Layout<1, Index_type, 0>> x(x_data.data(), n);
+  RAJA::View<double, RAJA::Layout<1, Index_type, 0>> out(out_data.data(), n);
+  contract<Pol>(out, labels<'i'>(), x, labels<'i'>(), x, labels<'i'>());
+  for (Index_type i = 0; i < n; ++i) {
+    ASSERT_DOUBLE_EQ(out(i), x(i) * x(i));
+  }
+
+  // t(j) += M(i, i) * M(i, j): a repeated label reads the diagonal
+  RAJA::View<double, RAJA::Layout<2, Index_type, 1>> m(m_data.data(), 4, 4);
+  RAJA::View<double, RAJA::Layout<1, Index_type, 0>> t(t_data.data(), 4);
+  contract<Pol>(t, labels<'j'>(), m, labels<'i', 'i'>(), m, labels<'i', 'j'>());
+  for (Index_type j = 0; j < 4; ++j) {
+    double ref = 0.0;
+    for (Index_type i = 0; i < 4; ++i) {
+      ref += m(i, i) * m(i, j);
+    }
+    ASSERT_DOUBLE_EQ(t(j), ref);
+  }
+}
+
+REGISTER_TYPED_TEST_CASE_P(ContractionTest,
+                           LTimes,
+                           PermutedMatMul,
+                           DotProductInner,
+                           OuterProductAndTrace);
+
+using ContractionPolicies = ::testing::Types<RAJA::seq_exec,
+                                             RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                             ,
+                                             RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                             ,
+                                             RAJA::tbb_for_exec
+#endif
+                                             >;
+
+INSTANTIATE_TYPED_TEST_CASE_P(Contraction,
+                              ContractionTest,
+                              ContractionPolicies);
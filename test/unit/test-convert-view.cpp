@@ -0,0 +1,147 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for mixed-precision and block-scaled Views.
+///
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+TEST(ConvertView, Float16)
+{
+  ASSERT_EQ(float(RAJA::float16(0.0f)), 0.0f);
+  ASSERT_EQ(float(RAJA::float16(1.0f)), 1.0f);
+  ASSERT_EQ(float(RAJA::float16(-2.5f)), -2.5f);
+  ASSERT_EQ(float(RAJA::float16(65504.0f)), 65504.0f);
+  ASSERT_EQ(RAJA::float16(1.0f).bits, 0x3c00);
+
+  // smallest subnormal and ties to even
+  ASSERT_EQ(float(RAJA::float16(std::ldexp(1.0f, -24))), std::ldexp(1.0f, -24));
+  ASSERT_EQ(float(RAJA::float16(std::ldexp(1.0f, -25))), 0.0f);
+  ASSERT_EQ(float(RAJA::float16(1.0f + std::ldexp(1.0f, -11))), 1.0f);
+  ASSERT_EQ(float(RAJA::float16(1.0f + 3 * std::ldexp(1.0f, -11))),
+            1.0f + std::ldexp(1.0f, -9));
+
+  ASSERT_TRUE(std::isinf(float(RAJA::float16(65520.0f))));
+  ASSERT_TRUE(std::isinf(float(RAJA::float16(
+      -std::numeric_limits<float>::infinity()))));
+  ASSERT_TRUE(std::isnan(float(RAJA::float16(
+      std::numeric_limits<float>::quiet_NaN()))));
+}
+
+TEST(ConvertView, BFloat16)
+{
+  ASSERT_EQ(float(RAJA::bfloat16(1.0f)), 1.0f);
+  ASSERT_EQ(float(RAJA::bfloat16(-0.5f)), -0.5f);
+  ASSERT_EQ(float(RAJA::bfloat16(3.14159f)), 3.140625f);
+  ASSERT_EQ(RAJA::bfloat16(1.0f).bits, 0x3f80);
+  ASSERT_TRUE(std::isinf(float(RAJA::bfloat16(
+      std::numeric_limits<float>::max()))));
+  ASSERT_TRUE(std::isnan(float(RAJA::bfloat16(
+      std::numeric_limits<float>::quiet_NaN()))));
+}
+
+TEST(ConvertView, FloatStorageDoubleCompute)
+{
+  const int N = 16, M = 8;
+  std::vector<float> xs(N * M), ys(N * M);
+
+  RAJA::ConvertView<double, float, RAJA::Layout<2>> x(xs.data(), N, M);
+  RAJA::ConvertView<double, float, RAJA::Layout<2>> y(ys.data(), N, M);
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, N), [=](int i) {
+    for (int j = 0; j < M; ++j) {
+      x(i, j) = i + 0.25 * j;
+      y(i, j) = 1.0;
+    }
+  });
+
+  const double a = 2.0;
+  RAJA::forall<RAJA::loop_exec>(RAJA::RangeSegment(0, N), [=](int i) {
+    for (int j = 0; j < M; ++j) {
+      y(i, j) += a * x(i, j);
+    }
+  });
+
+  for (int i = 0; i < N; ++i) {
+    for (int j = 0; j < M; ++j) {
+      double expected = 1.0 + a * (i + 0.25 * j);
+      ASSERT_EQ(ys[i * M + j], static_cast<float>(expected));
+      ASSERT_EQ(static_cast<double>(y(i, j)), expected);
+    }
+  }
+
+  y(0, 0) = x(1, 0);
+  ASSERT_EQ(ys[0], 1.0f);
+}
+
+TEST(ConvertView, HalfStorageBulk)
+{
+  const int N = 1000;
+  std::vector<double> in(N), out(N);
+  std::vector<RAJA::float16> store(N);
+  for (int i = 0; i < N; ++i) {
+    in[i] = std::sin(0.01 * i);
+  }
+
+  RAJA::ConvertPtr<double, RAJA::float16> ptr(store.data());
+  RAJA::compress<RAJA::loop_exec>(ptr, in.data(), N);
+  RAJA::decompress<RAJA::loop_exec>(ptr, out.data(), N);
+
+  RAJA::ConvertView<double, RAJA::float16, RAJA::Layout<1>> v(store.data(), N);
+  for (int i = 0; i < N; ++i) {
+    ASSERT_NEAR(out[i], in[i], std::ldexp(1.0, -11));
+    ASSERT_EQ(static_cast<double>(v(i)), out[i]);
+  }
+}
+
+TEST(ConvertView, BlockScaled)
+{
+  const int N = 1000;
+  using ptr_type = RAJA::BlockScaledPtr<double, std::int16_t, 64>;
+
+  std::vector<double> in(N), out(N);
+  std::vector<std::int16_t> data(N);
+  std::vector<double> scale(ptr_type::num_blocks(N));
+  for (int i = 0; i < N; ++i) {
+    in[i] = (i / 64 + 1) * std::cos(0.1 * i);
+  }
+
+  ptr_type ptr(data.data(), scale.data());
+  RAJA::compress<RAJA::seq_exec>(ptr, in.data(), N);
+  RAJA::decompress<RAJA::seq_exec>(ptr, out.data(), N);
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_LE(std::abs(out[i] - in[i]), 0.5 * scale[i / 64]);
+  }
+
+  RAJA::BlockScaledView<double, std::int16_t, 64, RAJA::Layout<1>> v(ptr, N);
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, N), [=](int i) {
+    v(i) *= 0.5;
+  });
+  for (int i = 0; i < N; ++i) {
+    ASSERT_LE(std::abs(v(i) - 0.5 * in[i]), scale[i / 64]);
+  }
+
+  // stores saturate at the block scale
+  v(0) = 1.0e6;
+  ASSERT_EQ(data[0], std::numeric_limits<std::int16_t>::max());
+}
@@ -0,0 +1,196 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for expression templates over Views.
+///
+
+#include <cmath>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+template <typename T>
+class ExpressionTest : public ::testing::Test
+{
+};
+
+using ExpressionPolicies = ::testing::Types<RAJA::seq_exec,
+                                            RAJA::loop_exec,
+                                            RAJA::simd_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                            ,
+                                            RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                            ,
+                                            RAJA::tbb_for_exec
+#endif
+                                            >;
+
+TYPED_TEST_CASE(ExpressionTest, ExpressionPolicies);
+
+TYPED_TEST(ExpressionTest, Axpy1D)
+{
+  using view_t = RAJA::View<double, RAJA::Layout<1>>;
+  const int n = 1000;
+  std::vector<double> av(n), bv(n), cv(n), dv(n), ev(n);
+  for (int i = 0; i < n; ++i) {
+    bv[i] = i;
+    cv[i] = 2 * i;
+    dv[i] = 0.5 * i;
+    ev[i] = 3.0;
+  }
+  view_t a(av.data(), n), b(bv.data(), n), c(cv.data(), n), d(dv.data(), n),
+      e(ev.data(), n);
+  const double alpha = 0.25;
+
+  RAJA::expr::assign<TypeParam>(a, b + alpha * c - d * e);
+  for (int i = 0; i < n; ++i) {
+    ASSERT_DOUBLE_EQ(av[i], bv[i] + alpha * cv[i] - dv[i] * ev[i]);
+  }
+
+  RAJA::expr::assign<TypeParam>(a, -b / 2.0 + 1);
+  for (int i = 0; i < n; ++i) {
+    ASSERT_DOUBLE_EQ(av[i], -bv[i] / 2.0 + 1);
+  }
+
+  RAJA::expr::assign<TypeParam>(a, 7.0);
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(av[i], 7.0);
+  }
+
+  ASSERT_DOUBLE_EQ(RAJA::expr::sum<TypeParam>(b), 0.5 * n * (n - 1));
+  ASSERT_DOUBLE_EQ(RAJA::expr::sum<TypeParam>(b * b - b),
+                   (n - 2.0) * (n - 1.0) * n / 3.0);
+  ASSERT_DOUBLE_EQ(RAJA::expr::min<TypeParam>(3.0 - b), 3.0 - (n - 1));
+  ASSERT_DOUBLE_EQ(RAJA::expr::max<TypeParam>(d - e), 0.5 * (n - 1) - 3.0);
+}
+
+TYPED_TEST(ExpressionTest, MultiDimensional)
+{
+  using view_t = RAJA::View<float, RAJA::Layout<3>>;
+  const int ni = 4, nj = 5, nk = 33;
+  std::vector<float> xv(ni * nj * nk), yv(ni * nj * nk), zv(ni * nj * nk);
+  view_t x(xv.data(), ni, nj, nk), y(yv.data(), ni, nj, nk),
+      z(zv.data(), ni, nj, nk);
+  for (int i = 0; i < ni; ++i) {
+    for (int j = 0; j < nj; ++j) {
+      for (int k = 0; k < nk; ++k) {
+        y(i, j, k) = static_cast<float>(i + j + k);
+        z(i, j, k) = static_cast<float>(i * j - k);
+      }
+    }
+  }
+
+  RAJA::expr::assign<TypeParam>(x, RAJA::expr::max(y, z) * 2.0f);
+  for (int i = 0; i < ni; ++i) {
+    for (int j = 0; j < nj; ++j) {
+      for (int k = 0; k < nk; ++k) {
+        ASSERT_EQ(x(i, j, k), 2.0f * std::max(y(i, j, k), z(i, j, k)));
+      }
+    }
+  }
+
+  ASSERT_EQ(RAJA::expr::max<TypeParam>(RAJA::expr::abs(z)),
+            static_cast<float>(nk - 1));
+  ASSERT_EQ(RAJA::expr::min<TypeParam>(z - y),
+            static_cast<float>(-2 * (nk - 1) - nj + 1));
+
+  float total = 0.0f;
+  for (float v : yv) {
+    total += v;
+  }
+  ASSERT_FLOAT_EQ(RAJA::expr::sum<TypeParam>(y), total);
+}
+
+TEST(Expression, OffsetLayout)
+{
+  using view_t = RAJA::View<int, RAJA::OffsetLayout<2>>;
+  std::vector<int> av(12, -1), bv(12);
+  view_t a(av.data(), RAJA::make_offset_layout<2>({{-1, 2}}, {{1, 5}}));
+  view_t b(bv.data(), RAJA::make_offset_layout<2>({{-1, 2}}, {{1, 5}}));
+  for (int i = -1; i <= 1; ++i) {
+    for (int j = 2; j <= 4; ++j) {
+      b(i, j) = 10 * i + j;
+    }
+  }
+
+  RAJA::expr::assign<RAJA::seq_exec>(a, b + b);
+  for (int i = -1; i <= 1; ++i) {
+    for (int j = 2; j <= 4; ++j) {
+      ASSERT_EQ(a(i, j), 2 * (10 * i + j));
+    }
+  }
+  ASSERT_EQ(RAJA::expr::sum<RAJA::seq_exec>(b), 3 * (2 + 3 + 4));
+}
+
+TEST(Expression, ExtentMismatch)
+{
+  using view_t = RAJA::View<double, RAJA::Layout<2>>;
+  std::vector<double> av(12), bv(12), cv(12);
+  view_t a(av.data(), 3, 4), b(bv.data(), 3, 4), c(cv.data(), 4, 3);
+
+  ASSERT_THROW(RAJA::expr::assign<RAJA::seq_exec>(a, b + c),
+               std::runtime_error);
+  ASSERT_THROW(RAJA::expr::assign<RAJA::seq_exec>(c, 2.0 * b),
+               std::runtime_error);
+  ASSERT_THROW(RAJA::expr::sum<RAJA::seq_exec>(b * c), std::runtime_error);
+  ASSERT_THROW(RAJA::expr::max<RAJA::seq_exec>(c - a), std::runtime_error);
+}
+
+TEST(Expression, MathFunctions)
+{
+  using view_t = RAJA::View<double, RAJA::Layout<1>>;
+  const int n = 16;
+  std::vector<double> av(n), bv(n);
+  for (int i = 0; i < n; ++i) {
+    bv[i] = 0.1 * (i + 1);
+  }
+  view_t a(av.data(), n), b(bv.data(), n);
+
+  RAJA::expr::assign<RAJA::seq_exec>(
+      a,
+      RAJA::expr::sqrt(b) + RAJA::expr::exp(b) - RAJA::expr::log(b)
+          + RAJA::expr::sin(b) * RAJA::expr::cos(b)
+          + RAJA::expr::pow(b, 2.0) + RAJA::expr::min(b, 0.5));
+  for (int i = 0; i < n; ++i) {
+    const double x = bv[i];
+    ASSERT_DOUBLE_EQ(av[i],
+                     std::sqrt(x) + std::exp(x) - std::log(x)
+                         + std::sin(x) * std::cos(x) + std::pow(x, 2.0)
+                         + std::min(x, 0.5));
+  }
+}
+
+TEST(Expression, ConvertViewLeaf)
+{
+  const int n = 64;
+  std::vector<RAJA::float16> hv(n);
+  std::vector<float> fv(n);
+  RAJA::ConvertView<float, RAJA::float16, RAJA::Layout<1>> h(
+      RAJA::ConvertPtr<float, RAJA::float16>(hv.data()), n);
+  RAJA::View<float, RAJA::Layout<1>> f(fv.data(), n);
+  for (int i = 0; i < n; ++i) {
+    fv[i] = 0.5f * i;
+  }
+
+  RAJA::expr::assign<RAJA::loop_exec>(h, f * 2.0f);
+  RAJA::expr::assign<RAJA::loop_exec>(f, h + f);
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(fv[i], 1.5f * i);
+  }
+}
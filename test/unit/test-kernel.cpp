@@ -282,6 +282,21 @@ using OMPTypes = ::testing::Types<
                              RAJA::omp_parallel_for_exec,
                              For<1, RAJA::loop_exec, For<0, s, Lambda<0>>>>>,
          list<TypedIndex, Index_type>,
+         RAJA::omp_reduce>,
+    list<KernelPolicy<
+             For<1, RAJA::omp_parallel_for_dynamic<2>, For<0, s, Lambda<0>>>>,
+         list<TypedIndex, Index_type>,
+         RAJA::omp_reduce>,
+    list<KernelPolicy<
+             statement::Tile<1,
+                             statement::tile_fixed<2>,
+                             RAJA::omp_parallel_for_guided<>,
+                             For<1, RAJA::loop_exec, For<0, s, Lambda<0>>>>>,
+         list<TypedIndex, Index_type>,
+         RAJA::omp_reduce>,
+    list<KernelPolicy<
+             For<1, RAJA::omp_parallel_for_runtime, For<0, s, Lambda<0>>>>,
+         list<TypedIndex, Index_type>,
          RAJA::omp_reduce>>;
 INSTANTIATE_TYPED_TEST_CASE_P(OpenMP, Kernel, OMPTypes);
 #endif
@@ -289,6 +304,10 @@ INSTANTIATE_TYPED_TEST_CASE_P(OpenMP, Kernel, OMPTypes);
 using TBBTypes = ::testing::Types<
     list<KernelPolicy<For<1, RAJA::tbb_for_exec, For<0, s, Lambda<0>>>>,
          list<TypedIndex, Index_type>,
+         RAJA::tbb_reduce>,
+    list<KernelPolicy<
+             For<1, RAJA::tbb_for_affinity<>, For<0, s, Lambda<0>>>>,
+         list<TypedIndex, Index_type>,
          RAJA::tbb_reduce>>;
 INSTANTIATE_TYPED_TEST_CASE_P(TBB, Kernel, TBBTypes);
 #endif
@@ -0,0 +1,201 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for Struct-of-Arrays Views.
+///
+
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "RAJA/util/SoAArray.hpp"
+#include "RAJA/util/SoAPtr.hpp"
+#include "gtest/gtest.h"
+
+struct Particle {
+  double x, y;
+  double vx, vy;
+  int id;
+  int tag;  // not registered
+};
+
+namespace RAJA
+{
+template <>
+struct soa_fields<Particle> : soa_field_list<RAJA_SOA_FIELD(Particle, x),
+                                             RAJA_SOA_FIELD(Particle, y),
+                                             RAJA_SOA_FIELD(Particle, vx),
+                                             RAJA_SOA_FIELD(Particle, vy),
+                                             RAJA_SOA_FIELD(Particle, id)> {
+};
+}  // namespace RAJA
+
+TEST(SoAView, Reflection)
+{
+  static_assert(RAJA::soa_num_fields<Particle>::value == 5, "");
+  static_assert(std::is_same<RAJA::soa_member_t<Particle, 0>, double>::value,
+                "");
+  static_assert(std::is_same<RAJA::soa_member_t<Particle, 4>, int>::value, "");
+  static_assert(RAJA::soa_field_t<Particle, 2>::pointer() == &Particle::vx,
+                "");
+
+  Particle p{1.0, 2.0, 3.0, 4.0, 5, 6};
+  using y_field = RAJA::soa_field_t<Particle, 1>;
+  ASSERT_EQ(y_field::get(p), 2.0);
+  RAJA::soa_field_t<Particle, 4>::get(p) = 7;
+  ASSERT_EQ(p.id, 7);
+}
+
+TEST(SoAView, FieldAccess)
+{
+  const int ni = 3, nj = 4;
+  std::vector<double> x(ni * nj), y(ni * nj), vx(ni * nj), vy(ni * nj);
+  std::vector<int> id(ni * nj);
+  RAJA::SoAView<Particle, RAJA::Layout<2>> view(
+      RAJA::SoAPointer<Particle>(
+          x.data(), y.data(), vx.data(), vy.data(), id.data()),
+      ni,
+      nj);
+
+  for (int i = 0; i < ni; ++i) {
+    for (int j = 0; j < nj; ++j) {
+      view(i, j)->*&Particle::x = i;
+      view(i, j)->*&Particle::y = j;
+      view(i, j)->*&Particle::vx = 0.5;
+      view(i, j).get<3>() = -0.5;
+      view(i, j)->*&Particle::id = 10 * i + j;
+    }
+  }
+  for (int k = 0; k < ni * nj; ++k) {
+    ASSERT_EQ(x[k], k / nj);
+    ASSERT_EQ(y[k], k % nj);
+    ASSERT_EQ(vx[k], 0.5);
+    ASSERT_EQ(vy[k], -0.5);
+    ASSERT_EQ(id[k], 10 * (k / nj) + k % nj);
+  }
+
+  Particle p = view(2, 1);
+  ASSERT_EQ(p.x, 2.0);
+  ASSERT_EQ(p.y, 1.0);
+  ASSERT_EQ(p.id, 21);
+
+  p.vy = 9.0;
+  view(0, 0) = p;
+  ASSERT_EQ(vy[0], 9.0);
+  ASSERT_EQ(x[0], 2.0);
+
+  view(0, 1) = view(0, 0);
+  ASSERT_EQ(id[1], 21);
+
+  auto xs = RAJA::soa_field_view<0>(view);
+  ASSERT_EQ(&xs(1, 2), &x[1 * nj + 2]);
+}
+
+TEST(SoAView, ReducerStorage)
+{
+  using MinLoc = RAJA::reduce::detail::ValueLoc<double, true>;
+  static_assert(RAJA::soa_registered<MinLoc>::value, "");
+  static_assert(RAJA::soa_registered<Particle>::value, "");
+  static_assert(!RAJA::soa_registered<double>::value, "");
+
+  // registered types get one array per field
+  RAJA::detail::SoAArray<MinLoc, 4> arr;
+  static_assert(sizeof(arr) == 4 * (sizeof(double) + sizeof(RAJA::Index_type)),
+                "");
+  arr.set(2, MinLoc(1.5, 7));
+  ASSERT_EQ(arr.get(2).val, 1.5);
+  ASSERT_EQ(arr.get(2).loc, 7);
+
+  RAJA::detail::SoAArray<Particle, 3> parr;
+  parr.set(1, Particle{1.0, 2.0, 3.0, 4.0, 5, 6});
+  Particle p = parr.get(1);
+  ASSERT_EQ(p.vx, 3.0);
+  ASSERT_EQ(p.id, 5);
+
+  RAJA::detail::SoAArray<double, 2> darr;
+  darr.set(0, 2.5);
+  ASSERT_EQ(darr.get(0), 2.5);
+
+  RAJA::detail::SoAPtr<MinLoc> ptr;
+  ASSERT_FALSE(ptr.allocated());
+  ptr.allocate(8);
+  ASSERT_TRUE(ptr.allocated());
+  ptr.set(5, MinLoc(-2.0, 3));
+  ASSERT_EQ(ptr.get(5).val, -2.0);
+  ASSERT_EQ(ptr.get(5).loc, 3);
+  ptr.deallocate();
+  ASSERT_FALSE(ptr.allocated());
+
+  RAJA::detail::SoAPtr<double> dptr(4);
+  dptr.set(3, 1.25);
+  ASSERT_EQ(dptr.get(3), 1.25);
+  dptr.deallocate();
+}
+
+template <typename T>
+class SoAViewConvert : public ::testing::Test
+{
+};
+
+using SoAPolicies = ::testing::Types<RAJA::seq_exec,
+                                     RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                     ,
+                                     RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                     ,
+                                     RAJA::tbb_for_exec
+#endif
+                                     >;
+
+TYPED_TEST_CASE(SoAViewConvert, SoAPolicies);
+
+TYPED_TEST(SoAViewConvert, RoundTrip)
+{
+  const RAJA::Index_type n = 1000;
+  std::vector<Particle> aos(n), back(n);
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    aos[i] = Particle{1.0 * i, 2.0 * i, 0.5, -1.0, static_cast<int>(i), 3};
+    back[i].tag = -1;
+  }
+
+  RAJA::SoAPointer<Particle> soa = RAJA::soa_allocate<Particle>(n);
+  RAJA::aos_to_soa<TypeParam>(aos.data(), soa, n);
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    ASSERT_EQ(soa.field<0>()[i], 1.0 * i);
+    ASSERT_EQ(soa.field<4>()[i], i);
+  }
+
+  // advance positions through the per-field Views
+  RAJA::SoAView<Particle, RAJA::Layout<1>> view(soa, n);
+  auto x = RAJA::soa_field_view<0>(view);
+  auto vx = RAJA::soa_field_view<2>(view);
+  RAJA::forall<TypeParam>(RAJA::RangeSegment(0, n),
+                          [=](RAJA::Index_type i) { x(i) += 2.0 * vx(i); });
+
+  RAJA::soa_to_aos<TypeParam>(soa, back.data(), n);
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    ASSERT_EQ(back[i].x, 1.0 * i + 1.0);
+    ASSERT_EQ(back[i].y, 2.0 * i);
+    ASSERT_EQ(back[i].vy, -1.0);
+    ASSERT_EQ(back[i].id, i);
+    ASSERT_EQ(back[i].tag, -1);
+  }
+
+  RAJA::soa_deallocate(soa);
+  ASSERT_EQ(soa.field<0>(), nullptr);
+}
@@ -0,0 +1,107 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for Views with compile-time extents.
+///
+
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+using Block = RAJA::StaticView<double, RAJA::PERM_IJ, 3, 4>;
+using BlockT = RAJA::StaticView<double, RAJA::PERM_JI, 3, 4>;
+
+static_assert(RAJA::static_extent<Block, 0>::value == 3, "");
+static_assert(RAJA::static_extent<Block, 1>::value == 4, "");
+static_assert(Block::layout_type::size() == 12, "");
+static_assert(Block::layout_type::s_oper(2, 3) == 11, "");
+static_assert(BlockT::layout_type::s_oper(2, 3) == 11, "");
+static_assert(BlockT::layout_type::s_oper(1, 0) == 1, "");
+
+TEST(StaticView, Indexing)
+{
+  double data[12];
+  for (int i = 0; i < 12; ++i) {
+    data[i] = i;
+  }
+
+  Block a(data);
+  BlockT at(data);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      ASSERT_EQ(&a(i, j), &data[4 * i + j]);
+      ASSERT_EQ(&at(i, j), &data[i + 3 * j]);
+    }
+  }
+
+  auto seg = RAJA::static_segment<1>(a);
+  ASSERT_EQ(*seg.begin(), 0);
+  ASSERT_EQ(seg.end() - seg.begin(), 4);
+}
+
+TEST(StaticView, BatchedMatMulKernel)
+{
+  using Mat = RAJA::StaticView<double, RAJA::PERM_IJ, 3, 3>;
+  constexpr int N = RAJA::static_extent<Mat, 0>::value;
+  const int num_elem = 50;
+
+  std::vector<double> a(9 * num_elem), b(9 * num_elem), c(9 * num_elem, 0.0);
+  for (int e = 0; e < num_elem; ++e) {
+    for (int k = 0; k < 9; ++k) {
+      a[9 * e + k] = e + k;
+      b[9 * e + k] = e - k;
+    }
+  }
+  double *pa = a.data(), *pb = b.data(), *pc = c.data();
+
+  using Pol = RAJA::KernelPolicy<RAJA::statement::For<
+      0,
+      RAJA::loop_exec,
+      RAJA::statement::ForUnroll<
+          1,
+          N,
+          RAJA::statement::ForUnroll<
+              2,
+              N,
+              RAJA::statement::ForUnroll<3, N, RAJA::statement::Lambda<0>>>>>>;
+
+  Mat probe(nullptr);
+  RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, num_elem),
+                                     RAJA::static_segment<0>(probe),
+                                     RAJA::static_segment<1>(probe),
+                                     RAJA::static_segment<1>(probe)),
+                    [=](RAJA::Index_type e,
+                        RAJA::Index_type i,
+                        RAJA::Index_type j,
+                        RAJA::Index_type k) {
+                      Mat ae(pa + 9 * e), be(pb + 9 * e), ce(pc + 9 * e);
+                      ce(i, j) += ae(i, k) * be(k, j);
+                    });
+
+  for (int e = 0; e < num_elem; ++e) {
+    Mat ae(pa + 9 * e), be(pb + 9 * e), ce(pc + 9 * e);
+    for (int i = 0; i < N; ++i) {
+      for (int j = 0; j < N; ++j) {
+        double sum = 0.0;
+        for (int k = 0; k < N; ++k) {
+          sum += ae(i, k) * be(k, j);
+        }
+        ASSERT_EQ(ce(i, j), sum);
+      }
+    }
+  }
+}
@@ -42,3 +42,59 @@ TEST(ViewTest, Const)
    */
   RAJA::View<double const, layout> const_view2(const_view);
 }
+
+TEST(ViewTest, RowCursor)
+{
+  const int ni = 3, nj = 4, nk = 5;
+  double data[ni * nj * nk];
+  for (int i = 0; i < ni * nj * nk; ++i) {
+    data[i] = i;
+  }
+
+  RAJA::View<double, RAJA::Layout<3>> view(data, ni, nj, nk);
+  auto row = view.row(2, 1);
+  for (int k = 0; k < nk; ++k) {
+    ASSERT_EQ(&row(k), &view(2, 1, k));
+  }
+  row(3) = -1.0;
+  ASSERT_EQ(view(2, 1, 3), -1.0);
+
+  using unit_view = RAJA::View<double, RAJA::Layout<3, RAJA::Index_type, 2>>;
+  static_assert(std::is_same<unit_view::row_type,
+                             RAJA::RowCursor<double *, true>>::value,
+                "stride-one last dimension should be detected");
+  static_assert(std::is_same<decltype(view)::row_type,
+                             RAJA::RowCursor<double *, false>>::value,
+                "");
+  unit_view uview(data, ni, nj, nk);
+  ASSERT_EQ(&uview.row(1, 1)(4), &uview(1, 1, 4));
+
+  // permuted: the last index is the slowest
+  RAJA::View<double, RAJA::Layout<3>> perm(
+      data,
+      RAJA::make_permuted_layout({{ni, nj, nk}},
+                                 RAJA::as_array<RAJA::PERM_KJI>::get()));
+  auto prow = perm.row(1, 2);
+  for (int k = 0; k < nk; ++k) {
+    ASSERT_EQ(&prow(k), &perm(1, 2, k));
+  }
+
+  // offset layout
+  RAJA::View<double, RAJA::OffsetLayout<2>> off(
+      data, RAJA::make_offset_layout<2>({{-1, 3}}, {{1, 7}}));
+  auto orow = off.row(0);
+  for (int j = 3; j <= 7; ++j) {
+    ASSERT_EQ(&orow(j), &off(0, j));
+  }
+  // first row: the offset of index 0 lies before the start of data
+  auto first_row = off.row(-1);
+  for (int j = 3; j <= 7; ++j) {
+    ASSERT_EQ(&first_row(j), &off(-1, j));
+  }
+
+  // typed view
+  RAJA::TypedView<double, RAJA::Layout<2>, RAJA::Index_type, RAJA::Index_type>
+      typed(data, ni * nj, nk);
+  auto trow = typed.row(RAJA::Index_type(7));
+  ASSERT_EQ(&trow(2), &typed(7, 2));
+}